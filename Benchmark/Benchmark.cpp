@@ -0,0 +1,50 @@
+#include <cstring>
+
+#include "Benchmark/Benchmark.hpp"
+
+namespace Benchmark
+{
+    struct Entry
+    {
+        const char* name;
+        Function function;
+    };
+
+    static Entry& GetEntry(Size index)
+    {
+        static Entry entries[256];
+        return entries[index];
+    }
+
+    static Size& GetEntryCount()
+    {
+        static Size count = 0;
+        return count;
+    }
+
+    Registration::Registration(const char* name, Function function)
+    {
+        GetEntry(GetEntryCount()++) = Entry{name, function};
+    }
+}
+
+/**
+ * \brief Runs every registered benchmark, or only the ones whose name contains one of the arguments
+ */
+int main(int argc, char** argv)
+{
+    for(Size i = 0; i < Benchmark::GetEntryCount(); i++)
+    {
+        const auto& entry = Benchmark::GetEntry(i);
+
+        bool selected = argc < 2;
+        for(int arg = 1; arg < argc && !selected; arg++)
+        {
+            selected = strstr(entry.name, argv[arg]) != nullptr;
+        }
+        if(!selected) continue;
+
+        std::printf("== %s\n", entry.name);
+        entry.function();
+    }
+}
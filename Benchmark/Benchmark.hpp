@@ -0,0 +1,72 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "WSTL/Types.hpp"
+
+namespace Benchmark
+{
+    typedef std::chrono::steady_clock Clock;
+    typedef void (*Function)();
+
+    /**
+     * \brief Registers a benchmark function so the runner in Benchmark.cpp can find it
+     */
+    struct Registration
+    {
+        Registration(const char* name, Function function);
+    };
+
+    /**
+     * \brief Prevents the optimizer from discarding a computed value: the value has to exist at this point, and
+     * memory is treated as read and written so stores before the call are kept too
+     */
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        const volatile char sink = reinterpret_cast<const volatile char&>(value);
+        (void)sink;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "g"(value) : "memory");
+#endif
+    }
+
+    /**
+     * \brief Runs `function` `repetitions` times and returns the best wall time in nanoseconds
+     */
+    template<class F>
+    double Measure(F&& function, int repetitions = 5)
+    {
+        double best = 0.0;
+        for(int i = 0; i < repetitions; i++)
+        {
+            const auto start = Clock::now();
+            function();
+            const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            if(i == 0 || elapsed < best) best = elapsed;
+        }
+        return best;
+    }
+
+    /**
+     * \brief Prints one result line, `items` is the amount of work done inside the measured time
+     */
+    inline void Report(const char* name, const char* variant, double nanoseconds, Size items)
+    {
+        std::printf("%-28s %-36s %12.3f ms %10.2f ns/item\n", name, variant, nanoseconds / 1e6,
+                    items == 0 ? 0.0 : nanoseconds / static_cast<double>(items));
+    }
+}
+
+/**
+ * \brief Defines a benchmark that gets picked up by the runner
+ */
+#define WSTL_BENCHMARK(Name) \
+    static void Name(); \
+    static Benchmark::Registration Name##Registration(#Name, &Name); \
+    static void Name()
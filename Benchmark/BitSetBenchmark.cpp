@@ -0,0 +1,95 @@
+#include <bitset>
+#include <cstdio>
+#include <memory>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/BitSet.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    // Every size processes the same amount of bits per measurement
+    constexpr Size TotalBits = Size{1} << 28;
+
+    template<Size N, class BitSetType>
+    void Fill(BitSetType& bitSet, UI32 seed)
+    {
+        for(Size i = 0; i < N; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            bitSet.set(i, (seed >> 16) & 1);
+        }
+    }
+
+    template<Size N>
+    void Fill(BitSet<N>& bitSet, UI32 seed)
+    {
+        for(Size i = 0; i < N; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            bitSet.Set(i, (seed >> 16) & 1);
+        }
+    }
+
+    template<Size N>
+    void CompareBitSets(const char* name)
+    {
+        constexpr Size Repetitions = TotalBits / N;
+        constexpr Size Words = Repetitions * ((N + 63) / 64);
+
+        auto a = std::make_unique<BitSet<N>>();
+        auto b = std::make_unique<BitSet<N>>();
+        auto standardA = std::make_unique<std::bitset<N>>();
+        auto standardB = std::make_unique<std::bitset<N>>();
+        Fill<N>(*a, 1);
+        Fill<N>(*b, 2);
+        Fill<N, std::bitset<N>>(*standardA, 1);
+        Fill<N, std::bitset<N>>(*standardB, 2);
+
+        char variant[64];
+        Size sink = 0;
+
+        std::snprintf(variant, sizeof(variant), "&= std::bitset");
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) *standardA &= *standardB; }), Words);
+        std::snprintf(variant, sizeof(variant), "&= %s", BitKernels::InstructionSet);
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) *a &= *b; }), Words);
+        std::snprintf(variant, sizeof(variant), "AndNot %s", BitKernels::InstructionSet);
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) a->AndNot(*b); }), Words);
+
+        Fill<N>(*a, 1);
+        Fill<N, std::bitset<N>>(*standardA, 1);
+
+        std::snprintf(variant, sizeof(variant), "<<= 67 std::bitset");
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) *standardA <<= 67; }), Words);
+        std::snprintf(variant, sizeof(variant), "<<= 67 %s", BitKernels::InstructionSet);
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) *a <<= 67; }), Words);
+
+        Fill<N>(*a, 1);
+        Fill<N, std::bitset<N>>(*standardA, 1);
+
+        std::snprintf(variant, sizeof(variant), "Count std::bitset");
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) sink += standardA->count(); }), Words);
+        std::snprintf(variant, sizeof(variant), "Count %s", BitKernels::InstructionSet);
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) sink += a->Count(); }), Words);
+
+        b->Reset();
+        standardB->reset();
+
+        std::snprintf(variant, sizeof(variant), "None std::bitset");
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) sink += standardB->none(); }), Words);
+        std::snprintf(variant, sizeof(variant), "None %s", BitKernels::InstructionSet);
+        Benchmark::Report(name, variant, Benchmark::Measure([&] { for(Size i = 0; i < Repetitions; i++) sink += b->None(); }), Words);
+
+        Benchmark::DoNotOptimize(sink);
+    }
+}
+
+WSTL_BENCHMARK(BitSetBulk)
+{
+    CompareBitSets<64>("BitSet 64 bits");
+    CompareBitSets<1024>("BitSet 1 Kbit");
+    CompareBitSets<16384>("BitSet 16 Kbit");
+    CompareBitSets<65536>("BitSet 64 Kbit");
+    CompareBitSets<1048576>("BitSet 1 Mbit");
+}
@@ -0,0 +1,76 @@
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/BloomFilter.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    std::vector<UI64> MakeKeys(Size count, UI64 seed)
+    {
+        std::vector<UI64> keys(count);
+        for(Size i = 0; i < count; i++)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            keys[i] = seed;
+        }
+        return keys;
+    }
+
+    template<class Filter>
+    void MeasureFilter(const char* name, Filter& filter, const std::vector<UI64>& keys, const std::vector<UI64>& absent)
+    {
+        char variant[64];
+
+        Benchmark::Report(name, "InsertMany", Benchmark::Measure([&] { filter.InsertMany(keys.begin(), keys.end()); }, 3), keys.size());
+
+        Size hits = 0;
+        Benchmark::Report(name, "MayContain (present)", Benchmark::Measure([&]
+        {
+            for(const UI64 key : keys) hits += filter.MayContain(key);
+        }), keys.size());
+
+        Size falsePositives = 0;
+        Benchmark::Report(name, "MayContain (absent)", Benchmark::Measure([&]
+        {
+            falsePositives = 0;
+            for(const UI64 key : absent) falsePositives += filter.MayContain(key);
+        }), absent.size());
+
+        std::snprintf(variant, sizeof(variant), "measured FPR %.4f%% (%.1f bits/key, k=%u)",
+                      100.0 * static_cast<double>(falsePositives) / static_cast<double>(absent.size()),
+                      static_cast<double>(filter.BitCount()) / static_cast<double>(keys.size()), filter.HashCount());
+        Benchmark::Report(name, variant, 0.0, 0);
+        Benchmark::DoNotOptimize(hits);
+    }
+}
+
+WSTL_BENCHMARK(BloomFilterQueries)
+{
+    // 16M keys at 1% is ~19 MB of bits, well past the last level cache
+    constexpr Size KeyCount = Size{1} << 24;
+    const std::vector<UI64> keys = MakeKeys(KeyCount, 1);
+    const std::vector<UI64> absent = MakeKeys(KeyCount, 2);
+
+    for(const double rate : {0.01, 0.001})
+    {
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "BloomFilter %g", rate);
+        BloomFilter<UI64> filter(KeyCount, rate);
+        MeasureFilter(name, filter, keys, absent);
+
+        std::snprintf(name, sizeof(name), "BlockedBloomFilter %g", rate);
+        BlockedBloomFilter<UI64> blocked(KeyCount, rate);
+        MeasureFilter(name, blocked, keys, absent);
+
+        std::unique_ptr<bool[]> results(new bool[absent.size()]);
+        Benchmark::Report(name, "MayContainMany (absent)", Benchmark::Measure([&]
+        {
+            blocked.MayContainMany(absent.begin(), absent.end(), results.get());
+        }), absent.size());
+    }
+}
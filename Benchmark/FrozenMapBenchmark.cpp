@@ -0,0 +1,81 @@
+#include <string>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/FrozenMap.hpp"
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/StringView.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size KeyCount = 512;
+
+    constexpr UI32 KeyAt(Size i)
+    {
+        return static_cast<UI32>(i) * 2654435761u;
+    }
+
+    // Built by the compiler, nothing runs at startup
+    constexpr auto Table = []
+    {
+        FrozenMap<UI32, UI32, KeyCount>::Entry entries[KeyCount] = {};
+        for(Size i = 0; i < KeyCount; i++) entries[i] = {KeyAt(i), static_cast<UI32>(i)};
+        return FrozenMap<UI32, UI32, KeyCount>(entries);
+    }();
+
+    constexpr FrozenMap<StringView, UI32, 16> Opcodes = {
+        {"add", 0}, {"sub", 1}, {"mul", 2}, {"div", 3}, {"mod", 4}, {"and", 5}, {"or", 6}, {"xor", 7},
+        {"load", 8}, {"store", 9}, {"push", 10}, {"pop", 11}, {"jump", 12}, {"branch", 13}, {"call", 14},
+        {"return", 15}
+    };
+}
+
+WSTL_BENCHMARK(FrozenMapLookup)
+{
+    constexpr Size Lookups = Size{1} << 20;
+
+    HashMap<UI32, UI32> table(KeyCount * 2);
+    for(Size i = 0; i < KeyCount; i++) table.Insert(KeyAt(i), static_cast<UI32>(i));
+
+    Benchmark::Report("512 integer keys", "HashMap Get", Benchmark::Measure([&]
+    {
+        UI32 sum = 0;
+        for(Size i = 0; i < Lookups; i++) sum += table.Get(KeyAt(i % KeyCount));
+        Benchmark::DoNotOptimize(sum);
+    }), Lookups);
+
+    Benchmark::Report("512 integer keys", "FrozenMap At", Benchmark::Measure([&]
+    {
+        UI32 sum = 0;
+        for(Size i = 0; i < Lookups; i++) sum += Table.At(KeyAt(i % KeyCount));
+        Benchmark::DoNotOptimize(sum);
+    }), Lookups);
+
+    // Copies, so the compiler can't fold the hashes of known literals into the loops
+    const char* literals[] = { "add", "sub", "mul", "div", "mod", "and", "or", "xor",
+                               "load", "store", "push", "pop", "jump", "branch", "call", "return" };
+    std::string storage[16];
+    StringView names[16];
+    for(Size i = 0; i < 16; i++)
+    {
+        storage[i] = literals[i];
+        names[i] = StringView(storage[i]);
+    }
+    HashMap<StringView, UI32> opcodes(32);
+    for(Size i = 0; i < 16; i++) opcodes.Insert(names[i], static_cast<UI32>(i));
+
+    Benchmark::Report("16 opcode names", "HashMap<StringView> Get", Benchmark::Measure([&]
+    {
+        UI32 sum = 0;
+        for(Size i = 0; i < Lookups; i++) sum += opcodes.Get(names[i % 16]);
+        Benchmark::DoNotOptimize(sum);
+    }), Lookups);
+
+    Benchmark::Report("16 opcode names", "FrozenMap<StringView> At", Benchmark::Measure([&]
+    {
+        UI32 sum = 0;
+        for(Size i = 0; i < Lookups; i++) sum += Opcodes.At(names[i % 16]);
+        Benchmark::DoNotOptimize(sum);
+    }), Lookups);
+}
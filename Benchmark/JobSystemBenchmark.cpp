@@ -0,0 +1,71 @@
+#include <cmath>
+#include <thread>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/threading/JobSystem.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size ElementCount = 1 << 22;
+    constexpr Size TinyJobCount = 1 << 16;
+    constexpr Size TinyJobBatch = 1024;
+
+    Size MaxThreads()
+    {
+        const Size hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads == 0 ? 1 : hardwareThreads;
+    }
+}
+
+WSTL_BENCHMARK(JobSystemParallelFor)
+{
+    Vector<float> values(ElementCount, 1.0f);
+
+    const double serial = Benchmark::Measure([&values]
+    {
+        for(auto& value : values) value = std::sqrt(value * 1.0001f + 0.5f);
+    });
+    Benchmark::Report("JobSystemParallelFor", "serial", serial, ElementCount);
+
+    char variant[64];
+    for(Size threadCount = 1; threadCount <= MaxThreads(); threadCount *= 2)
+    {
+        JobSystem jobs(threadCount - 1);
+
+        const double parallel = Benchmark::Measure([&jobs, &values]
+        {
+            jobs.ParallelFor(values, [](float& value) { value = std::sqrt(value * 1.0001f + 0.5f); });
+        });
+        snprintf(variant, sizeof(variant), "%zu threads", jobs.ThreadCount());
+        Benchmark::Report("JobSystemParallelFor", variant, parallel, ElementCount);
+    }
+}
+
+WSTL_BENCHMARK(JobSystemTinyJobs)
+{
+    char variant[64];
+    for(Size threadCount = 1; threadCount <= MaxThreads(); threadCount *= 2)
+    {
+        JobSystem jobs(threadCount - 1);
+        std::atomic<UI64> sum = 0;
+
+        const double elapsed = Benchmark::Measure([&jobs, &sum]
+        {
+            for(Size batch = 0; batch < TinyJobCount; batch += TinyJobBatch)
+            {
+                JobCounter counter;
+                for(Size i = 0; i < TinyJobBatch; i++)
+                {
+                    jobs.Run([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }, counter);
+                }
+                jobs.WaitFor(counter);
+            }
+        });
+        snprintf(variant, sizeof(variant), "%zu threads", jobs.ThreadCount());
+        Benchmark::Report("JobSystemTinyJobs", variant, elapsed, TinyJobCount);
+        Benchmark::DoNotOptimize(sum);
+    }
+}
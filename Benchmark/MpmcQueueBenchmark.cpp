@@ -0,0 +1,108 @@
+#include <mutex>
+#include <thread>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/Queue.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/containers/concurrent/MpmcQueue.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size ItemCount = 1 << 20;
+
+    /**
+     * \brief The baseline this queue replaces: a List-backed Queue behind a mutex
+     */
+    class LockedQueue
+    {
+    public:
+        void Push(UI64 value)
+        {
+            std::lock_guard lock(mutex);
+            queue.Push(value);
+        }
+
+        bool TryPop(UI64& value)
+        {
+            std::lock_guard lock(mutex);
+            if(queue.IsEmpty()) return false;
+            value = queue.Pop();
+            return true;
+        }
+
+    private:
+        std::mutex mutex;
+        Queue<UI64> queue;
+    };
+
+    /**
+     * \brief Runs `threadCount` producers and `threadCount` consumers moving ItemCount values through `queue`
+     */
+    template<class QueueType>
+    void Transfer(QueueType& queue, Size threadCount)
+    {
+        const Size perThread = ItemCount / threadCount;
+        Vector<std::thread*> threads;
+
+        for(Size t = 0; t < threadCount; t++)
+        {
+            threads.PushBack(new std::thread([&queue, perThread]
+            {
+                for(UI64 i = 0; i < perThread; i++) queue.Push(i);
+            }));
+            threads.PushBack(new std::thread([&queue, perThread]
+            {
+                UI64 value = 0, sum = 0;
+                for(Size i = 0; i < perThread; )
+                {
+                    if(queue.TryPop(value))
+                    {
+                        sum += value;
+                        i++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                Benchmark::DoNotOptimize(sum);
+            }));
+        }
+
+        for(auto pThread : threads)
+        {
+            pThread->join();
+            delete pThread;
+        }
+    }
+}
+
+WSTL_BENCHMARK(MpmcQueueScaling)
+{
+    Size maxThreads = std::thread::hardware_concurrency() / 2;
+    if(maxThreads == 0) maxThreads = 1;
+
+    char variant[64];
+    for(Size threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        const Size items = ItemCount / threadCount * threadCount;
+
+        const double locked = Benchmark::Measure([threadCount]
+        {
+            LockedQueue queue;
+            Transfer(queue, threadCount);
+        }, 3);
+        snprintf(variant, sizeof(variant), "mutex+Queue %zux%zu", threadCount, threadCount);
+        Benchmark::Report("MpmcQueueScaling", variant, locked, items);
+
+        const double lockFree = Benchmark::Measure([threadCount]
+        {
+            MpmcQueue<UI64> queue(4096);
+            Transfer(queue, threadCount);
+        }, 3);
+        snprintf(variant, sizeof(variant), "MpmcQueue %zux%zu", threadCount, threadCount);
+        Benchmark::Report("MpmcQueueScaling", variant, lockFree, items);
+    }
+}
@@ -0,0 +1,58 @@
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/algorithms/Parallel.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size ElementCount = 1 << 23;
+
+    Vector<float> MakeValues()
+    {
+        Vector<float> values(ElementCount);
+        UI32 state = 1;
+        for(auto& value : values)
+        {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<float>(state >> 8);
+        }
+        return values;
+    }
+}
+
+WSTL_BENCHMARK(ParallelReduce)
+{
+    const Vector<float> values = MakeValues();
+    JobSystem serialJobs(0);
+    JobSystem jobs;
+
+    double sum = 0.0;
+    const double serial = Benchmark::Measure([&] { sum = Parallel::Reduce(serialJobs, values, 0.0); });
+    Benchmark::Report("ParallelReduce", "1 thread", serial, ElementCount);
+
+    const double parallel = Benchmark::Measure([&] { sum = Parallel::Reduce(jobs, values, 0.0); });
+    Benchmark::Report("ParallelReduce", "all threads", parallel, ElementCount);
+    Benchmark::DoNotOptimize(sum);
+}
+
+WSTL_BENCHMARK(ParallelSort)
+{
+    const Vector<float> source = MakeValues();
+    JobSystem serialJobs(0);
+    JobSystem jobs;
+
+    Vector<float> values;
+    const double serial = Benchmark::Measure([&]
+    {
+        values = source;
+        Parallel::Sort(serialJobs, values);
+    }, 3);
+    Benchmark::Report("ParallelSort", "1 thread (includes copy)", serial, ElementCount);
+
+    const double parallel = Benchmark::Measure([&]
+    {
+        values = source;
+        Parallel::Sort(jobs, values);
+    }, 3);
+    Benchmark::Report("ParallelSort", "all threads (includes copy)", parallel, ElementCount);
+}
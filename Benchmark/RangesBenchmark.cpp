@@ -0,0 +1,64 @@
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/algorithms/Ranges.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+
+WSTL_BENCHMARK(RangesPipeline)
+{
+    constexpr Size Count = Size{1} << 20;
+    Vector<UI32> input(Count);
+    UI64 seed = 1;
+    for(Size i = 0; i < Count; i++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        input[i] = static_cast<UI32>(seed >> 33);
+    }
+
+    // Keep the odd values, scale them, drop the small ones and take the first half million
+    Size checksum = 0;
+    Benchmark::Report("pipeline 1M", "temporary Vectors", Benchmark::Measure([&]
+    {
+        Vector<UI32> odd;
+        for(Size i = 0; i < input.Size(); i++)
+        {
+            if(input[i] & 1) odd.PushBack(input[i]);
+        }
+        Vector<UI64> scaled;
+        for(Size i = 0; i < odd.Size(); i++) scaled.PushBack(static_cast<UI64>(odd[i]) * 3);
+        Vector<UI64> large;
+        for(Size i = 0; i < scaled.Size(); i++)
+        {
+            if(scaled[i] > 1000000) large.PushBack(scaled[i]);
+        }
+        Vector<UI64> result;
+        for(Size i = 0; i < large.Size() && i < Count / 2; i++) result.PushBack(large[i]);
+        checksum += result.Size();
+    }), Count);
+
+    Benchmark::Report("pipeline 1M", "Ranges + Collect", Benchmark::Measure([&]
+    {
+        const Vector<UI64> result = input
+            | Ranges::Filter([](UI32 value) { return (value & 1) != 0; })
+            | Ranges::Transform([](UI32 value) { return static_cast<UI64>(value) * 3; })
+            | Ranges::Filter([](UI64 value) { return value > 1000000; })
+            | Ranges::Take(Count / 2)
+            | Ranges::Collect<Vector<UI64>>();
+        checksum += result.Size();
+    }), Count);
+
+    Benchmark::Report("pipeline 1M", "Ranges, no Collect", Benchmark::Measure([&]
+    {
+        UI64 sum = 0;
+        for(const UI64 value : input
+            | Ranges::Filter([](UI32 value) { return (value & 1) != 0; })
+            | Ranges::Transform([](UI32 value) { return static_cast<UI64>(value) * 3; })
+            | Ranges::Filter([](UI64 value) { return value > 1000000; })
+            | Ranges::Take(Count / 2))
+        {
+            sum += value;
+        }
+        checksum += sum;
+    }), Count);
+    Benchmark::DoNotOptimize(checksum);
+}
@@ -0,0 +1,70 @@
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/SoAVector.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    /**
+     * \brief Particle record as an array of structs would hold it, 64 bytes of which an update pass reads 24
+     */
+    struct Particle
+    {
+        float position[3];
+        float velocity[3];
+        float color[4];
+        float size;
+        float age;
+        float lifetime;
+        UI32 flags;
+    };
+}
+
+WSTL_BENCHMARK(SoAVectorParticles)
+{
+    constexpr Size Count = Size{1} << 20;
+    constexpr float Step = 1.0f / 60.0f;
+
+    Vector<Particle> structs(Count);
+    SoAVector<float, float, float, float, float, float, float, float, float, float, float, float, float, UI32> arrays;
+    arrays.Resize(Count);
+    for(Size i = 0; i < Count; i++)
+    {
+        structs[i].velocity[0] = structs[i].velocity[1] = structs[i].velocity[2] = static_cast<float>(i % 7);
+        arrays.Get<3>(i) = arrays.Get<4>(i) = arrays.Get<5>(i) = static_cast<float>(i % 7);
+    }
+
+    Benchmark::Report("particles 1M", "Vector<Particle> position += velocity", Benchmark::Measure([&]
+    {
+        Particle* pParticles = structs.Data();
+        for(Size i = 0; i < Count; i++)
+        {
+            for(int axis = 0; axis < 3; axis++) pParticles[i].position[axis] += pParticles[i].velocity[axis] * Step;
+        }
+    }), Count);
+    Benchmark::DoNotOptimize(structs.Data()[Count - 1].position[0]);
+
+    Benchmark::Report("particles 1M", "SoAVector position += velocity", Benchmark::Measure([&]
+    {
+        float* pX = arrays.Data<0>();
+        float* pY = arrays.Data<1>();
+        float* pZ = arrays.Data<2>();
+        const float* pVx = arrays.Data<3>();
+        const float* pVy = arrays.Data<4>();
+        const float* pVz = arrays.Data<5>();
+        for(Size i = 0; i < Count; i++)
+        {
+            pX[i] += pVx[i] * Step;
+            pY[i] += pVy[i] * Step;
+            pZ[i] += pVz[i] * Step;
+        }
+    }), Count);
+    Benchmark::DoNotOptimize(arrays.Data<0>()[Count - 1]);
+
+    Benchmark::Report("particles 1M", "SoAVector ForEach<0, 3>", Benchmark::Measure([&]
+    {
+        arrays.ForEach<0, 3>([&](float& x, float vx) { x += vx * Step; });
+    }), Count);
+    Benchmark::DoNotOptimize(arrays.Data<0>()[Count - 1]);
+}
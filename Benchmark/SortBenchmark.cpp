@@ -0,0 +1,88 @@
+#include <algorithm>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/algorithms/Sort.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size ElementCount = 1 << 20;
+
+    template<typename T>
+    Vector<T> MakeRandom(UI32 range)
+    {
+        Vector<T> values(ElementCount);
+        UI32 state = 1;
+        for(auto& value : values)
+        {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<T>((state >> 4) % range);
+        }
+        return values;
+    }
+
+    /**
+     * \brief Times every sort on copies of `source`, the copy is part of each measurement
+     */
+    template<typename T>
+    void CompareSorts(const char* name, const Vector<T>& source)
+    {
+        Vector<T> values;
+
+        const double standard = Benchmark::Measure([&]
+        {
+            values = source;
+            std::sort(values.begin(), values.end());
+        }, 3);
+        Benchmark::Report(name, "std::sort", standard, ElementCount);
+
+        const double pdq = Benchmark::Measure([&]
+        {
+            values = source;
+            Sort(values, [](const T& a, const T& b) { return a < b; });
+        }, 3);
+        Benchmark::Report(name, "WSTL::Sort (pdqsort)", pdq, ElementCount);
+
+        const double radix = Benchmark::Measure([&]
+        {
+            values = source;
+            RadixSort(values);
+        }, 3);
+        Benchmark::Report(name, "WSTL::RadixSort", radix, ElementCount);
+
+        const double standardStable = Benchmark::Measure([&]
+        {
+            values = source;
+            std::stable_sort(values.begin(), values.end());
+        }, 3);
+        Benchmark::Report(name, "std::stable_sort", standardStable, ElementCount);
+
+        const double stable = Benchmark::Measure([&]
+        {
+            values = source;
+            StableSort(values);
+        }, 3);
+        Benchmark::Report(name, "WSTL::StableSort", stable, ElementCount);
+    }
+}
+
+WSTL_BENCHMARK(SortRandom)
+{
+    CompareSorts("SortRandom UI32", MakeRandom<UI32>(0xFFFFFFFu));
+    CompareSorts("SortRandom float", MakeRandom<float>(0xFFFFFFFu));
+}
+
+WSTL_BENCHMARK(SortPatterns)
+{
+    CompareSorts("SortFewUnique", MakeRandom<int>(16));
+
+    Vector<int> ascending(ElementCount);
+    for(Size i = 0; i < ElementCount; i++) ascending[i] = static_cast<int>(i);
+    CompareSorts("SortAscending", ascending);
+
+    Vector<int> descending(ElementCount);
+    for(Size i = 0; i < ElementCount; i++) descending[i] = static_cast<int>(ElementCount - i);
+    CompareSorts("SortDescending", descending);
+}
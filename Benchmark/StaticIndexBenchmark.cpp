@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/algorithms/Search.hpp"
+#include "WSTL/containers/FlatMap.hpp"
+#include "WSTL/containers/StaticIndex.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    std::vector<UI32> MakeQueries(Size count, UI32 limit, UI64 seed)
+    {
+        std::vector<UI32> queries(count);
+        for(Size i = 0; i < count; i++)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            queries[i] = static_cast<UI32>((seed >> 33) % limit);
+        }
+        return queries;
+    }
+
+    void MeasureSize(Size keyCount, bool withMap)
+    {
+        constexpr Size QueryCount = Size{1} << 22;
+
+        // Every other integer is a key, so half of the queries miss
+        Vector<UI32> keys(keyCount);
+        for(Size i = 0; i < keyCount; i++) keys[i] = static_cast<UI32>(2 * i);
+        const std::vector<UI32> queries = MakeQueries(QueryCount, static_cast<UI32>(2 * keyCount), 1);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "Lookup %zu keys", static_cast<size_t>(keyCount));
+
+        Size hits = 0;
+        const UI32* pBegin = keys.Data();
+        const UI32* pEnd = keys.Data() + keys.Size();
+        Benchmark::Report(name, "LowerBound (binary search)", Benchmark::Measure([&]
+        {
+            for(const UI32 query : queries)
+            {
+                const UI32* pFound = LowerBound(pBegin, pEnd, query);
+                hits += pFound != pEnd && *pFound == query;
+            }
+        }), QueryCount);
+
+        const StaticIndex<UI32> index(keys);
+        Benchmark::Report(name, "StaticIndex::Find", Benchmark::Measure([&]
+        {
+            for(const UI32 query : queries) hits += index.Find(query) != index.Size();
+        }), QueryCount);
+
+        std::vector<Size> results(QueryCount);
+        Benchmark::Report(name, "StaticIndex::BatchFind", Benchmark::Measure([&]
+        {
+            index.BatchFind(queries.data(), QueryCount, results.data());
+        }), QueryCount);
+
+        if(withMap)
+        {
+            Map<UI32, UI32> map = FlatMap<UI32, UI32>(keys, keys).ToMap();
+            Benchmark::Report(name, "Map::Contains", Benchmark::Measure([&]
+            {
+                for(const UI32 query : queries) hits += map.Contains(query);
+            }, 3), QueryCount);
+        }
+
+        Benchmark::DoNotOptimize(hits);
+        Benchmark::DoNotOptimize(results);
+    }
+}
+
+WSTL_BENCHMARK(StaticIndexLookups)
+{
+    // 64K keys stay in L2, 16M keys (64 MB) are far past the last level cache. The tree is only built for
+    // the sizes where its nodes still fit in memory comfortably
+    MeasureSize(Size{1} << 16, true);
+    MeasureSize(Size{1} << 20, true);
+    MeasureSize(Size{1} << 24, false);
+}
@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Benchmark/Benchmark.hpp"
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/String.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    /**
+     * \brief Inserts every key into a fresh map, then looks every key up
+     */
+    template<class Key>
+    void Run(const char* variant, const std::vector<Key>& keys)
+    {
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "%s insert", variant);
+        Benchmark::Report("64K keys of 16-22 chars", name, Benchmark::Measure([&]
+        {
+            HashMap<Key, int> map(keys.size() * 2);
+            for(Size i = 0; i < keys.size(); i++) map.Insert(keys[i], static_cast<int>(i));
+            Benchmark::DoNotOptimize(map.Size());
+        }), keys.size());
+
+        HashMap<Key, int> map(keys.size() * 2);
+        for(Size i = 0; i < keys.size(); i++) map.Insert(keys[i], static_cast<int>(i));
+
+        std::snprintf(name, sizeof(name), "%s lookup", variant);
+        Benchmark::Report("64K keys of 16-22 chars", name, Benchmark::Measure([&]
+        {
+            int sum = 0;
+            for(const Key& key : keys) sum += map.Get(key);
+            Benchmark::DoNotOptimize(sum);
+        }), keys.size());
+    }
+}
+
+WSTL_BENCHMARK(StringKeys)
+{
+    constexpr Size Count = Size{1} << 16;
+
+    // Longer than the 15 characters std::string keeps inline, within the 23 String does
+    std::vector<std::string> standardKeys;
+    std::vector<String> keys;
+    for(Size i = 0; i < Count; i++)
+    {
+        char key[32];
+        std::snprintf(key, sizeof(key), "%s.health.%zu", i % 2 == 0 ? "player" : "enemy", i);
+        standardKeys.emplace_back(key);
+        keys.emplace_back(key);
+    }
+
+    Run("HashMap<std::string>", standardKeys);
+    Run("HashMap<String>", keys);
+}
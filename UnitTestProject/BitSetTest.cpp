@@ -140,3 +140,156 @@ TEST(BitSetTest, Conversion)
     BitSet<64> c("1010101010101010101010101010101010101010101010101010101010101010");
     EXPECT_EQ(c.ToULLong(), 0xAAAAAAAAAAAAAAAA);
 }
+
+TEST(BitSetTest, CountWide)
+{
+    BitSet<1000> bitSet;
+    for (::Size i = 0; i < 1000; i += 3) bitSet.Set(i);
+
+    EXPECT_EQ(bitSet.Count(), 334);
+    EXPECT_TRUE(bitSet.Any());
+    EXPECT_FALSE(bitSet.All());
+
+    bitSet.Set();
+    EXPECT_EQ(bitSet.Count(), 1000);
+    EXPECT_TRUE(bitSet.All());
+}
+
+TEST(BitSetTest, Find)
+{
+    BitSet<300> bitSet;
+    EXPECT_EQ(bitSet.FindFirst(), 300);
+    EXPECT_EQ(bitSet.FindLast(), 300);
+
+    bitSet.Set(5);
+    bitSet.Set(63);
+    bitSet.Set(64);
+    bitSet.Set(200);
+    bitSet.Set(299);
+
+    EXPECT_EQ(bitSet.FindFirst(), 5);
+    EXPECT_EQ(bitSet.FindNext(5), 63);
+    EXPECT_EQ(bitSet.FindNext(63), 64);
+    EXPECT_EQ(bitSet.FindNext(64), 200);
+    EXPECT_EQ(bitSet.FindNext(100), 200);
+    EXPECT_EQ(bitSet.FindNext(200), 299);
+    EXPECT_EQ(bitSet.FindNext(299), 300);
+    EXPECT_EQ(bitSet.FindLast(), 299);
+}
+
+TEST(BitSetTest, ForEachSetBit)
+{
+    BitSet<200> bitSet;
+    const ::Size positions[] = {0, 1, 31, 32, 63, 64, 127, 128, 199};
+    for (const auto pos : positions) bitSet.Set(pos);
+
+    ::Size index = 0;
+    bitSet.ForEachSetBit([&](::Size pos) { EXPECT_EQ(pos, positions[index++]); });
+    EXPECT_EQ(index, 9);
+
+    index = 0;
+    for (const auto pos : bitSet.SetBits()) EXPECT_EQ(pos, positions[index++]);
+    EXPECT_EQ(index, 9);
+}
+
+TEST(BitSetTest, ConstexprQueries)
+{
+    constexpr BitSet<100> bitSet = [] {
+        BitSet<100> result;
+        result.Set(10);
+        result.Set(90);
+        return result;
+    }();
+
+    static_assert(bitSet.Count() == 2);
+    static_assert(bitSet.FindFirst() == 10);
+    static_assert(bitSet.FindNext(10) == 90);
+    static_assert(bitSet.FindLast() == 90);
+    static_assert(PopCount(0xF0F0u) == 8);
+    static_assert(CountTrailingZeros(UI64{1} << 40) == 40);
+    static_assert(CountLeadingZeros(UI32{1}) == 31);
+    EXPECT_TRUE(bitSet.Any());
+}
+
+namespace
+{
+    template <::Size N>
+    void FillRandom(BitSet<N>& bitSet, std::bitset<N>& expected, UI32 seed)
+    {
+        for (::Size i = 0; i < N; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const bool value = (seed >> 16) & 1;
+            bitSet.Set(i, value);
+            expected.set(i, value);
+        }
+    }
+
+    template <::Size N>
+    void ExpectEqual(const BitSet<N>& bitSet, const std::bitset<N>& expected)
+    {
+        for (::Size i = 0; i < N; i++) ASSERT_EQ(bitSet[i], expected[i]) << "bit " << i;
+        EXPECT_EQ(bitSet.Count(), expected.count());
+        EXPECT_EQ(bitSet.Any(), expected.any());
+        EXPECT_EQ(bitSet.All(), expected.all());
+    }
+
+    template <::Size N>
+    void CheckBulkOperations()
+    {
+        BitSet<N> a, b;
+        std::bitset<N> expectedA, expectedB;
+        FillRandom(a, expectedA, 1);
+        FillRandom(b, expectedB, 2);
+
+        ExpectEqual(a & b, expectedA & expectedB);
+        ExpectEqual(a | b, expectedA | expectedB);
+        ExpectEqual(a ^ b, expectedA ^ expectedB);
+        ExpectEqual(~a, ~expectedA);
+
+        BitSet<N> c = a;
+        c.AndNot(b);
+        ExpectEqual(c, expectedA & ~expectedB);
+
+        c.OrWith(a, b);
+        ExpectEqual(c, expectedA | expectedB);
+
+        for (const ::Size shift : {::Size{0}, ::Size{1}, ::Size{31}, ::Size{63}, ::Size{64}, ::Size{65}, ::Size{200}, N / 2, N - 1, N, N + 5})
+        {
+            ExpectEqual(a << shift, expectedA << shift);
+            ExpectEqual(a >> shift, expectedA >> shift);
+
+            BitSet<N> shifted = a;
+            shifted <<= shift;
+            ExpectEqual(shifted, expectedA << shift);
+
+            shifted = a;
+            shifted >>= shift;
+            ExpectEqual(shifted, expectedA >> shift);
+        }
+    }
+}
+
+TEST(BitSetTest, BulkOperations)
+{
+    CheckBulkOperations<37>();
+    CheckBulkOperations<64>();
+    CheckBulkOperations<1000>();
+    CheckBulkOperations<4096>();
+}
+
+TEST(BitSetTest, Reductions)
+{
+    BitSet<4096> bitSet;
+    EXPECT_TRUE(bitSet.None());
+
+    bitSet.Set(4000);
+    EXPECT_TRUE(bitSet.Any());
+    EXPECT_EQ(bitSet.Count(), 1);
+
+    bitSet.Set();
+    EXPECT_TRUE(bitSet.All());
+    bitSet.Reset(17);
+    EXPECT_FALSE(bitSet.All());
+    EXPECT_EQ(bitSet.Count(), 4095);
+}
@@ -0,0 +1,158 @@
+﻿#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "WSTL/containers/BloomFilter.hpp"
+#include "WSTL/containers/StringView.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    struct Point
+    {
+        UI32 x, y;
+
+        Size Hash() const
+        {
+            return static_cast<Size>(x) * 31 + static_cast<Size>(y);
+        }
+    };
+
+    std::vector<UI64> MakeKeys(Size count, UI64 offset)
+    {
+        std::vector<UI64> keys(count);
+        for (Size i = 0; i < count; i++) keys[i] = offset + i * 7919;
+        return keys;
+    }
+
+    template <class Filter>
+    double MeasuredFalsePositiveRate(const Filter& filter, Size count)
+    {
+        const std::vector<UI64> absent = MakeKeys(count, UI64{1} << 40);
+        Size positives = 0;
+        for (const UI64 key : absent) positives += filter.MayContain(key);
+        return static_cast<double>(positives) / static_cast<double>(count);
+    }
+
+    template <template <typename> class Filter>
+    void CheckFilter()
+    {
+        const std::vector<UI64> keys = MakeKeys(20000, 1);
+
+        Filter<UI64> filter(keys.size(), 0.01);
+        filter.InsertMany(keys.begin(), keys.end());
+        for (const UI64 key : keys) ASSERT_TRUE(filter.MayContain(key));
+
+        const double rate = MeasuredFalsePositiveRate(filter, 100000);
+        EXPECT_LT(rate, 0.02);
+        EXPECT_GT(filter.FillRatio(), 0.3);
+
+        // Bulk and single inserts set the same bits
+        Filter<UI64> single(keys.size(), 0.01);
+        for (const UI64 key : keys) single.Insert(key);
+        std::vector<Byte> a(filter.SerializedSize()), b(single.SerializedSize());
+        filter.Serialize(a.data());
+        single.Serialize(b.data());
+        EXPECT_EQ(a, b);
+
+        // Union has the keys of both sides
+        const std::vector<UI64> more = MakeKeys(5000, 3);
+        Filter<UI64> other(keys.size(), 0.01);
+        other.InsertMany(more.data(), more.data() + more.size());
+        const Filter<UI64> both = filter | other;
+        for (const UI64 key : keys) ASSERT_TRUE(both.MayContain(key));
+        for (const UI64 key : more) ASSERT_TRUE(both.MayContain(key));
+
+        Filter<UI64> smaller(100, 0.01);
+        EXPECT_THROW(smaller |= filter, std::invalid_argument);
+
+        // Round trip and corrupted input
+        const Filter<UI64> copy = Filter<UI64>::Deserialize(a.data(), a.size());
+        EXPECT_EQ(copy.BitCount(), filter.BitCount());
+        EXPECT_EQ(copy.HashCount(), filter.HashCount());
+        for (const UI64 key : keys) ASSERT_TRUE(copy.MayContain(key));
+        EXPECT_THROW(Filter<UI64>::Deserialize(a.data(), a.size() - 8), std::invalid_argument);
+        EXPECT_THROW(Filter<UI64>::Deserialize(a.data(), 4), std::invalid_argument);
+        a[0] ^= 1;
+        EXPECT_THROW(Filter<UI64>::Deserialize(a.data(), a.size()), std::invalid_argument);
+
+        filter.Clear();
+        EXPECT_EQ(filter.FillRatio(), 0.0);
+        EXPECT_FALSE(filter.MayContain(keys[0]));
+
+        EXPECT_THROW(Filter<UI64>(100, 0.0), std::invalid_argument);
+        EXPECT_THROW(Filter<UI64>(100, 1.0), std::invalid_argument);
+        EXPECT_THROW(Filter<UI64>::FromBitCount(0, 3), std::invalid_argument);
+    }
+}
+
+TEST(BloomFilterTest, Standard)
+{
+    CheckFilter<BloomFilter>();
+
+    const auto filter = BloomFilter<UI32>::FromBitCount(1000, 3);
+    EXPECT_EQ(filter.BitCount(), 1024);
+    EXPECT_EQ(filter.HashCount(), 3);
+    EXPECT_EQ(filter.EstimatedFalsePositiveRate(), 0.0);
+}
+
+TEST(BloomFilterTest, Blocked)
+{
+    CheckFilter<BlockedBloomFilter>();
+
+    const std::vector<UI64> keys = MakeKeys(1000, 5);
+    BlockedBloomFilter<UI64> filter(keys.size(), 0.001);
+    filter.InsertMany(keys.begin(), keys.end());
+
+    const std::vector<UI64> queries = MakeKeys(2000, 5);
+    std::unique_ptr<bool[]> results(new bool[queries.size()]);
+    filter.MayContainMany(queries.begin(), queries.end(), results.get());
+    for (Size i = 0; i < queries.size(); i++) ASSERT_EQ(results[i], filter.MayContain(queries[i]));
+    for (Size i = 0; i < keys.size(); i++) ASSERT_TRUE(results[i]);
+}
+
+TEST(BloomFilterTest, FalsePositiveRate)
+{
+    const std::vector<UI64> keys = MakeKeys(200000, 1);
+    for (const double target : {0.01, 0.001})
+    {
+        BloomFilter<UI64> standard(keys.size(), target);
+        BlockedBloomFilter<UI64> blocked(keys.size(), target);
+        standard.InsertMany(keys.begin(), keys.end());
+        blocked.InsertMany(keys.begin(), keys.end());
+
+        EXPECT_LT(MeasuredFalsePositiveRate(standard, 1000000), target * 1.15) << target;
+        EXPECT_LT(MeasuredFalsePositiveRate(blocked, 1000000), target * 1.15) << target;
+        EXPECT_GT(blocked.BitCount(), standard.BitCount());
+    }
+}
+
+TEST(BloomFilterTest, KeyTypes)
+{
+    BloomFilter<std::string> strings(100, 0.01);
+    strings.Insert("alpha");
+    strings.Insert(std::string(1000, 'x'));
+    EXPECT_TRUE(strings.MayContain("alpha"));
+    EXPECT_TRUE(strings.MayContain(std::string(1000, 'x')));
+
+    // Keys with a Hash() member are hashed with it
+    BlockedBloomFilter<Point> points(100, 0.01);
+    points.Insert({1, 2});
+    EXPECT_TRUE(points.MayContain({1, 2}));
+}
+
+TEST(BloomFilterTest, StringKeysUseMoreThanTheirHash)
+{
+    // Two names whose 32-bit hashes collide still probe different bits
+    const StringView a("key.60586");
+    const StringView b("key.282824");
+    ASSERT_EQ(a.Hash(), b.Hash());
+    EXPECT_NE(BloomInternal::KeyHash(a), BloomInternal::KeyHash(b));
+
+    BloomFilter<StringView> names(100, 0.000001);
+    names.Insert(a);
+    EXPECT_TRUE(names.MayContain(a));
+    EXPECT_FALSE(names.MayContain(b));
+}
@@ -0,0 +1,95 @@
+﻿#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "WSTL/containers/DenseArray.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    int copiesLeft = 0;
+
+    struct CopyLimited
+    {
+        explicit CopyLimited(int value) : value(std::make_unique<int>(value)) {}
+        CopyLimited(const CopyLimited& other) : value(std::make_unique<int>(*other.value))
+        {
+            if(copiesLeft-- <= 0) throw std::runtime_error("copy");
+        }
+        // Not noexcept, so growing copies the elements instead
+        CopyLimited(CopyLimited&& other) : value(std::move(other.value)) {}
+
+        std::unique_ptr<int> value;
+    };
+}
+
+TEST(DenseArrayTest, EmplaceEraseSwap)
+{
+    DenseArray<std::string> array;
+    for(int i = 0; i < 20; i++) array.EmplaceBack(std::to_string(i));
+    EXPECT_EQ(array.Size(), 20);
+    EXPECT_GE(array.Capacity(), 20);
+
+    // The argument refers to an element while the array is full, so it has to survive the growth
+    while(array.Size() != array.Capacity()) array.EmplaceBack("x");
+    const ::Size full = array.Size();
+    array.EmplaceBack(array[0]);
+    EXPECT_EQ(array[full], "0");
+
+    array.EraseSwap(1);
+    EXPECT_EQ(array[1], "0");
+    EXPECT_EQ(array.Size(), full);
+    array.PopBack();
+    EXPECT_EQ(array.Size(), full - 1);
+    EXPECT_THROW(array.EraseSwap(array.Size()), std::out_of_range);
+
+    DenseArray<std::string> copy(array);
+    array.Clear();
+    EXPECT_TRUE(array.IsEmpty());
+    ASSERT_EQ(copy.Size(), full - 1);
+    EXPECT_EQ(copy[0], "0");
+    EXPECT_EQ(copy[2], "2");
+
+    DenseArray<std::string> moved(std::move(copy));
+    EXPECT_EQ(copy.Size(), 0);
+    EXPECT_EQ(moved.Size(), full - 1);
+    EXPECT_THROW(copy.PopBack(), std::out_of_range);
+}
+
+TEST(DenseArrayTest, MoveOnly)
+{
+    DenseArray<std::unique_ptr<int>> array;
+    array.Reserve(3);
+    EXPECT_EQ(array.Capacity(), 3);
+    for(int i = 0; i < 50; i++) array.EmplaceBack(std::make_unique<int>(i));
+
+    int sum = 0;
+    for(const std::unique_ptr<int>& value : array) sum += *value;
+    EXPECT_EQ(sum, 49 * 50 / 2);
+
+    array.EraseSwap(0);
+    EXPECT_EQ(*array[0], 49);
+}
+
+TEST(DenseArrayTest, ThrowingGrowKeepsElements)
+{
+    DenseArray<CopyLimited> array;
+    array.Reserve(4);
+    for(int i = 0; i < 4; i++) array.EmplaceBack(i);
+
+    copiesLeft = 2;
+    EXPECT_THROW(array.EmplaceBack(4), std::runtime_error);
+    EXPECT_EQ(array.Size(), 4);
+    EXPECT_EQ(array.Capacity(), 4);
+    for(int i = 0; i < 4; i++) EXPECT_EQ(*array[i].value, i);
+
+    copiesLeft = 2;
+    EXPECT_THROW(DenseArray<CopyLimited> copy(array), std::runtime_error);
+
+    copiesLeft = 4;
+    array.EmplaceBack(4);
+    EXPECT_EQ(array.Size(), 5);
+    for(int i = 0; i < 5; i++) EXPECT_EQ(*array[i].value, i);
+}
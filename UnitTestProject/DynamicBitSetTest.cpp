@@ -0,0 +1,184 @@
+﻿#include <gtest/gtest.h>
+#include <vector>
+
+#include "WSTL/containers/BitSet.hpp"
+#include "WSTL/containers/DynamicBitSet.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    DynamicBitSet MakeRandom(::Size count, UI32 seed, std::vector<bool>& expected)
+    {
+        DynamicBitSet bitSet;
+        expected.clear();
+        for (::Size i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const bool value = (seed >> 16) & 1;
+            bitSet.PushBack(value);
+            expected.push_back(value);
+        }
+        return bitSet;
+    }
+
+    void ExpectEqual(const DynamicBitSet& bitSet, const std::vector<bool>& expected)
+    {
+        ASSERT_EQ(bitSet.Size(), expected.size());
+
+        ::Size count = 0;
+        for (::Size i = 0; i < expected.size(); i++)
+        {
+            ASSERT_EQ(bitSet[i], expected[i]) << "bit " << i;
+            count += expected[i];
+        }
+        EXPECT_EQ(bitSet.Count(), count);
+    }
+}
+
+TEST(DynamicBitSetTest, Construction)
+{
+    DynamicBitSet empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_TRUE(empty.None());
+    EXPECT_TRUE(empty.All());
+    EXPECT_EQ(empty.FindFirst(), 0);
+
+    // A literal 0 is a size, not a null string
+    const DynamicBitSet zero(0);
+    EXPECT_EQ(zero.Size(), 0);
+    EXPECT_TRUE(zero.None());
+
+    DynamicBitSet ones(130, true);
+    EXPECT_EQ(ones.Size(), 130);
+    EXPECT_EQ(ones.Count(), 130);
+    EXPECT_TRUE(ones.All());
+
+    DynamicBitSet fromString("0110");
+    EXPECT_EQ(fromString.ToString(), "0110");
+
+    // Same bit order as BitSet: the last character is bit 0
+    DynamicBitSet lowBits("0011");
+    EXPECT_EQ(lowBits.Size(), 4);
+    EXPECT_TRUE(lowBits[0]);
+    EXPECT_TRUE(lowBits[1]);
+    EXPECT_FALSE(lowBits[3]);
+    EXPECT_EQ(lowBits.ToString(), BitSet<4>("0011").ToString());
+    EXPECT_THROW(DynamicBitSet("012"), std::invalid_argument);
+
+    DynamicBitSet copy = ones;
+    EXPECT_TRUE(copy == ones);
+
+    DynamicBitSet moved = std::move(copy);
+    EXPECT_EQ(moved.Count(), 130);
+    EXPECT_TRUE(copy.IsEmpty());
+}
+
+TEST(DynamicBitSetTest, PushBackAndResize)
+{
+    DynamicBitSet bitSet;
+    for (::Size i = 0; i < 1000; i++) bitSet.PushBack(i % 3 == 0);
+
+    EXPECT_EQ(bitSet.Size(), 1000);
+    EXPECT_EQ(bitSet.Count(), 334);
+    EXPECT_TRUE(bitSet.Back());
+    EXPECT_TRUE(bitSet.Front());
+
+    bitSet.PopBack();
+    EXPECT_EQ(bitSet.Size(), 999);
+    EXPECT_EQ(bitSet.Count(), 333);
+
+    // Shrinking drops the tail, growing again does not bring it back
+    bitSet.Resize(100);
+    EXPECT_EQ(bitSet.Count(), 34);
+    bitSet.Resize(1000);
+    EXPECT_EQ(bitSet.Count(), 34);
+
+    bitSet.Resize(1100, true);
+    EXPECT_EQ(bitSet.Count(), 134);
+    EXPECT_TRUE(bitSet[1099]);
+    EXPECT_FALSE(bitSet[999]);
+
+    bitSet.Reserve(5000);
+    EXPECT_GE(bitSet.Capacity(), 5000);
+    EXPECT_EQ(bitSet.Size(), 1100);
+
+    bitSet.Clear();
+    EXPECT_TRUE(bitSet.IsEmpty());
+    EXPECT_THROW(bitSet.PopBack(), std::out_of_range);
+    EXPECT_THROW(bitSet.Set(0), std::out_of_range);
+}
+
+TEST(DynamicBitSetTest, BulkOperations)
+{
+    std::vector<bool> expectedA, expectedB;
+    const DynamicBitSet a = MakeRandom(1000, 1, expectedA);
+    const DynamicBitSet b = MakeRandom(1000, 2, expectedB);
+
+    std::vector<bool> expected(1000);
+    for (::Size i = 0; i < 1000; i++) expected[i] = expectedA[i] && expectedB[i];
+    ExpectEqual(a & b, expected);
+
+    for (::Size i = 0; i < 1000; i++) expected[i] = expectedA[i] || expectedB[i];
+    ExpectEqual(a | b, expected);
+
+    for (::Size i = 0; i < 1000; i++) expected[i] = expectedA[i] != expectedB[i];
+    ExpectEqual(a ^ b, expected);
+
+    for (::Size i = 0; i < 1000; i++) expected[i] = !expectedA[i];
+    ExpectEqual(~a, expected);
+
+    DynamicBitSet c = a;
+    c.AndNot(b);
+    for (::Size i = 0; i < 1000; i++) expected[i] = expectedA[i] && !expectedB[i];
+    ExpectEqual(c, expected);
+
+    for (const ::Size shift : {::Size{1}, ::Size{64}, ::Size{100}, ::Size{999}})
+    {
+        for (::Size i = 0; i < 1000; i++) expected[i] = i >= shift && expectedA[i - shift];
+        ExpectEqual(a << shift, expected);
+
+        for (::Size i = 0; i < 1000; i++) expected[i] = i + shift < 1000 && expectedA[i + shift];
+        ExpectEqual(a >> shift, expected);
+    }
+
+    DynamicBitSet shorter(10);
+    EXPECT_THROW(c &= shorter, std::invalid_argument);
+}
+
+TEST(DynamicBitSetTest, Find)
+{
+    DynamicBitSet bitSet(300);
+    EXPECT_EQ(bitSet.FindFirst(), 300);
+
+    const ::Size positions[] = {3, 64, 65, 200, 299};
+    for (const auto pos : positions) bitSet.Set(pos);
+
+    EXPECT_EQ(bitSet.FindFirst(), 3);
+    EXPECT_EQ(bitSet.FindNext(65), 200);
+    EXPECT_EQ(bitSet.FindNext(299), 300);
+    EXPECT_EQ(bitSet.FindLast(), 299);
+
+    ::Size index = 0;
+    bitSet.ForEachSetBit([&](::Size pos) { EXPECT_EQ(pos, positions[index++]); });
+    EXPECT_EQ(index, 5);
+
+    index = 0;
+    for (const auto pos : bitSet.SetBits()) EXPECT_EQ(pos, positions[index++]);
+    EXPECT_EQ(index, 5);
+}
+
+TEST(DynamicBitSetTest, PackedBoolVector)
+{
+    DynamicBitSet flags(70);
+    for (auto flag : flags) flag = true;
+    EXPECT_TRUE(flags.All());
+
+    flags[5] = false;
+    flags[6].flip();
+
+    ::Size setCount = 0;
+    const DynamicBitSet& constFlags = flags;
+    for (const bool flag : constFlags) setCount += flag;
+    EXPECT_EQ(setCount, 68);
+}
@@ -0,0 +1,120 @@
+﻿#include <gtest/gtest.h>
+#include <map>
+
+#include "WSTL/containers/FlatMap.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    FlatMap<UI32, UI32> MakeRandom(Size count, UI32 seed, std::map<UI32, UI32>& expected)
+    {
+        Vector<UI32> keys, values;
+        for (Size i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const UI32 key = (seed >> 8) % (count * 2);
+            keys.PushBack(key);
+            values.PushBack(static_cast<UI32>(i));
+            expected.insert({key, static_cast<UI32>(i)});
+        }
+        return FlatMap<UI32, UI32>(std::move(keys), std::move(values));
+    }
+}
+
+TEST(FlatMapTest, Construction)
+{
+    std::map<UI32, UI32> expected;
+    const FlatMap<UI32, UI32> map = MakeRandom(5000, 1, expected);
+
+    ASSERT_EQ(map.Size(), expected.size());
+    Size i = 0;
+    for (const auto& [key, value] : expected)
+    {
+        EXPECT_EQ(map.KeyAt(i), key);
+        EXPECT_EQ(map.ValueAt(i), value) << "the first of equal keys is kept";
+        i++;
+    }
+
+    const FlatMap<UI32, UI32> empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ(empty.LowerBound(3), 0);
+    EXPECT_EQ(empty.Find(3), nullptr);
+
+    EXPECT_THROW((FlatMap<UI32, UI32>(Vector<UI32>{1, 2}, Vector<UI32>{1})), std::invalid_argument);
+}
+
+TEST(FlatMapTest, Lookup)
+{
+    std::map<UI32, UI32> expected;
+    FlatMap<UI32, UI32> map = MakeRandom(3000, 2, expected);
+
+    for (UI32 key = 0; key < 6001; key++)
+    {
+        const auto lower = expected.lower_bound(key);
+        const auto upper = expected.upper_bound(key);
+        ASSERT_EQ(map.LowerBound(key), static_cast<Size>(std::distance(expected.begin(), lower)));
+        ASSERT_EQ(map.UpperBound(key), static_cast<Size>(std::distance(expected.begin(), upper)));
+
+        const auto range = map.EqualRange(key);
+        ASSERT_EQ(range.first, map.LowerBound(key));
+        ASSERT_EQ(range.second, map.UpperBound(key));
+
+        ASSERT_EQ(map.Contains(key), expected.count(key) == 1);
+        if (expected.count(key)) ASSERT_EQ(*map.Find(key), expected[key]);
+        else ASSERT_THROW(map.Get(key), std::out_of_range);
+    }
+}
+
+TEST(FlatMapTest, Modifiers)
+{
+    FlatMap<int, char> map;
+    EXPECT_TRUE(map.Insert(5, 'e'));
+    EXPECT_TRUE(map.Insert(1, 'a'));
+    EXPECT_TRUE(map.Insert(9, 'i'));
+    EXPECT_FALSE(map.Insert(5, 'x'));
+    EXPECT_EQ(map.Get(5), 'e');
+
+    map[3] = 'c';
+    map[9] = 'I';
+    EXPECT_EQ(map.Size(), 4);
+    EXPECT_EQ(map.At(9), 'I');
+
+    EXPECT_TRUE(map.Erase(1));
+    EXPECT_FALSE(map.Erase(1));
+
+    std::string visited;
+    map.ForEach([&visited](int, char value) { visited.push_back(value); });
+    EXPECT_EQ(visited, "ceI");
+
+    FlatMap<int, char> moved = std::move(map);
+    EXPECT_EQ(moved.Size(), 3);
+    map = moved;
+    EXPECT_EQ(map.Size(), 3);
+    map.Clear();
+    EXPECT_TRUE(map.IsEmpty());
+}
+
+TEST(FlatMapTest, MapConversion)
+{
+    for (Size count : {0, 1, 2, 3, 7, 8, 100, 1023, 1024, 1025})
+    {
+        Map<UI32, UI32> map;
+        for (UI32 i = 0; i < count; i++) map.Insert(i * 3, i);
+
+        const FlatMap<UI32, UI32> flat(map);
+        ASSERT_EQ(flat.Size(), count);
+        for (UI32 i = 0; i < count; i++) ASSERT_EQ(flat.Get(i * 3), i);
+
+        Map<UI32, UI32> back = flat.ToMap();
+        ASSERT_EQ(back.Size(), count);
+        for (UI32 i = 0; i < count; i++) ASSERT_EQ(back.Get(i * 3), i);
+
+        // The rebuilt tree stays a valid red-black tree under further inserts and deletes
+        for (UI32 i = 0; i < count; i++) back.Insert(i * 3 + 1, i);
+        for (UI32 i = 0; i < count; i += 2) back.Delete(i * 3);
+        ASSERT_EQ(back.Size(), count * 2 - (count + 1) / 2);
+        EXPECT_TRUE(count == 0 || back.Contains(1));
+        EXPECT_EQ((FlatMap<UI32, UI32>(back).Size()), back.Size());
+    }
+}
@@ -0,0 +1,71 @@
+﻿#include <gtest/gtest.h>
+#include <set>
+
+#include "WSTL/containers/FlatSet.hpp"
+
+using namespace WSTL;
+
+TEST(FlatSetTest, Construction)
+{
+    Vector<int> values;
+    std::set<int> expected;
+    UI32 seed = 3;
+    for (int i = 0; i < 4000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int value = static_cast<int>((seed >> 8) % 3000) - 1500;
+        values.PushBack(value);
+        expected.insert(value);
+    }
+
+    const FlatSet<int> set(std::move(values));
+    ASSERT_EQ(set.Size(), expected.size());
+    EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+
+    for (int value = -1600; value < 1600; value++)
+    {
+        ASSERT_EQ(set.Contains(value), expected.count(value) == 1);
+        ASSERT_EQ(set.LowerBound(value), static_cast<Size>(std::distance(expected.begin(), expected.lower_bound(value))));
+        ASSERT_EQ(set.UpperBound(value), static_cast<Size>(std::distance(expected.begin(), expected.upper_bound(value))));
+        const auto range = set.EqualRange(value);
+        ASSERT_EQ(range.second - range.first, expected.count(value));
+    }
+
+    EXPECT_THROW((void)set.At(set.Size()), std::out_of_range);
+}
+
+TEST(FlatSetTest, Modifiers)
+{
+    FlatSet<int> set;
+    EXPECT_TRUE(set.Insert(4));
+    EXPECT_TRUE(set.Insert(2));
+    EXPECT_TRUE(set.Insert(8));
+    EXPECT_FALSE(set.Insert(4));
+    EXPECT_EQ(set.Size(), 3);
+    EXPECT_EQ(set[0], 2);
+    EXPECT_EQ(set[2], 8);
+
+    EXPECT_TRUE(set.Erase(2));
+    EXPECT_FALSE(set.Erase(2));
+    EXPECT_EQ(set.IndexOf(8), 1);
+    EXPECT_EQ(set.IndexOf(5), set.Size());
+}
+
+TEST(FlatSetTest, SetConversion)
+{
+    for (int count : {0, 1, 5, 64, 1000})
+    {
+        Set<int> source;
+        for (int i = count; i-- > 0;) source.Insert(i * 2);
+
+        const FlatSet<int> flat(source);
+        ASSERT_EQ(flat.Size(), static_cast<Size>(count));
+        for (int i = 0; i < count; i++) ASSERT_EQ(flat[i], i * 2);
+
+        Set<int> back = flat.ToSet();
+        ASSERT_EQ(back.Size(), static_cast<Size>(count));
+        for (int i = 0; i < count; i++) ASSERT_TRUE(back.Contains(i * 2));
+        back.Insert(-1);
+        EXPECT_EQ(back.Min(), -1);
+    }
+}
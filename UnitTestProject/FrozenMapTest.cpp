@@ -0,0 +1,77 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+
+#include "WSTL/containers/FrozenMap.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/utility/HashedName.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    enum class Opcode { Add, Sub, Mul, Div, Load, Store, Jump, Call, Return };
+
+    constexpr FrozenMap<StringView, Opcode, 9> Opcodes = {
+        {"add", Opcode::Add}, {"sub", Opcode::Sub}, {"mul", Opcode::Mul}, {"div", Opcode::Div},
+        {"load", Opcode::Load}, {"store", Opcode::Store}, {"jump", Opcode::Jump}, {"call", Opcode::Call},
+        {"ret", Opcode::Return}
+    };
+
+    // Lookups are constant expressions too
+    static_assert(Opcodes.At("store") == Opcode::Store);
+    static_assert(!Opcodes.Contains("nop"));
+
+    constexpr auto Squares = MakeFrozenMap<int, int>({{1, 1}, {2, 4}, {3, 9}, {-4, 16}, {1000, 1000000}});
+    static_assert(Squares.Size() == 5);
+    static_assert(Squares.At(-4) == 16);
+
+    constexpr auto Config = MakeFrozenMap<HashedName, int>({{"window.width"_hash, 1280}, {"window.height"_hash, 720}});
+    static_assert(Config.At("window.height"_hash) == 720);
+}
+
+TEST(FrozenMapTest, Lookup)
+{
+    const char* names[] = { "add", "sub", "mul", "div", "load", "store", "jump", "call", "ret" };
+    for(int i = 0; i < 9; i++)
+    {
+        const std::string name = names[i];
+        ASSERT_NE(Opcodes.Find(StringView(name)), nullptr);
+        EXPECT_EQ(*Opcodes.Find(StringView(name)), static_cast<Opcode>(i));
+        EXPECT_EQ(Opcodes[StringView(name)], static_cast<Opcode>(i));
+    }
+    EXPECT_EQ(Opcodes.Find("nop"), nullptr);
+    EXPECT_EQ(Opcodes.Find(""), nullptr);
+    EXPECT_THROW(Opcodes.At("addd"), std::out_of_range);
+
+    int count = 0;
+    Opcodes.ForEach([&](StringView name, Opcode opcode)
+    {
+        EXPECT_EQ(Opcodes.At(name), opcode);
+        count++;
+    });
+    EXPECT_EQ(count, 9);
+    EXPECT_EQ(Opcodes.Keys().Size(), 9u);
+    EXPECT_EQ(Squares.At(1000), 1000000);
+    EXPECT_FALSE(Squares.Contains(5));
+    EXPECT_EQ(Config.At("window.width"_hash), 1280);
+}
+
+TEST(FrozenMapTest, RuntimeConstruction)
+{
+    // Also works at runtime, for tables too large to build in a constant expression
+    constexpr ::Size Count = 2000;
+    auto* pEntries = new FrozenMap<int, int, Count>::Entry[Count];
+    for(int i = 0; i < static_cast<int>(Count); i++) pEntries[i] = {i * 7919, i};
+
+    auto* pMap = new FrozenMap<int, int, Count>(*reinterpret_cast<FrozenMap<int, int, Count>::Entry(*)[Count]>(pEntries));
+    for(int i = 0; i < static_cast<int>(Count); i++) EXPECT_EQ(pMap->At(i * 7919), i);
+    EXPECT_FALSE(pMap->Contains(1));
+    delete pMap;
+
+    pEntries[1].key = pEntries[0].key;
+    EXPECT_THROW((FrozenMap<int, int, Count>(*reinterpret_cast<FrozenMap<int, int, Count>::Entry(*)[Count]>(pEntries))),
+                 std::invalid_argument);
+    delete[] pEntries;
+
+    EXPECT_THROW((FrozenMap<int, int, 3>{{1, 1}, {2, 2}}), std::invalid_argument);
+}
@@ -0,0 +1,64 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+#include <unordered_map>
+
+#include "WSTL/containers/HashMap.hpp"
+
+using namespace WSTL;
+
+TEST(HashMapTest, InsertAndDelete)
+{
+    HashMap<int, int> map;
+    std::unordered_map<int, int> expected;
+    unsigned int seed = 5;
+    for (int i = 0; i < 5000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int key = static_cast<int>((seed >> 8) % 1500);
+        if (seed & 0x80000000u)
+        {
+            map.Delete(key);
+            expected.erase(key);
+        }
+        else
+        {
+            map.Insert(key, i);
+            expected[key] = i;
+        }
+    }
+
+    ASSERT_EQ(map.Size(), expected.size());
+    for (const auto& entry : expected) ASSERT_EQ(map.Get(entry.first), entry.second);
+    EXPECT_THROW(map.Get(2000), std::out_of_range);
+
+    HashMap<int, int> copy(map);
+    map.Clear();
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_EQ(copy.Size(), expected.size());
+}
+
+TEST(HashMapTest, NodeHandle)
+{
+    HashMap<int, std::string> active;
+    HashMap<int, std::string> expired;
+    for (int key = 0; key < 100; key++) active.Insert(key, std::to_string(key));
+
+    for (int key = 0; key < 100; key += 4)
+    {
+        auto node = active.Extract(key);
+        ASSERT_FALSE(node.IsEmpty());
+        EXPECT_EQ(node.Value(), std::to_string(key));
+        EXPECT_TRUE(expired.Insert(std::move(node)));
+    }
+
+    EXPECT_EQ(active.Size(), 75);
+    EXPECT_EQ(expired.Size(), 25);
+    EXPECT_FALSE(active.Contains(8));
+    EXPECT_EQ(expired.Get(8), "8");
+    EXPECT_TRUE(active.Extract(8).IsEmpty());
+
+    auto node = active.Extract(9);
+    node.Key() = 8;
+    EXPECT_FALSE(expired.Insert(std::move(node)));
+    EXPECT_EQ(node.Value(), "9");
+}
@@ -0,0 +1,69 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/utility/Hash.hpp"
+#include "WSTL/utility/HashedName.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr HashedName Health = "player.health"_hash;
+
+    // Evaluated by the compiler, a mismatch with the runtime hash fails the tests below
+    static_assert(Health.Hash() == StringView("player.health").Hash());
+    static_assert(Health == HashedName(StringView("player.health")));
+    static_assert("player.health"_hash != "player.mana"_hash);
+    static_assert(HashedName().Hash() == WSTL::Hash("", 0));
+
+    int Dispatch(HashedName event)
+    {
+        switch(event.Hash())
+        {
+        case "player.health"_hash.Hash(): return 1;
+        case "player.mana"_hash.Hash(): return 2;
+        default: return 0;
+        }
+    }
+}
+
+TEST(HashedNameTest, CompileTimeMatchesRuntime)
+{
+    const char* texts[] = { "", "a", "ab", "abc", "abcd", "abcde", "player.health", "\xff\x80 high bytes" };
+    for(const char* text : texts)
+    {
+        const std::string copy = text;
+        const StringView view(copy);
+        EXPECT_EQ(HashedName(view).Hash(), HashKey(copy));
+        EXPECT_EQ(WSTL::Hash(copy.data(), static_cast<UI32>(copy.size()), 7),
+                  WSTL::Hash(static_cast<const void*>(copy.data()), static_cast<UI32>(copy.size()), 7));
+    }
+
+    constexpr UI32 seeded = WSTL::Hash("player.health", 13, 42);
+    EXPECT_EQ(seeded, WSTL::Hash(static_cast<const void*>("player.health"), 13, 42));
+    EXPECT_EQ(Health.Hash(), HashKey(std::string("player.health")));
+    EXPECT_EQ(HashedName(static_cast<UI32>(Health.Hash())), Health);
+
+#if defined(_DEBUG)
+    EXPECT_EQ(Health.Name(), "player.health");
+#else
+    EXPECT_TRUE(Health.Name().IsEmpty());
+#endif
+}
+
+TEST(HashedNameTest, Keys)
+{
+    const std::string runtime = "player.mana";
+    EXPECT_EQ(Dispatch(Health), 1);
+    EXPECT_EQ(Dispatch(HashedName(StringView(runtime))), 2);
+    EXPECT_EQ(Dispatch("player.stamina"_hash), 0);
+
+    HashMap<HashedName, int> handlers;
+    handlers.Insert("player.health"_hash, 10);
+    handlers.Insert("player.mana"_hash, 20);
+    EXPECT_EQ(handlers.Get(Health), 10);
+    EXPECT_EQ(handlers.Get(HashedName(StringView(runtime))), 20);
+    EXPECT_FALSE(handlers.Contains("player.stamina"_hash));
+}
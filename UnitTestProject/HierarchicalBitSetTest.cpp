@@ -0,0 +1,133 @@
+﻿#include <gtest/gtest.h>
+#include <vector>
+
+#include "WSTL/containers/HierarchicalBitSet.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    template <::Size BitAmount>
+    void ExpectMatches(const HierarchicalBitSet<BitAmount>& bitSet, const std::vector<bool>& expected)
+    {
+        ::Size firstSet = BitAmount, firstClear = BitAmount, lastSet = BitAmount, count = 0;
+        for (::Size i = 0; i < BitAmount; i++)
+        {
+            ASSERT_EQ(bitSet[i], expected[i]) << "bit " << i;
+            if (expected[i] && firstSet == BitAmount) firstSet = i;
+            if (!expected[i] && firstClear == BitAmount) firstClear = i;
+            if (expected[i]) lastSet = i;
+            count += expected[i];
+        }
+
+        EXPECT_EQ(bitSet.FindFirstSet(), firstSet);
+        EXPECT_EQ(bitSet.FindFirstClear(), firstClear);
+        EXPECT_EQ(bitSet.FindLastSet(), lastSet);
+        EXPECT_EQ(bitSet.Count(), count);
+        EXPECT_EQ(bitSet.Any(), count != 0);
+        EXPECT_EQ(bitSet.All(), count == BitAmount);
+
+        std::vector<::Size> visited;
+        bitSet.ForEachSetBit([&visited](::Size pos) { visited.push_back(pos); });
+        ASSERT_EQ(visited.size(), count);
+
+        ::Size i = 0;
+        for (const ::Size pos : bitSet.SetBits()) ASSERT_EQ(pos, visited[i++]);
+
+        // Walk both directions of the search from every position
+        ::Size nextSet = BitAmount, nextClear = BitAmount;
+        for (::Size pos = BitAmount; pos-- > 0;)
+        {
+            ASSERT_EQ(bitSet.FindNextSet(pos), nextSet) << "after " << pos;
+            ASSERT_EQ(bitSet.FindNextClear(pos), nextClear) << "after " << pos;
+            if (expected[pos]) nextSet = pos;
+            else nextClear = pos;
+        }
+    }
+
+    template <::Size BitAmount>
+    void RandomOperations(UI32 seed)
+    {
+        HierarchicalBitSet<BitAmount> bitSet;
+        std::vector<bool> expected(BitAmount);
+        ExpectMatches(bitSet, expected);
+
+        for (::Size round = 0; round < 4; round++)
+        {
+            // Dense runs and isolated bits, so some words end up full and some empty
+            for (::Size i = 0; i < BitAmount / 3; i++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const ::Size pos = round % 2 == 0 ? (seed >> 8) % BitAmount : (seed >> 8) % (BitAmount / 8 + 1);
+                const bool val = round != 3;
+                bitSet.Set(pos, val);
+                expected[pos] = val;
+            }
+            ExpectMatches(bitSet, expected);
+        }
+
+        const HierarchicalBitSet<BitAmount> copy(bitSet.Bits());
+        EXPECT_TRUE(copy == bitSet);
+        ExpectMatches(copy, expected);
+    }
+}
+
+TEST(HierarchicalBitSetTest, SetResetFind)
+{
+    RandomOperations<1>(1);
+    RandomOperations<63>(2);
+    RandomOperations<64>(3);
+    RandomOperations<65>(4);
+    RandomOperations<4096>(5);
+    RandomOperations<5000>(6);
+    RandomOperations<300000>(7);
+}
+
+TEST(HierarchicalBitSetTest, SetAllAndReset)
+{
+    HierarchicalBitSet<70000> bitSet;
+    EXPECT_TRUE(bitSet.None());
+    EXPECT_THROW(bitSet.Set(70000), std::out_of_range);
+    EXPECT_THROW((void)bitSet.Test(70000), std::out_of_range);
+
+    bitSet.Set();
+    EXPECT_TRUE(bitSet.All());
+    EXPECT_EQ(bitSet.FindFirstClear(), 70000);
+    EXPECT_EQ(bitSet.FindLastSet(), 69999);
+
+    bitSet.Reset(69999);
+    bitSet.Reset(12345);
+    EXPECT_EQ(bitSet.FindFirstClear(), 12345);
+    EXPECT_EQ(bitSet.FindNextClear(12345), 69999);
+    EXPECT_FALSE(bitSet.All());
+
+    bitSet.Reset();
+    EXPECT_TRUE(bitSet.None());
+    EXPECT_EQ(bitSet.FindFirstSet(), 70000);
+    EXPECT_EQ(bitSet.FindFirstClear(), 0);
+}
+
+TEST(HierarchicalBitSetTest, Acquire)
+{
+    HierarchicalBitSet<1000> slots;
+    for (::Size i = 0; i < 1000; i++) EXPECT_EQ(slots.Acquire(), i);
+    EXPECT_EQ(slots.Acquire(), 1000);
+
+    slots.Reset(700);
+    slots.Reset(3);
+    EXPECT_EQ(slots.Acquire(), 3);
+    EXPECT_EQ(slots.Acquire(), 700);
+    EXPECT_EQ(slots.Acquire(), 1000);
+}
+
+TEST(HierarchicalBitSetTest, Constexpr)
+{
+    constexpr ::Size first = []
+    {
+        HierarchicalBitSet<10000> bitSet;
+        bitSet.Set(9000);
+        bitSet.Set(130);
+        return bitSet.FindFirstSet() + bitSet.FindNextSet(130);
+    }();
+    EXPECT_EQ(first, 9130);
+}
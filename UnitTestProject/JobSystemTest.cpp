@@ -0,0 +1,225 @@
+﻿#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "WSTL/threading/JobSystem.hpp"
+
+using namespace WSTL;
+
+TEST(JobSystemTest, Run)
+{
+    JobSystem jobs(3);
+    EXPECT_EQ(jobs.ThreadCount(), 4);
+
+    std::atomic<int> sum = 0;
+    JobCounter counter;
+    for(int i = 1; i <= 100; i++)
+    {
+        jobs.Run([&sum, i] { sum += i; }, counter);
+    }
+    jobs.WaitFor(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST(JobSystemTest, Children)
+{
+    JobSystem jobs(2);
+    std::atomic<int> finishedChildren = 0;
+
+    Job* pParent = jobs.Create([] { });
+    for(int i = 0; i < 10; i++)
+    {
+        jobs.Run(jobs.CreateChild(pParent, [&finishedChildren] { ++finishedChildren; }));
+    }
+    const JobHandle handle = jobs.Run(pParent);
+    jobs.Wait(handle);
+
+    EXPECT_TRUE(handle.IsFinished());
+    EXPECT_EQ(finishedChildren.load(), 10);
+}
+
+TEST(JobSystemTest, Continuation)
+{
+    JobSystem jobs(2);
+    std::atomic<int> step = 0;
+    int observed = -1;
+
+    JobCounter counter;
+    Job* pFirst = jobs.Create([&step] { step = 1; });
+    Job* pSecond = jobs.Create([&step, &observed] { observed = step.load(); step = 2; });
+    jobs.AddContinuation(pFirst, pSecond, &counter);
+    jobs.Run(pFirst, &counter);
+    jobs.WaitFor(counter);
+
+    EXPECT_EQ(observed, 1);
+    EXPECT_EQ(step.load(), 2);
+}
+
+TEST(JobSystemTest, ParallelForVector)
+{
+    JobSystem jobs(3);
+    Vector<int> values(10000);
+    for(Size i = 0; i < values.Size(); i++) values[i] = static_cast<int>(i);
+
+    jobs.ParallelFor(values, [](int& value) { value *= 2; });
+
+    for(Size i = 0; i < values.Size(); i++)
+    {
+        EXPECT_EQ(values[i], static_cast<int>(i * 2));
+    }
+}
+
+TEST(JobSystemTest, ParallelForArray)
+{
+    JobSystem jobs(3);
+    Array<int, 64> values;
+    values.Fill(1);
+
+    jobs.ParallelFor(values, [](int& value) { value += 1; }, 4);
+
+    for(Size i = 0; i < values.Size(); i++)
+    {
+        EXPECT_EQ(values[i], 2);
+    }
+}
+
+TEST(JobSystemTest, ForeignThread)
+{
+    JobSystem jobs(2);
+    std::atomic<int> sum = 0;
+
+    std::thread foreign([&jobs, &sum]
+    {
+        JobCounter counter;
+        for(int i = 0; i < 50; i++) jobs.Run([&sum] { ++sum; }, counter);
+        jobs.WaitFor(counter);
+    });
+    foreign.join();
+
+    EXPECT_EQ(sum.load(), 50);
+}
+
+TEST(JobSystemTest, ShortLivedCounters)
+{
+    JobSystem jobs(3);
+    std::atomic<int> sum = 0;
+
+    // Counters live on the stack and die as soon as their wait returns, on a foreign thread and inside ParallelFor
+    std::thread foreign([&jobs, &sum]
+    {
+        for(int i = 0; i < 2000; i++)
+        {
+            JobCounter counter;
+            jobs.Run([&sum] { ++sum; }, counter);
+            jobs.WaitFor(counter);
+        }
+    });
+
+    for(int i = 0; i < 2000; i++)
+    {
+        jobs.ParallelForRange(8, [&sum](Size first, Size last) { sum += static_cast<int>(last - first); }, 1);
+    }
+    foreign.join();
+
+    EXPECT_EQ(sum.load(), 2000 + 2000 * 8);
+}
+
+TEST(JobSystemTest, HandleOutlivesRecycledSlot)
+{
+    JobSystem jobs(1);
+    JobCounter counter;
+    const JobHandle handle = jobs.Run([] { }, counter);
+    jobs.WaitFor(counter);
+
+    // Every slot of the ring is reused, the last job sits where the first one was and is not finished yet
+    for(Size i = 1; i < JobSystem::MaxJobsPerThread; i++) jobs.Run(jobs.Create([] { }));
+    std::atomic<bool> release = false;
+    JobCounter blocked;
+    jobs.Run([&release] { while(!release.load()) std::this_thread::yield(); }, blocked);
+
+    EXPECT_TRUE(handle.IsFinished());
+    jobs.Wait(handle);
+
+    release = true;
+    jobs.WaitFor(blocked);
+}
+
+TEST(JobSystemTest, SystemsDestroyedInAnyOrder)
+{
+    auto a = std::make_unique<JobSystem>(2);
+    auto b = std::make_unique<JobSystem>(2);
+
+    // Destroying the older system first must leave the calling thread bound to the newer one
+    a.reset();
+    std::atomic<int> sum = 0;
+    b->ParallelForRange(1000, [&sum](Size first, Size last) { sum += static_cast<int>(last - first); }, 10);
+    EXPECT_EQ(sum.load(), 1000);
+
+    b.reset();
+    JobSystem c(2);
+    c.ParallelForRange(1000, [&sum](Size first, Size last) { sum += static_cast<int>(last - first); }, 10);
+    EXPECT_EQ(sum.load(), 2000);
+}
+
+TEST(JobSystemTest, TooManyContinuations)
+{
+    JobSystem jobs(2);
+    std::atomic<int> ran = 0;
+
+    JobCounter counter;
+    Job* pFirst = jobs.Create([&ran] { ++ran; });
+    for(Size i = 0; i < Job::MaxContinuations; i++)
+    {
+        jobs.AddContinuation(pFirst, jobs.Create([&ran] { ++ran; }), &counter);
+    }
+    EXPECT_THROW(jobs.AddContinuation(pFirst, jobs.Create([&ran] { ++ran; })), std::out_of_range);
+
+    // The rejected continuation is not counted, only the accepted ones run
+    jobs.Run(pFirst, &counter);
+    jobs.WaitFor(counter);
+    EXPECT_EQ(ran.load(), static_cast<int>(Job::MaxContinuations) + 1);
+}
+
+TEST(JobSystemTest, DestroysPendingCallables)
+{
+    auto token = std::make_shared<int>(0);
+    {
+        JobSystem jobs(1);
+
+        // One job is created and never run, one is queued behind a job that holds the only worker until shutdown
+        jobs.Create([token] { });
+        std::atomic<bool> started = false;
+        std::atomic<bool> release = false;
+        jobs.Run(jobs.Create([&started, &release]
+        {
+            started = true;
+            while(!release.load()) std::this_thread::yield();
+        }));
+        while(!started.load()) std::this_thread::yield();
+
+        std::thread foreign([&jobs, token] { jobs.Run(jobs.Create([token] { })); });
+        foreign.join();
+        EXPECT_EQ(token.use_count(), 3);
+        release = true;
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(JobSystemTest, FailedChildLeavesParentRunnable)
+{
+    JobSystem jobs(1);
+    Job* pParent = jobs.Create([] { });
+
+    // Every other slot of the ring holds an unfinished job, so creating the child throws
+    Vector<Job*> unfinished;
+    for(Size i = 1; i < JobSystem::MaxJobsPerThread; i++) unfinished.PushBack(jobs.Create([] { }));
+    EXPECT_THROW(jobs.CreateChild(pParent, [] { }), std::runtime_error);
+
+    const JobHandle handle = jobs.Run(pParent);
+    jobs.Wait(handle);
+    EXPECT_TRUE(handle.IsFinished());
+
+    for(Job* pJob : unfinished) jobs.Run(pJob);
+}
@@ -157,4 +157,41 @@ TEST(ListTest, Emptiness)
     a.Clear();
 
     EXPECT_TRUE(a.IsEmpty());
-}
\ No newline at end of file
+}
+
+TEST(ListTest, Splice)
+{
+    List<int> a;
+    List<int> b;
+    for (int i = 0; i < 5; i++)
+    {
+        a.PushBack(i);
+        b.PushBack(10 + i);
+    }
+
+    const int* pMoved = &b[1];
+    a.Splice(2, b, 1, 3);
+    EXPECT_EQ(a.Size(), 8);
+    EXPECT_EQ(b.Size(), 2);
+    EXPECT_EQ(&a[2], pMoved);
+
+    const int expectedA[] = { 0, 1, 11, 12, 13, 2, 3, 4 };
+    for (Size i = 0; i < a.Size(); i++) EXPECT_EQ(a[i], expectedA[i]);
+    EXPECT_EQ(b.Front(), 10);
+    EXPECT_EQ(b.Back(), 14);
+
+    a.Splice(a.Size(), b, 1);
+    EXPECT_EQ(a.Back(), 14);
+    EXPECT_EQ(b.Back(), 10);
+
+    a.Splice(0, b);
+    EXPECT_TRUE(b.IsEmpty());
+    EXPECT_EQ(a.Front(), 10);
+    EXPECT_EQ(a.Size(), 10);
+
+    b.Splice(0, a);
+    EXPECT_EQ(b.Size(), 10);
+    EXPECT_EQ(b.Back(), 14);
+    EXPECT_THROW(a.Splice(1, b), std::out_of_range);
+    EXPECT_THROW(b.Splice(0, b), std::invalid_argument);
+}
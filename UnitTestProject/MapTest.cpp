@@ -1,4 +1,7 @@
 ﻿#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
 #include "WSTL/containers/Map.hpp"
 
 using namespace WSTL;
@@ -177,4 +180,126 @@ TEST(MapTest, GetValues)
     EXPECT_EQ(values[0], 'a');
     EXPECT_EQ(values[1], 'b');
     EXPECT_EQ(values[2], 'c');
-}
\ No newline at end of file
+}
+
+TEST(MapTest, Range)
+{
+    MapType map;
+    for (unsigned int key = 0; key < 1000; key++) map.Insert(key * 2, static_cast<char>(key % 26 + 'a'));
+
+    EXPECT_EQ(map.LowerBound(501)->key, 502u);
+    EXPECT_EQ(map.UpperBound(502)->key, 504u);
+    EXPECT_EQ(MapType::Next(map.LowerBound(502))->key, 504u);
+    EXPECT_EQ(map.EqualRange(503).first, map.EqualRange(503).second);
+
+    unsigned int count = 0;
+    map.ForEachInRange(100, 200, [&count](unsigned int key, char& value)
+    {
+        EXPECT_TRUE(key >= 100 && key < 200);
+        value = 'z';
+        count++;
+    });
+    EXPECT_EQ(count, 50u);
+    EXPECT_EQ(map.Get(150), 'z');
+
+    EXPECT_EQ(map.EraseRange(100, 1100), 500u);
+    EXPECT_EQ(map.Size(), 500);
+    EXPECT_FALSE(map.Contains(100));
+    EXPECT_TRUE(map.Contains(98));
+    EXPECT_TRUE(map.Contains(1100));
+}
+
+TEST(MapTest, FromSorted)
+{
+    Vector<unsigned int> keys;
+    Vector<char> values;
+    for (unsigned int key = 0; key < 1000; key++)
+    {
+        keys.PushBack(key * 3);
+        values.PushBack(static_cast<char>('a' + key % 26));
+    }
+
+    MapType map = MapType::FromSorted(keys, values);
+    EXPECT_EQ(map.Size(), 1000);
+    EXPECT_EQ(map.Get(300), 'a' + 100 % 26);
+    EXPECT_FALSE(map.Contains(301));
+    map.Insert(301, 'z');
+    map.Delete(0);
+    EXPECT_EQ(map.LowerBound(0)->key, 3u);
+
+    const std::vector<std::pair<unsigned int, char>> entries = { { 1, 'a' }, { 4, 'b' }, { 9, 'c' } };
+    MapType small = MapType::FromSorted(entries.begin(), entries.end());
+    EXPECT_EQ(small.Size(), 3);
+    EXPECT_EQ(small.Get(9), 'c');
+
+    keys[5] = keys[4];
+    EXPECT_THROW(MapType::FromSorted(keys, values), std::invalid_argument);
+    values.PopBack();
+    EXPECT_THROW(MapType::FromSorted(keys, values), std::invalid_argument);
+}
+
+TEST(MapTest, MergeSplitJoin)
+{
+    MapType a;
+    MapType b;
+    for (unsigned int key = 0; key < 500; key++)
+    {
+        a.Insert(key * 2, 'a');
+        b.Insert(key * 3, 'b');
+    }
+
+    a.Merge(b);
+    EXPECT_EQ(a.Get(0), 'a');
+    EXPECT_EQ(a.Get(3), 'b');
+    EXPECT_EQ(a.Get(6), 'a');
+    EXPECT_EQ(b.Size(), 167);
+    EXPECT_TRUE(b.Contains(6));
+    EXPECT_EQ(a.Size(), 500 + 500 - 167);
+
+    MapType upper = a.Split(700);
+    EXPECT_EQ(a.UpperBound(690)->key, 692u);
+    EXPECT_EQ(a.UpperBound(698)->key, 699u);
+    EXPECT_EQ(a.UpperBound(699), nullptr);
+    EXPECT_EQ(upper.LowerBound(0)->key, 700u);
+    EXPECT_EQ(a.Size() + upper.Size(), 500 + 500 - 167);
+
+    EXPECT_THROW(upper.Join(a), std::invalid_argument);
+    a.Join(upper);
+    EXPECT_TRUE(upper.IsEmpty());
+    EXPECT_EQ(a.Size(), 500 + 500 - 167);
+    EXPECT_EQ(a.Get(1497), 'b');
+
+    for (unsigned int key = 0; key < 1500; key++) a.Delete(key);
+    EXPECT_TRUE(a.IsEmpty());
+}
+
+TEST(MapTest, NodeHandle)
+{
+    MapType active;
+    MapType expired;
+    for (unsigned int key = 0; key < 100; key++) active.Insert(key, 'a');
+
+    for (unsigned int key = 0; key < 100; key += 2)
+    {
+        MapType::NodeType node = active.Extract(key);
+        ASSERT_FALSE(node.IsEmpty());
+        EXPECT_EQ(node.Key(), key);
+        node.Value() = 'e';
+        EXPECT_TRUE(expired.Insert(std::move(node)));
+        EXPECT_TRUE(node.IsEmpty());
+    }
+
+    EXPECT_EQ(active.Size(), 50);
+    EXPECT_EQ(expired.Size(), 50);
+    EXPECT_EQ(expired.Get(10), 'e');
+    EXPECT_FALSE(active.Contains(10));
+    EXPECT_TRUE(active.Extract(10).IsEmpty());
+
+    MapType::NodeType duplicate = active.Extract(11);
+    duplicate.Key() = 12;
+    EXPECT_FALSE(expired.Insert(std::move(duplicate)));
+    EXPECT_FALSE(duplicate.IsEmpty());
+    duplicate.Key() = 1001;
+    EXPECT_TRUE(expired.Insert(std::move(duplicate)));
+    EXPECT_EQ(expired.UpperBound(98)->key, 1001u);
+}
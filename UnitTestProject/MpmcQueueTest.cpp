@@ -0,0 +1,171 @@
+﻿#include <thread>
+#include <gtest/gtest.h>
+
+#include "WSTL/containers/concurrent/MpmcQueue.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+
+TEST(MpmcQueueTest, Capacity)
+{
+    const MpmcQueue<int> a(100);
+    EXPECT_EQ(a.Capacity(), 128);
+    EXPECT_TRUE(a.IsEmpty());
+
+    const MpmcQueue<int> b(64);
+    EXPECT_EQ(b.Capacity(), 64);
+}
+
+TEST(MpmcQueueTest, TryPushPop)
+{
+    MpmcQueue<int> a(4);
+
+    for(int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(a.TryPush(i));
+    }
+    EXPECT_FALSE(a.TryPush(4));
+    EXPECT_EQ(a.Size(), 4);
+
+    int value = -1;
+    for(int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(a.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(a.TryPop(value));
+    EXPECT_TRUE(a.IsEmpty());
+}
+
+TEST(MpmcQueueTest, WrapAround)
+{
+    MpmcQueue<int> a(2);
+    int value = 0;
+
+    for(int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(a.TryPush(i));
+        EXPECT_TRUE(a.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(MpmcQueueTest, NonTrivialValues)
+{
+    MpmcQueue<Vector<int>> a(8);
+    a.Push(Vector<int>{1, 2, 3});
+    EXPECT_TRUE(a.TryEmplace(5, 7));
+
+    EXPECT_EQ(a.Pop().Size(), 3);
+    EXPECT_EQ(a.Pop()[4], 7);
+}
+
+namespace
+{
+    int liveTickets = 0;
+
+    // Neither default constructible nor assignable, only Pop can take it out
+    struct Ticket
+    {
+        const int id;
+
+        explicit Ticket(int id) : id(id) { liveTickets++; }
+        Ticket(Ticket&& other) noexcept : id(other.id) { liveTickets++; }
+        Ticket& operator=(const Ticket&) = delete;
+        ~Ticket() { liveTickets--; }
+    };
+}
+
+TEST(MpmcQueueTest, NonDefaultConstructibleValues)
+{
+    {
+        MpmcQueue<Ticket> a(4);
+        EXPECT_TRUE(a.TryEmplace(1));
+        EXPECT_TRUE(a.TryEmplace(2));
+        EXPECT_TRUE(a.TryEmplace(3));
+        EXPECT_EQ(a.Pop().id, 1);
+        EXPECT_EQ(liveTickets, 2);
+
+        // Wraps around, the destructor destroys the values from the front to the back
+        EXPECT_TRUE(a.TryEmplace(4));
+        EXPECT_TRUE(a.TryEmplace(5));
+        EXPECT_FALSE(a.TryEmplace(6));
+        EXPECT_EQ(liveTickets, 4);
+    }
+    EXPECT_EQ(liveTickets, 0);
+}
+
+namespace
+{
+    // Copies can throw, moves cannot
+    struct Fragile
+    {
+        int value;
+        bool throwOnCopy;
+
+        Fragile(int value, bool throwOnCopy) : value(value), throwOnCopy(throwOnCopy)
+        {
+            if(value < 0) throw std::runtime_error("Fragile: negative value");
+        }
+        Fragile(const Fragile& other) : value(other.value), throwOnCopy(other.throwOnCopy)
+        {
+            if(throwOnCopy) throw std::runtime_error("Fragile: copy");
+        }
+        Fragile(Fragile&& other) noexcept = default;
+        Fragile& operator=(Fragile&& other) noexcept = default;
+    };
+}
+
+TEST(MpmcQueueTest, ThrowingConstructorsLeaveNoClaimedCell)
+{
+    MpmcQueue<Fragile> a(4);
+    const Fragile fragile(1, true);
+
+    EXPECT_THROW(a.TryPush(fragile), std::runtime_error);
+    EXPECT_THROW(a.Push(fragile), std::runtime_error);
+    EXPECT_THROW(a.TryEmplace(-1, false), std::runtime_error);
+    EXPECT_TRUE(a.IsEmpty());
+
+    // A cell claimed by a throwing push would never be published and stall the pops behind it
+    EXPECT_TRUE(a.TryEmplace(2, false));
+    a.Push(Fragile(3, false));
+
+    Fragile value(0, false);
+    EXPECT_TRUE(a.TryPop(value));
+    EXPECT_EQ(value.value, 2);
+    EXPECT_EQ(a.Pop().value, 3);
+    EXPECT_FALSE(a.TryPop(value));
+}
+
+TEST(MpmcQueueTest, BlockingMultiThreaded)
+{
+    constexpr int threadCount = 4;
+    constexpr int perThread = 10000;
+
+    MpmcQueue<int> a(64);
+    std::atomic<long long> sum = 0;
+
+    Vector<std::thread*> threads;
+    for(int t = 0; t < threadCount; t++)
+    {
+        threads.PushBack(new std::thread([&a]
+        {
+            for(int i = 1; i <= perThread; i++) a.Push(i);
+        }));
+        threads.PushBack(new std::thread([&a, &sum]
+        {
+            long long local = 0;
+            for(int i = 0; i < perThread; i++) local += a.Pop();
+            sum += local;
+        }));
+    }
+
+    for(auto pThread : threads)
+    {
+        pThread->join();
+        delete pThread;
+    }
+
+    EXPECT_EQ(sum.load(), static_cast<long long>(threadCount) * perThread * (perThread + 1) / 2);
+    EXPECT_TRUE(a.IsEmpty());
+}
@@ -0,0 +1,184 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "WSTL/algorithms/Parallel.hpp"
+#include "WSTL/containers/Array.hpp"
+#include "WSTL/containers/fixed/FixedVector.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    constexpr Size LargeCount = 200000;
+
+    Vector<int> MakeShuffled(Size count)
+    {
+        Vector<int> values(count);
+        UI32 state = 12345;
+        for(Size i = 0; i < count; i++)
+        {
+            state = state * 1664525u + 1013904223u;
+            values[i] = static_cast<int>(state >> 8) % 100000;
+        }
+        return values;
+    }
+}
+
+TEST(ParallelTest, ForEach)
+{
+    JobSystem jobs(3);
+    Vector<int> values(LargeCount, 1);
+
+    Parallel::ForEach(jobs, values, [](int& value) { value *= 3; });
+
+    for(Size i = 0; i < values.Size(); i++) EXPECT_EQ(values[i], 3);
+}
+
+TEST(ParallelTest, Transform)
+{
+    JobSystem jobs(3);
+    Vector<int> input = MakeShuffled(LargeCount);
+    Vector<long long> output(LargeCount);
+
+    Parallel::Transform(jobs, input, output, [](int value) { return static_cast<long long>(value) * 2; });
+
+    for(Size i = 0; i < input.Size(); i++) EXPECT_EQ(output[i], input[i] * 2LL);
+}
+
+TEST(ParallelTest, Reduce)
+{
+    JobSystem jobs(3);
+    Vector<int> values(LargeCount, 2);
+
+    EXPECT_EQ(Parallel::Reduce(jobs, values, 0LL), static_cast<long long>(LargeCount) * 2);
+    EXPECT_EQ(Parallel::Reduce(jobs, values, 1LL, [](long long a, long long b) { return a > b ? a : b; }), 2);
+
+    Array<int, 4> small = {{1, 2, 3, 4}};
+    EXPECT_EQ(Parallel::Reduce(jobs, small, 0), 10);
+}
+
+TEST(ParallelTest, ReduceWithCombine)
+{
+    JobSystem jobs(3);
+    auto squares = [](long long sum, int value) { return sum + static_cast<long long>(value) * value; };
+
+    // Folding an element differs from merging two sums, the serial and parallel paths must still agree
+    for(const Size count : { Size(100), Size(100000) })
+    {
+        Vector<int> values(count, 3);
+        EXPECT_EQ(Parallel::Reduce(jobs, values, 5LL, 0LL, squares, Plus()), 5 + static_cast<long long>(count) * 9);
+    }
+}
+
+TEST(ParallelTest, InclusiveScan)
+{
+    JobSystem jobs(3);
+    Vector<int> values(LargeCount, 1);
+
+    Parallel::InclusiveScan(jobs, values, values);
+
+    for(Size i = 0; i < values.Size(); i++) EXPECT_EQ(values[i], static_cast<int>(i + 1));
+}
+
+TEST(ParallelTest, Partition)
+{
+    JobSystem jobs(3);
+    Vector<int> values = MakeShuffled(LargeCount);
+
+    Size expected = 0;
+    for(auto value : values) expected += value % 2 == 0 ? 1 : 0;
+
+    const Size boundary = Parallel::Partition(jobs, values, [](int value) { return value % 2 == 0; });
+
+    EXPECT_EQ(boundary, expected);
+    for(Size i = 0; i < values.Size(); i++) EXPECT_EQ(values[i] % 2 == 0, i < boundary);
+}
+
+TEST(ParallelTest, PartitionIsStable)
+{
+    JobSystem jobs(3);
+    auto selected = [](int value) { return (static_cast<UI32>(value) * 2654435761u >> 7) % 3 == 0; };
+
+    // Small ranges take the serial path, large ones the parallel one; both must keep the order of each group
+    for(const Size count : { Size(100), LargeCount })
+    {
+        Vector<int> values(count);
+        for(Size i = 0; i < count; i++) values[i] = static_cast<int>(i);
+
+        const Size boundary = Parallel::Partition(jobs, values, selected);
+        for(Size i = 0; i < count; i++)
+        {
+            EXPECT_EQ(selected(values[i]), i < boundary);
+        }
+        for(Size i = 1; i < count; i++)
+        {
+            if(i != boundary)
+            {
+                EXPECT_LT(values[i - 1], values[i]);
+            }
+        }
+    }
+}
+
+TEST(ParallelTest, PartitionWithoutDefaultConstructor)
+{
+    struct Name
+    {
+        explicit Name(int value) : text(std::to_string(value)) { }
+        std::string text;
+    };
+
+    JobSystem jobs(3);
+    for(const Size count : { Size(100), LargeCount })
+    {
+        std::vector<Name> values;
+        values.reserve(count);
+        for(Size i = 0; i < count; i++) values.emplace_back(static_cast<int>(i));
+
+        Name* first = values.data();
+        Name* boundary = Parallel::Partition(jobs, first, first + count, [](const Name& name)
+        {
+            return (name.text.back() - '0') % 2 == 0;
+        });
+
+        EXPECT_EQ(static_cast<Size>(boundary - first), count / 2);
+        for(Size i = 0; i < count; i++)
+        {
+            EXPECT_EQ(values[i].text, std::to_string(i < count / 2 ? i * 2 : (i - count / 2) * 2 + 1));
+        }
+    }
+}
+
+TEST(ParallelTest, Sort)
+{
+    JobSystem jobs(3);
+    Vector<int> values = MakeShuffled(LargeCount);
+
+    Parallel::Sort(jobs, values);
+    for(Size i = 1; i < values.Size(); i++) EXPECT_LE(values[i - 1], values[i]);
+
+    Parallel::Sort(jobs, values, Greater());
+    for(Size i = 1; i < values.Size(); i++) EXPECT_GE(values[i - 1], values[i]);
+
+    FixedVector<int, 8> small = {5, 3, 8, 1};
+    Parallel::Sort(jobs, small);
+    EXPECT_EQ(small[0], 1);
+    EXPECT_EQ(small[3], 8);
+}
+
+TEST(ParallelTest, SortStrings)
+{
+    JobSystem jobs(3);
+
+    // Strings are moved from while the merges run, so every cut has to be ranked before merging starts
+    for(const Size count : { Size(9000), Size(20000), LargeCount })
+    {
+        Vector<int> keys = MakeShuffled(count);
+        std::vector<std::string> values(count);
+        for(Size i = 0; i < count; i++) values[i] = "value " + std::to_string(keys[i]);
+
+        Parallel::Sort(jobs, values.data(), values.data() + values.size());
+        for(Size i = 1; i < count; i++) EXPECT_LE(values[i - 1], values[i]);
+    }
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <set>
+
 #include "WSTL/containers/trees/RBTree.hpp"
 
 using namespace WSTL;
@@ -113,4 +115,59 @@ TEST(RedBlackTreeTest, Clear)
 
     a.Clear();
     EXPECT_EQ(a.Size(), 0);
-}
\ No newline at end of file
+}
+
+TEST(RedBlackTreeTest, RandomDeletion)
+{
+    RedBlackTreeType a;
+    std::set<unsigned int> expected;
+    unsigned int seed = 11;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const unsigned int key = (seed >> 8) % 2000;
+        if (seed & 0x80000000u)
+        {
+            a.Delete(key);
+            expected.erase(key);
+        }
+        else
+        {
+            a.Insert(key, 'x');
+            expected.insert(key);
+        }
+    }
+
+    ASSERT_EQ(a.Size(), expected.size());
+    const auto keys = a.GetKeys();
+    ASSERT_TRUE(std::equal(keys.Data(), keys.Data() + keys.Size(), expected.begin(), expected.end()));
+}
+
+TEST(RedBlackTreeTest, Bounds)
+{
+    RedBlackTreeType a;
+    for (unsigned int key = 10; key <= 100; key += 10) a.Insert(key, static_cast<char>('a' + key / 10));
+
+    EXPECT_EQ(a.LowerBound(10)->key, 10u);
+    EXPECT_EQ(a.LowerBound(11)->key, 20u);
+    EXPECT_EQ(a.UpperBound(10)->key, 20u);
+    EXPECT_EQ(a.LowerBound(101), nullptr);
+    EXPECT_EQ(a.UpperBound(100), nullptr);
+    EXPECT_EQ(RedBlackTreeType::Previous(a.LowerBound(30))->key, 20u);
+
+    auto range = a.EqualRange(40);
+    EXPECT_EQ(range.first->key, 40u);
+    EXPECT_EQ(range.second->key, 50u);
+    range = a.EqualRange(45);
+    EXPECT_EQ(range.first, range.second);
+
+    unsigned int sum = 0;
+    a.ForEachInRange(25, 60, [&sum](unsigned int key, char) { sum += key; });
+    EXPECT_EQ(sum, 30u + 40u + 50u);
+
+    EXPECT_EQ(a.EraseRange(20, 80), 6u);
+    EXPECT_EQ(a.Size(), 4);
+    EXPECT_EQ(a.LowerBound(11)->key, 80u);
+    EXPECT_EQ(a.EraseRange(0, 1000), 4u);
+    EXPECT_TRUE(a.IsEmpty());
+}
@@ -0,0 +1,122 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+
+#include "WSTL/algorithms/Ranges.hpp"
+#include "WSTL/containers/Array.hpp"
+#include "WSTL/containers/List.hpp"
+#include "WSTL/containers/Set.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+using namespace WSTL::Ranges;
+
+namespace
+{
+    Vector<int> Iota(int count)
+    {
+        Vector<int> values;
+        for(int i = 0; i < count; i++) values.PushBack(i);
+        return values;
+    }
+}
+
+TEST(RangesTest, FilterTransformTake)
+{
+    const Vector<int> values = Iota(100);
+    int calls = 0;
+
+    const Vector<int> result = values
+        | Filter([](int value) { return value % 3 == 0; })
+        | Transform([&calls](int value) { calls++; return value * value; })
+        | Take(4)
+        | Collect<Vector<int>>();
+
+    ASSERT_EQ(result.Size(), 4);
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[3], 81);
+    EXPECT_EQ(calls, 4);
+
+    // A known size reserves exactly
+    const Vector<int> doubled = Collect<Vector>(Transform(values, [](int value) { return value * 2; }));
+    EXPECT_EQ(doubled.Size(), 100);
+    EXPECT_EQ(doubled.Capacity(), 100);
+    EXPECT_EQ(doubled[99], 198);
+
+    const auto taken = Take(values, 500);
+    EXPECT_EQ(taken.Size(), 100);
+
+    // Temporaries are moved into the view
+    int sum = 0;
+    for(const int value : Iota(10) | Filter([](int value) { return value > 6; })) sum += value;
+    EXPECT_EQ(sum, 24);
+}
+
+TEST(RangesTest, ArrayAndList)
+{
+    Array<int, 5> array;
+    for(int i = 0; i < 5; i++) array[i] = i + 1;
+    EXPECT_EQ(Collect<Vector>(array | Transform([](int value) { return value * 10; }))[4], 50);
+
+    List<std::string> names;
+    names.PushBack("ada");
+    names.PushBack("bob");
+    names.PushBack("cyd");
+
+    const Vector<std::string> upper = names
+        | Filter([](const std::string& name) { return name != "bob"; })
+        | Transform([](const std::string& name) { return std::string(1, static_cast<char>(name[0] - 32)) + name.substr(1); })
+        | Collect<Vector>();
+    ASSERT_EQ(upper.Size(), 2);
+    EXPECT_EQ(upper[1], "Cyd");
+
+    const Set<int> set = Collect<Set<int>>(Iota(5) | Transform([](int value) { return value % 3; }));
+    EXPECT_EQ(set.Size(), 3);
+
+    Vector<int> mutated = Iota(4);
+    for(int& value : mutated | Filter([](int value) { return value % 2 == 1; })) value = -value;
+    EXPECT_EQ(mutated[3], -3);
+    EXPECT_EQ(mutated[2], 2);
+}
+
+TEST(RangesTest, ZipEnumerateChunk)
+{
+    const Vector<int> numbers = Iota(7);
+    List<char> letters;
+    for(char letter = 'a'; letter < 'e'; letter++) letters.PushBack(letter);
+
+    std::string zipped;
+    for(const auto [number, letter] : Zip(numbers, letters)) zipped += std::to_string(number) + letter;
+    EXPECT_EQ(zipped, "0a1b2c3d");
+    EXPECT_EQ((numbers | Zip(Iota(3))).Size(), 3);
+
+    ::Size expected = 0;
+    for(const auto [index, letter] : letters | Enumerate())
+    {
+        EXPECT_EQ(index, expected++);
+        EXPECT_EQ(letter, static_cast<char>('a' + index));
+    }
+    EXPECT_EQ(expected, 4);
+
+    const auto chunks = numbers | Chunk(3);
+    EXPECT_EQ(chunks.Size(), 3);
+    Vector<int> sums;
+    for(const auto chunk : chunks)
+    {
+        int sum = 0;
+        for(const int value : chunk) sum += value;
+        sums.PushBack(sum);
+    }
+    ASSERT_EQ(sums.Size(), 3);
+    EXPECT_EQ(sums[0], 3);
+    EXPECT_EQ(sums[1], 12);
+    EXPECT_EQ(sums[2], 6);
+    EXPECT_THROW(Chunk(numbers, 0), std::invalid_argument);
+
+    const Vector<int> evenIndices = numbers
+        | Enumerate()
+        | Filter([](const auto& entry) { return entry.first % 2 == 0; })
+        | Transform([](const auto& entry) { return entry.second; })
+        | Collect<Vector<int>>();
+    EXPECT_EQ(evenIndices.Size(), 4);
+    EXPECT_EQ(evenIndices[3], 6);
+}
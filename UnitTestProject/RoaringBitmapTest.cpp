@@ -0,0 +1,302 @@
+﻿#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+#include "WSTL/containers/RoaringBitmap.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    /**
+     * \brief Random values spread over `chunks` 64K chunks, `perChunk` values each, so the containers end up as
+     * arrays or bitmaps depending on the density
+     */
+    void Fill(RoaringBitmap& bitmap, std::set<UI32>& expected, UI32 chunks, UI32 perChunk, UI32 seed)
+    {
+        for (UI32 chunk = 0; chunk < chunks; chunk++)
+        {
+            for (UI32 i = 0; i < perChunk; i++)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const UI32 value = (chunk * 3) << 16 | (seed >> 16);
+                EXPECT_EQ(bitmap.Add(value), expected.insert(value).second);
+            }
+        }
+    }
+
+    void ExpectEqual(const RoaringBitmap& bitmap, const std::set<UI32>& expected)
+    {
+        ASSERT_EQ(bitmap.Cardinality(), expected.size());
+
+        const Vector<UI32> values = bitmap.ToVector();
+        ASSERT_EQ(values.Size(), expected.size());
+
+        ::Size i = 0;
+        for (const UI32 value : expected)
+        {
+            ASSERT_EQ(values[i++], value);
+            ASSERT_TRUE(bitmap.Contains(value));
+        }
+    }
+}
+
+TEST(RoaringBitmapTest, AddRemoveContains)
+{
+    RoaringBitmap bitmap;
+    EXPECT_TRUE(bitmap.IsEmpty());
+    EXPECT_THROW(bitmap.Minimum(), std::out_of_range);
+
+    std::set<UI32> expected;
+    Fill(bitmap, expected, 4, 100, 1);
+    Fill(bitmap, expected, 4, 20000, 2);
+    ExpectEqual(bitmap, expected);
+
+    EXPECT_EQ(bitmap.Minimum(), *expected.begin());
+    EXPECT_EQ(bitmap.Maximum(), *expected.rbegin());
+    EXPECT_FALSE(bitmap.Contains(1u << 16));
+
+    // Removing from bitmap chunks, they turn back into arrays once they drop below 3072 values
+    ::Size removed = 0;
+    for (auto it = expected.begin(); it != expected.end();)
+    {
+        if (removed++ % 7 != 0) { ++it; continue; }
+        EXPECT_TRUE(bitmap.Remove(*it));
+        EXPECT_FALSE(bitmap.Remove(*it));
+        it = expected.erase(it);
+    }
+    ExpectEqual(bitmap, expected);
+
+    for (const UI32 value : std::vector<UI32>(expected.begin(), expected.end())) bitmap.Remove(value);
+    EXPECT_TRUE(bitmap.IsEmpty());
+
+    RoaringBitmap list = {7, 0xFFFFFFFFu, 3, 7};
+    EXPECT_EQ(list.Cardinality(), 3u);
+    EXPECT_EQ(list.Minimum(), 3u);
+    EXPECT_EQ(list.Maximum(), 0xFFFFFFFFu);
+}
+
+TEST(RoaringBitmapTest, SetOperations)
+{
+    const UI32 densities[] = {50, 3000, 30000};
+    for (const UI32 first : densities)
+    {
+        for (const UI32 second : densities)
+        {
+            RoaringBitmap a, b;
+            std::set<UI32> expectedA, expectedB;
+            Fill(a, expectedA, 5, first, first);
+            Fill(b, expectedB, 3, second, second + 1);
+            b.Add(40u << 16);
+            expectedB.insert(40u << 16);
+
+            std::set<UI32> expectedUnion = expectedA, expectedIntersection, expectedDifference;
+            expectedUnion.insert(expectedB.begin(), expectedB.end());
+            for (const UI32 value : expectedA)
+            {
+                if (expectedB.count(value)) expectedIntersection.insert(value);
+                else expectedDifference.insert(value);
+            }
+
+            ExpectEqual(a | b, expectedUnion);
+            ExpectEqual(a & b, expectedIntersection);
+            ExpectEqual(a - b, expectedDifference);
+            EXPECT_EQ(RoaringBitmap::AndCardinality(a, b), expectedIntersection.size());
+
+            RoaringBitmap c = a;
+            c |= b;
+            EXPECT_TRUE(c == (a | b));
+            c -= a;
+            EXPECT_TRUE(c == (b - a));
+            c &= b;
+            EXPECT_TRUE(c == (b - a));
+            EXPECT_TRUE(a != b);
+        }
+    }
+}
+
+TEST(RoaringBitmapTest, RunOptimize)
+{
+    RoaringBitmap bitmap;
+    std::set<UI32> expected;
+    for (UI32 value = 1000; value < 150000; value++)
+    {
+        bitmap.Add(value);
+        expected.insert(value);
+    }
+    for (UI32 value = 200000; value < 200100; value += 2)
+    {
+        bitmap.Add(value);
+        expected.insert(value);
+    }
+
+    const ::Size before = bitmap.MemoryUsage();
+    EXPECT_TRUE(bitmap.RunOptimize());
+    EXPECT_LT(bitmap.MemoryUsage(), before);
+    ExpectEqual(bitmap, expected);
+    EXPECT_EQ(bitmap.Maximum(), 200098u);
+
+    // Runs are mixed with the other container kinds and modified in place
+    RoaringBitmap sparse = {5, 70000, 140000};
+    ExpectEqual(bitmap & sparse, {70000, 140000});
+    EXPECT_EQ((bitmap | sparse).Cardinality(), expected.size() + 1);
+
+    EXPECT_TRUE(bitmap.Remove(70000));
+    EXPECT_TRUE(bitmap.Add(199999));
+    expected.erase(70000);
+    expected.insert(199999);
+    ExpectEqual(bitmap, expected);
+}
+
+TEST(RoaringBitmapTest, AddToRuns)
+{
+    RoaringBitmap runs;
+    std::set<UI32> expected;
+    for (UI32 value = 100; value < 60000; value++)
+    {
+        if (value == 30000) continue;
+        runs.Add(value);
+        expected.insert(value);
+    }
+    EXPECT_TRUE(runs.RunOptimize());
+    const ::Size asRuns = runs.MemoryUsage();
+
+    // Members are already covered, neighbours extend or join runs, none of it leaves the run container
+    EXPECT_FALSE(runs.Add(100));
+    EXPECT_FALSE(runs.Add(12345));
+    EXPECT_FALSE(runs.Add(59999));
+    EXPECT_EQ(runs.MemoryUsage(), asRuns);
+
+    for (const UI32 value : {99u, 60000u, 30000u})
+    {
+        EXPECT_TRUE(runs.Add(value));
+        expected.insert(value);
+    }
+    EXPECT_LE(runs.MemoryUsage(), asRuns);
+    ExpectEqual(runs, expected);
+
+    // A value away from every run starts a new one
+    EXPECT_TRUE(runs.Add(65000));
+    expected.insert(65000);
+    EXPECT_LT(runs.MemoryUsage(), asRuns + 64);
+    ExpectEqual(runs, expected);
+
+    // Isolated values cost a run each, once the runs outgrow the values they hold the container expands
+    RoaringBitmap sparse;
+    std::set<UI32> sparseExpected;
+    for (UI32 value = 0; value < 100; value++)
+    {
+        sparse.Add(value);
+        sparseExpected.insert(value);
+    }
+    EXPECT_TRUE(sparse.RunOptimize());
+    for (UI32 value = 200; value < 600; value += 2)
+    {
+        EXPECT_TRUE(sparse.Add(value));
+        sparseExpected.insert(value);
+    }
+    EXPECT_FALSE(sparse.RunOptimize());
+    ExpectEqual(sparse, sparseExpected);
+}
+
+TEST(RoaringBitmapTest, ContainerTransitions)
+{
+    constexpr ::Size BitmapBytes = 8192;
+
+    // A chunk around 4096 values stays a bitmap while it hovers there
+    RoaringBitmap bitmap;
+    for (UI32 value = 0; value < 8194; value += 2) bitmap.Add(value);
+    const ::Size asBitmap = bitmap.MemoryUsage();
+    EXPECT_GT(asBitmap, BitmapBytes);
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(bitmap.Remove(4000));
+        EXPECT_TRUE(bitmap.Add(4000));
+    }
+    EXPECT_TRUE(bitmap.Remove(4000));
+    EXPECT_EQ(bitmap.MemoryUsage(), asBitmap);
+
+    // It stays a bitmap down to 3072 values, RunOptimize compacts it before that and Remove below it
+    for (UI32 value = 0; value < 1000; value += 2) bitmap.Remove(value);
+    EXPECT_EQ(bitmap.MemoryUsage(), asBitmap);
+
+    RoaringBitmap shrunk = bitmap;
+    EXPECT_TRUE(shrunk.RunOptimize());
+    EXPECT_LT(shrunk.MemoryUsage(), BitmapBytes);
+    EXPECT_TRUE(shrunk == bitmap);
+
+    for (UI32 value = 1000; value < 2048; value += 2) bitmap.Remove(value);
+    EXPECT_EQ(bitmap.Cardinality(), 3072u);
+    EXPECT_EQ(bitmap.MemoryUsage(), asBitmap);
+
+    EXPECT_TRUE(bitmap.Remove(2048));
+    EXPECT_LT(bitmap.MemoryUsage(), BitmapBytes);
+    EXPECT_TRUE(bitmap.Contains(2050));
+    EXPECT_FALSE(bitmap.Contains(4000));
+
+    // Removing from runs trims or splits them in place
+    RoaringBitmap runs;
+    std::set<UI32> expected;
+    for (UI32 value = 100; value < 60000; value++)
+    {
+        runs.Add(value);
+        expected.insert(value);
+    }
+    EXPECT_TRUE(runs.RunOptimize());
+    const ::Size asRuns = runs.MemoryUsage();
+
+    for (const UI32 value : {100u, 59999u, 30000u, 30001u, 29999u, 500u, 12345u})
+    {
+        EXPECT_TRUE(runs.Remove(value));
+        EXPECT_FALSE(runs.Remove(value));
+        expected.erase(value);
+    }
+    EXPECT_FALSE(runs.Remove(99));
+    EXPECT_FALSE(runs.Remove(60000));
+    EXPECT_LT(runs.MemoryUsage(), asRuns + 64);
+    ExpectEqual(runs, expected);
+
+    // Splitting runs until they outgrow the values expands them
+    for (UI32 value = 101; value < 60000; value += 2)
+    {
+        runs.Remove(value);
+        expected.erase(value);
+    }
+    ExpectEqual(runs, expected);
+    EXPECT_GT(runs.MemoryUsage(), BitmapBytes);
+}
+
+TEST(RoaringBitmapTest, Serialization)
+{
+    RoaringBitmap bitmap;
+    std::set<UI32> expected;
+    Fill(bitmap, expected, 3, 40, 9);
+    Fill(bitmap, expected, 2, 10000, 10);
+    for (UI32 value = 5u << 16; value < (5u << 16) + 5000; value++)
+    {
+        bitmap.Add(value);
+        expected.insert(value);
+    }
+    bitmap.RunOptimize();
+
+    std::vector<UI64> buffer(bitmap.SerializedSize() / sizeof(UI64));
+    ASSERT_EQ(buffer.size() * sizeof(UI64), bitmap.SerializedSize());
+    bitmap.Serialize(buffer.data());
+
+    const FrozenRoaringBitmap frozen(buffer.data(), bitmap.SerializedSize());
+    EXPECT_EQ(frozen.Cardinality(), expected.size());
+    for (const UI32 value : expected) ASSERT_TRUE(frozen.Contains(value));
+    EXPECT_FALSE(frozen.Contains(4u << 16));
+
+    std::vector<UI32> values;
+    frozen.ForEach([&values](UI32 value) { values.push_back(value); });
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+
+    const RoaringBitmap copy(frozen);
+    EXPECT_TRUE(copy == bitmap);
+
+    EXPECT_THROW(FrozenRoaringBitmap(buffer.data(), 4), std::invalid_argument);
+    EXPECT_THROW(FrozenRoaringBitmap(buffer.data(), bitmap.SerializedSize() - 8), std::invalid_argument);
+    buffer[0] = 0;
+    EXPECT_THROW(FrozenRoaringBitmap(buffer.data(), bitmap.SerializedSize()), std::invalid_argument);
+}
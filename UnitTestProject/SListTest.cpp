@@ -157,4 +157,33 @@ TEST(SListTest, Emptiness)
     a.Clear();
 
     EXPECT_TRUE(a.IsEmpty());
-}
\ No newline at end of file
+}
+
+TEST(SListTest, Splice)
+{
+    SList<int> a;
+    SList<int> b;
+    for (int i = 0; i < 5; i++)
+    {
+        a.PushBack(i);
+        b.PushBack(10 + i);
+    }
+
+    a.Splice(2, b, 3, 2);
+    const int expectedA[] = { 0, 1, 13, 14, 2, 3, 4 };
+    for (Size i = 0; i < a.Size(); i++) EXPECT_EQ(a[i], expectedA[i]);
+    EXPECT_EQ(b.Size(), 3);
+    EXPECT_EQ(b.Back(), 12);
+
+    a.Splice(a.Size(), b, 0);
+    EXPECT_EQ(a.Back(), 10);
+    EXPECT_EQ(b.Front(), 11);
+
+    a.Splice(0, b);
+    EXPECT_TRUE(b.IsEmpty());
+    EXPECT_EQ(a.Front(), 11);
+    EXPECT_EQ(a.Size(), 10);
+    b.PushBack(99);
+    EXPECT_EQ(b.Front(), 99);
+    EXPECT_THROW(a.Splice(0, b, 1), std::out_of_range);
+}
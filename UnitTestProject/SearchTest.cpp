@@ -0,0 +1,49 @@
+﻿#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "WSTL/algorithms/Search.hpp"
+
+using namespace WSTL;
+
+TEST(SearchTest, MatchesStandardLibrary)
+{
+    for (Size count : {0, 1, 2, 3, 10, 1000, 5000})
+    {
+        // Every value appears three times, odd values are missing
+        std::vector<int> values(count);
+        for (Size i = 0; i < count; i++) values[i] = static_cast<int>(i / 3) * 2;
+
+        const int* first = values.data();
+        const int* last = values.data() + values.size();
+        for (int value = -2; value < static_cast<int>(count) + 2; value++)
+        {
+            const auto lower = std::lower_bound(values.begin(), values.end(), value) - values.begin();
+            const auto upper = std::upper_bound(values.begin(), values.end(), value) - values.begin();
+
+            ASSERT_EQ(LowerBound(first, last, value) - first, lower);
+            ASSERT_EQ(UpperBound(first, last, value) - first, upper);
+
+            const auto range = EqualRange(first, last, value);
+            ASSERT_EQ(range.first - first, lower);
+            ASSERT_EQ(range.second - first, upper);
+            ASSERT_EQ(BinarySearch(first, last, value), lower != upper);
+        }
+    }
+}
+
+TEST(SearchTest, Compare)
+{
+    std::vector<int> descending = {9, 7, 7, 4, 1};
+    int* first = descending.data();
+    int* last = first + descending.size();
+
+    EXPECT_EQ(LowerBound(first, last, 7, Greater()) - first, 1);
+    EXPECT_EQ(UpperBound(first, last, 7, Greater()) - first, 3);
+    EXPECT_TRUE(BinarySearch(first, last, 4, Greater()));
+    EXPECT_FALSE(BinarySearch(first, last, 5, Greater()));
+
+    // Mutable ranges give mutable results
+    *LowerBound(first, last, 1, Greater()) = 0;
+    EXPECT_EQ(descending.back(), 0);
+}
@@ -4,6 +4,11 @@
 
 typedef WSTL::Set<int> SetType;
 
+// Set nodes hold the key and the links only, the color shares the parent pointer
+static_assert(sizeof(WSTL::Set<UI32>::Node) <= 4 * sizeof(void*), "Set node has grown past its links and key");
+static_assert(sizeof(WSTL::Set<UI64>::Node) < sizeof(WSTL::RBTNode<UI64, bool>),
+              "Set node is no smaller than a RBTree<Key, bool> node");
+
 TEST(SetTest, Constructor)
 {
     const SetType set;
@@ -162,4 +167,75 @@ TEST(SetTest, Contains)
     EXPECT_TRUE(set.Contains(2));
     EXPECT_TRUE(set.Contains(3));
     EXPECT_FALSE(set.Contains(4));
-}
\ No newline at end of file
+}
+
+TEST(SetTest, Range)
+{
+    SetType set;
+    for (int value = -50; value < 50; value++) set.Insert(value * 3);
+
+    EXPECT_EQ(set.LowerBound(-4)->key, -3);
+    EXPECT_EQ(set.UpperBound(0)->key, 3);
+    EXPECT_EQ(set.LowerBound(148), nullptr);
+    EXPECT_EQ(SetType::Next(set.EqualRange(6).first)->key, 9);
+
+    int sum = 0;
+    set.ForEachInRange(-6, 7, [&sum](int value) { sum += value; });
+    EXPECT_EQ(sum, -6 - 3 + 0 + 3 + 6);
+
+    EXPECT_EQ(set.EraseRange(0, 1000), 50u);
+    EXPECT_EQ(set.Size(), 50);
+    EXPECT_EQ(set.Max(), -3);
+}
+
+TEST(SetTest, SetOperations)
+{
+    WSTL::Vector<int> evens;
+    for (int value = 0; value < 100; value += 2) evens.PushBack(value);
+    const SetType a = SetType::FromSorted(evens);
+    SetType b;
+    for (int value = 0; value < 100; value += 3) b.Insert(value);
+
+    const SetType both = a.Intersection(b);
+    EXPECT_EQ(both.Size(), 17);
+    EXPECT_EQ(both.Max(), 96);
+
+    const SetType either = a.Union(b);
+    EXPECT_EQ(either.Size(), 50 + 34 - 17);
+    EXPECT_TRUE(either.Contains(9));
+
+    const SetType onlyA = a.Difference(b);
+    EXPECT_EQ(onlyA.Size(), 50 - 17);
+    EXPECT_FALSE(onlyA.Contains(6));
+    EXPECT_TRUE(onlyA.Contains(4));
+
+    evens[3] = evens[2];
+    EXPECT_THROW(SetType::FromSorted(evens), std::invalid_argument);
+
+    SetType c = either;
+    SetType upper = c.Split(50);
+    EXPECT_EQ(c.Max(), 48);
+    EXPECT_EQ(upper.Min(), 50);
+    c.Join(upper);
+    EXPECT_EQ(c.ToVector().Size(), either.Size());
+}
+
+TEST(SetTest, NodeHandle)
+{
+    SetType a;
+    SetType b;
+    for (int value = 0; value < 10; value++) a.Insert(value);
+
+    SetType::NodeType node = a.Extract(4);
+    EXPECT_EQ(node.Key(), 4);
+    EXPECT_FALSE(a.Contains(4));
+    EXPECT_TRUE(b.Insert(std::move(node)));
+    EXPECT_TRUE(b.Contains(4));
+    EXPECT_TRUE(a.Extract(4).IsEmpty());
+
+    {
+        SetType::NodeType dropped = a.Extract(5);
+        EXPECT_FALSE(dropped.IsEmpty());
+    }
+    EXPECT_EQ(a.Size(), 8);
+}
@@ -0,0 +1,153 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "WSTL/containers/SlotMap.hpp"
+
+using namespace WSTL;
+
+TEST(SlotMapTest, InsertEraseLookup)
+{
+    SlotMap<std::string> map;
+    const SlotHandle a = map.Insert("a");
+    const SlotHandle b = map.Insert(std::string("b"));
+    const SlotHandle c = map.Emplace(3, 'c');
+
+    EXPECT_EQ(map.Size(), 3);
+    EXPECT_EQ(map[a], "a");
+    EXPECT_EQ(map.At(c), "ccc");
+    EXPECT_TRUE(map.Erase(a));
+    EXPECT_FALSE(map.Erase(a));
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_EQ(map.Find(a), nullptr);
+    EXPECT_THROW(map.At(a), std::out_of_range);
+    EXPECT_EQ(map[b], "b");
+    EXPECT_EQ(map[c], "ccc");
+
+    // The freed slot is reused with a new generation, the old handle stays stale
+    const SlotHandle d = map.Insert("d");
+    EXPECT_EQ(d.index, a.index);
+    EXPECT_NE(d.generation, a.generation);
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_EQ(map[d], "d");
+
+    EXPECT_EQ(SlotHandle::FromBits(d.ToBits()), d);
+    EXPECT_FALSE(map.Contains(SlotHandle()));
+
+    map.Clear();
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_FALSE(map.Contains(b));
+    EXPECT_FALSE(map.Contains(d));
+}
+
+TEST(SlotMapTest, MatchesReference)
+{
+    SlotMap<int> map;
+    std::unordered_map<UI64, int> expected;
+    std::vector<SlotHandle> handles;
+    unsigned int seed = 9;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed >> 30) != 0 || handles.empty())
+        {
+            const SlotHandle handle = map.Insert(i);
+            handles.push_back(handle);
+            expected[handle.ToBits()] = i;
+        }
+        else
+        {
+            const Size pick = (seed >> 4) % handles.size();
+            const SlotHandle handle = handles[pick];
+            EXPECT_EQ(map.Erase(handle), expected.erase(handle.ToBits()) == 1);
+        }
+    }
+
+    ASSERT_EQ(map.Size(), expected.size());
+    for (const SlotHandle handle : handles)
+    {
+        const auto found = expected.find(handle.ToBits());
+        ASSERT_EQ(map.Contains(handle), found != expected.end());
+        if (found != expected.end())
+        {
+            ASSERT_EQ(map[handle], found->second);
+        }
+    }
+
+    Size visited = 0;
+    map.ForEach([&](SlotHandle handle, int value)
+    {
+        EXPECT_EQ(expected.at(handle.ToBits()), value);
+        visited++;
+    });
+    EXPECT_EQ(visited, map.Size());
+
+    const SlotMap<int> copy(map);
+    for (const auto& entry : expected) EXPECT_EQ(copy[SlotHandle::FromBits(entry.first)], entry.second);
+}
+
+TEST(SlotMapTest, FreeSlotHandles)
+{
+    SlotMap<int> map;
+    const SlotHandle a = map.Insert(1);
+    const SlotHandle b = map.Insert(2);
+    map.Insert(3);
+    ASSERT_TRUE(map.Erase(a));
+    ASSERT_TRUE(map.Erase(b));
+
+    // A handle carrying the current generation of a free slot must not reach the element that moved into its
+    // old dense position
+    SlotHandle forged = a;
+    forged.generation = a.generation + 1;
+    EXPECT_FALSE(map.Contains(forged));
+    EXPECT_EQ(map.Find(forged), nullptr);
+    EXPECT_FALSE(map.Erase(forged));
+    EXPECT_THROW(map.At(forged), std::out_of_range);
+
+    forged = b;
+    forged.generation = b.generation + 1;
+    EXPECT_FALSE(map.Contains(forged));
+    EXPECT_EQ(map.Size(), 1);
+
+    SlotHandle outOfRange;
+    outOfRange.index = 3;
+    outOfRange.generation = 1;
+    EXPECT_FALSE(map.Contains(outOfRange));
+}
+
+namespace
+{
+    struct Positive
+    {
+        int value;
+
+        explicit Positive(int value) : value(value)
+        {
+            if(value < 0) throw std::invalid_argument("negative");
+        }
+    };
+}
+
+TEST(SlotMapTest, ThrowingConstructor)
+{
+    SlotMap<Positive> map;
+    const SlotHandle a = map.Emplace(1);
+    const SlotHandle b = map.Emplace(2);
+    ASSERT_TRUE(map.Erase(a));
+
+    // Failing on a reused slot and on a new one leaves the map as it was
+    EXPECT_THROW(map.Emplace(-1), std::invalid_argument);
+    const SlotHandle c = map.Emplace(3);
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_THROW(map.Emplace(-1), std::invalid_argument);
+    const SlotHandle d = map.Emplace(4);
+    EXPECT_EQ(d.index, 2u);
+    EXPECT_EQ(map.Size(), 3);
+
+    ASSERT_TRUE(map.Erase(b));
+    ASSERT_TRUE(map.Erase(d));
+    ASSERT_NE(map.Find(c), nullptr);
+    EXPECT_EQ(map.Find(c)->value, 3);
+    EXPECT_EQ(map.Size(), 1);
+}
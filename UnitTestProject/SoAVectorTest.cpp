@@ -0,0 +1,189 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+
+#include "WSTL/containers/SoAVector.hpp"
+
+using namespace WSTL;
+
+TEST(SoAVectorTest, PushBackAndAccess)
+{
+    SoAVector<float, std::string, UI8> vector;
+    for(int i = 0; i < 100; i++) vector.PushBack({ static_cast<float>(i), std::to_string(i), static_cast<UI8>(i) });
+    vector.EmplaceBack(100.0f, "hundred", static_cast<UI8>(100));
+
+    EXPECT_EQ(vector.Size(), 101);
+    EXPECT_GE(vector.Capacity(), 101);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.Data<0>()) % SoAVector<float>::Alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.Data<1>()) % SoAVector<float>::Alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.Data<2>()) % SoAVector<float>::Alignment, 0u);
+
+    EXPECT_EQ(vector.Get<1>(42), "42");
+    EXPECT_EQ(vector.Get<0>(100), 100.0f);
+    EXPECT_THROW(vector.Get<0>(101), std::out_of_range);
+
+    auto [number, name, byte] = vector[7];
+    name = "seven";
+    EXPECT_EQ(number, 7.0f);
+    EXPECT_EQ(byte, 7);
+    EXPECT_EQ(vector.Data<1>()[7], "seven");
+
+    vector.EraseSwap(0);
+    EXPECT_EQ(vector.Size(), 100);
+    EXPECT_EQ(vector.Get<1>(0), "hundred");
+    vector.PopBack();
+    EXPECT_EQ(vector.Get<1>(vector.Size() - 1), "98");
+
+    SoAVector<float, std::string, UI8> copy(vector);
+    vector.Clear();
+    EXPECT_TRUE(vector.IsEmpty());
+    EXPECT_EQ(copy.Size(), 99);
+    EXPECT_EQ(copy.Get<1>(7), "seven");
+
+    vector = std::move(copy);
+    EXPECT_EQ(vector.Size(), 99);
+    vector.Resize(120);
+    EXPECT_EQ(vector.Get<1>(119), "");
+    vector.Resize(10);
+    EXPECT_EQ(vector.Size(), 10);
+}
+
+TEST(SoAVectorTest, ForEach)
+{
+    SoAVector<float, float, int> particles;
+    particles.Reserve(1000);
+    for(int i = 0; i < 1000; i++) particles.PushBack({ 0.0f, static_cast<float>(i), i });
+
+    particles.ForEach<0, 1>([](float& position, float velocity) { position += velocity; });
+    particles.ForEach<2>([](int& id) { id *= 2; });
+
+    float sum = 0.0f;
+    int ids = 0;
+    particles.ForEach([&](float position, float, int id)
+    {
+        sum += position;
+        ids += id;
+    });
+    EXPECT_EQ(sum, 499500.0f);
+    EXPECT_EQ(particles.Field<1>().Size(), 1000);
+    EXPECT_EQ(particles.Field<1>()[999], 999.0f);
+    EXPECT_EQ(ids, 999000);
+}
+
+namespace
+{
+    int liveTrackers = 0;
+
+    struct Tracker
+    {
+        Tracker(int value = 0) : value(value) { liveTrackers++; }
+        Tracker(const Tracker& other) : value(other.value) { liveTrackers++; }
+        ~Tracker() { liveTrackers--; }
+
+        int value;
+    };
+
+    struct Throwing
+    {
+        Throwing(int value)
+        {
+            if(value < 0) throw std::invalid_argument("negative");
+        }
+    };
+
+    int copiesLeft = 0;
+
+    struct CopyLimited
+    {
+        CopyLimited() = default;
+        CopyLimited(const CopyLimited&)
+        {
+            if(copiesLeft-- == 0) throw std::runtime_error("out of copies");
+        }
+        CopyLimited(CopyLimited&&) noexcept = default;
+    };
+
+    int constructionsLeft = 0;
+
+    // Has no move constructor, so growing copies it
+    struct ConstructionLimited
+    {
+        ConstructionLimited() { Spend(); }
+        ConstructionLimited(const ConstructionLimited&) { Spend(); }
+
+        static void Spend()
+        {
+            if(constructionsLeft-- == 0) throw std::runtime_error("out of constructions");
+        }
+    };
+}
+
+TEST(SoAVectorTest, ThrowingFieldConstructor)
+{
+    {
+        SoAVector<Tracker, Tracker, Throwing> vector;
+        vector.EmplaceBack(1, 2, 3);
+        EXPECT_EQ(liveTrackers, 2);
+
+        EXPECT_THROW(vector.EmplaceBack(4, 5, -1), std::invalid_argument);
+        EXPECT_EQ(vector.Size(), 1);
+        EXPECT_EQ(liveTrackers, 2);
+
+        vector.EmplaceBack(6, 7, 8);
+        EXPECT_EQ(vector.Get<1>(1).value, 7);
+        EXPECT_EQ(liveTrackers, 4);
+    }
+    EXPECT_EQ(liveTrackers, 0);
+}
+
+TEST(SoAVectorTest, ThrowingFieldCopy)
+{
+    typedef SoAVector<Tracker, CopyLimited> Records;
+    {
+        Records vector;
+        for(int i = 0; i < 4; i++) vector.EmplaceBack(i, CopyLimited());
+        EXPECT_EQ(liveTrackers, 4);
+
+        // The third record fails on its second field, everything copied before it is destroyed again
+        copiesLeft = 2;
+        EXPECT_THROW(Records copy(vector), std::runtime_error);
+        EXPECT_EQ(liveTrackers, 4);
+
+        copiesLeft = 4;
+        const Records copy(vector);
+        EXPECT_EQ(copy.Size(), 4);
+        EXPECT_EQ(liveTrackers, 8);
+    }
+    EXPECT_EQ(liveTrackers, 0);
+}
+
+TEST(SoAVectorTest, ThrowingGrowth)
+{
+    typedef SoAVector<Tracker, ConstructionLimited> Records;
+    {
+        Records vector;
+        constructionsLeft = 100;
+        for(int i = 0; i < 4; i++) vector.EmplaceBack(i, ConstructionLimited());
+        EXPECT_EQ(vector.Capacity(), 8);
+
+        // The first field moves over, the second fails on its third record
+        constructionsLeft = 2;
+        EXPECT_THROW(vector.Reserve(16), std::runtime_error);
+        EXPECT_EQ(vector.Size(), 4);
+        EXPECT_EQ(vector.Capacity(), 8);
+        EXPECT_EQ(liveTrackers, 4);
+        for(int i = 0; i < 4; i++) EXPECT_EQ(vector.Get<0>(i).value, i);
+
+        constructionsLeft = 2;
+        EXPECT_THROW(vector.Resize(7), std::runtime_error);
+        EXPECT_EQ(vector.Size(), 4);
+        EXPECT_EQ(liveTrackers, 4);
+
+        constructionsLeft = 100;
+        vector.Resize(7);
+        EXPECT_EQ(vector.Size(), 7);
+        EXPECT_EQ(vector.Get<0>(6).value, 0);
+        EXPECT_EQ(liveTrackers, 7);
+    }
+    EXPECT_EQ(liveTrackers, 0);
+}
@@ -0,0 +1,168 @@
+﻿#include <algorithm>
+#include <gtest/gtest.h>
+
+#include "WSTL/algorithms/Sort.hpp"
+#include "WSTL/containers/Array.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    Vector<int> MakeShuffled(Size count, int range)
+    {
+        Vector<int> values(count);
+        UI32 state = 12345;
+        for(Size i = 0; i < count; i++)
+        {
+            state = state * 1664525u + 1013904223u;
+            values[i] = static_cast<int>(state >> 8) % range - range / 2;
+        }
+        return values;
+    }
+
+    struct Record
+    {
+        int key;
+        int order;
+    };
+}
+
+TEST(SortTest, SmallSizes)
+{
+    // Every size the sorting networks and insertion sort handle, with every value pattern of 0s and 1s up to 8
+    for(Size count = 0; count <= 8; count++)
+    {
+        for(UI32 mask = 0; mask < (1u << count); mask++)
+        {
+            Vector<int> values(count);
+            for(Size i = 0; i < count; i++) values[i] = (mask >> i) & 1;
+
+            Sort(values);
+            EXPECT_TRUE(IsSorted(values));
+        }
+    }
+
+    for(Size count = 0; count < 64; count++)
+    {
+        Vector<int> values = MakeShuffled(count, 50);
+        Sort(values);
+        EXPECT_TRUE(IsSorted(values));
+    }
+}
+
+TEST(SortTest, Patterns)
+{
+    constexpr Size count = 100000;
+
+    Vector<int> random = MakeShuffled(count, 1000000);
+    Vector<int> fewUnique = MakeShuffled(count, 4);
+    Vector<int> ascending(count);
+    Vector<int> descending(count);
+    Vector<int> organPipe(count);
+    Vector<int> sawtooth(count);
+    for(Size i = 0; i < count; i++)
+    {
+        ascending[i] = static_cast<int>(i);
+        descending[i] = static_cast<int>(count - i);
+        organPipe[i] = static_cast<int>(i < count / 2 ? i : count - i);
+        sawtooth[i] = static_cast<int>(i % 1000);
+    }
+
+    for(Vector<int>* pValues : {&random, &fewUnique, &ascending, &descending, &organPipe, &sawtooth})
+    {
+        Vector<int> expected = *pValues;
+        std::sort(expected.begin(), expected.end());
+
+        // A custom comparator skips the radix path and goes through the pdqsort
+        Sort(*pValues, [](int a, int b) { return a < b; });
+        for(Size i = 0; i < count; i++) ASSERT_EQ((*pValues)[i], expected[i]);
+    }
+}
+
+TEST(SortTest, CustomCompare)
+{
+    Vector<int> values = MakeShuffled(5000, 1000);
+    Sort(values, Greater());
+    EXPECT_TRUE(IsSorted(values, Greater()));
+
+    // Records go through the partition that branches on every comparison
+    Vector<Record> records(5000);
+    for(Size i = 0; i < records.Size(); i++) records[i] = {static_cast<int>(i * 7919 % 1000), static_cast<int>(i)};
+    Sort(records, [](const Record& a, const Record& b) { return a.key < b.key; });
+    for(Size i = 1; i < records.Size(); i++) ASSERT_LE(records[i - 1].key, records[i].key);
+
+    Array<int, 6> array;
+    for(Size i = 0; i < 6; i++) array[i] = static_cast<int>(i * 7 % 6);
+    Sort(array);
+    for(Size i = 0; i < 6; i++) EXPECT_EQ(array[i], static_cast<int>(i));
+}
+
+TEST(SortTest, RadixSortIntegers)
+{
+    Vector<int> values = MakeShuffled(50000, 2000000);
+    Vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    RadixSort(values);
+    for(Size i = 0; i < values.Size(); i++) ASSERT_EQ(values[i], expected[i]);
+
+    Vector<UI64> wide(1000);
+    for(Size i = 0; i < wide.Size(); i++) wide[i] = (static_cast<UI64>(1000 - i) << 40) | i;
+    RadixSort(wide);
+    EXPECT_TRUE(IsSorted(wide));
+}
+
+TEST(SortTest, RadixSortFloats)
+{
+    Vector<float> values = {3.5f, -1.0f, 0.0f, -0.0f, 1e30f, -1e30f, 2.25f, -2.25f, 1e-30f};
+    RadixSort(values);
+    EXPECT_TRUE(IsSorted(values));
+    EXPECT_EQ(values[0], -1e30f);
+    EXPECT_EQ(values[values.Size() - 1], 1e30f);
+
+    // Large enough for Sort to pick the radix path
+    Vector<double> doubles(10000);
+    for(Size i = 0; i < doubles.Size(); i++) doubles[i] = (i % 2 ? -0.5 : 1.5) * static_cast<double>(i * 7919 % 10007);
+    Sort(doubles);
+    EXPECT_TRUE(IsSorted(doubles));
+}
+
+TEST(SortTest, RadixSortKeyExtractor)
+{
+    Vector<Record> records(1000);
+    for(Size i = 0; i < records.Size(); i++) records[i] = {static_cast<int>(i * 37 % 10) - 5, static_cast<int>(i)};
+
+    RadixSort(records, MemberKey<&Record::key>());
+
+    // Radix sort is stable
+    for(Size i = 1; i < records.Size(); i++)
+    {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if(records[i - 1].key == records[i].key)
+        {
+            ASSERT_LT(records[i - 1].order, records[i].order);
+        }
+    }
+
+    RadixSort(records, [](const Record& record) { return -record.order; });
+    EXPECT_EQ(records[0].order, 999);
+    EXPECT_EQ(records[999].order, 0);
+}
+
+TEST(SortTest, StableSort)
+{
+    Vector<Record> records(3000);
+    for(Size i = 0; i < records.Size(); i++) records[i] = {static_cast<int>(i * 7919 % 31), static_cast<int>(i)};
+
+    StableSort(records, [](const Record& a, const Record& b) { return a.key < b.key; });
+
+    for(Size i = 1; i < records.Size(); i++)
+    {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if(records[i - 1].key == records[i].key)
+        {
+            ASSERT_LT(records[i - 1].order, records[i].order);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+
+#include "WSTL/containers/Array.hpp"
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/Map.hpp"
+#include "WSTL/containers/Set.hpp"
+#include "WSTL/containers/Span.hpp"
+#include "WSTL/containers/StaticIndex.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/containers/fixed/FixedVector.hpp"
+
+using namespace WSTL;
+
+namespace
+{
+    int Sum(Span<const int> values)
+    {
+        int sum = 0;
+        for(const int value : values) sum += value;
+        return sum;
+    }
+
+    Vector<int> MakeVector()
+    {
+        Vector<int> values;
+        for(int i = 0; i < 10; i++) values.PushBack(i * 3);
+        return values;
+    }
+
+    ::Size CountA(StringView text)
+    {
+        ::Size count = 0;
+        for(const char character : text) count += character == 'a';
+        return count;
+    }
+}
+
+TEST(SpanTest, Conversions)
+{
+    Vector<int> vector;
+    for(int i = 1; i <= 10; i++) vector.PushBack(i);
+    Array<int, 4> array;
+    array.Fill(2);
+    FixedVector<int, 8> fixed(3, 5);
+    int raw[3] = { 1, 2, 3 };
+
+    EXPECT_EQ(Sum(vector), 55);
+    EXPECT_EQ(Sum(array), 8);
+    EXPECT_EQ(Sum(fixed), 15);
+    EXPECT_EQ(Sum(raw), 6);
+
+    Span<int> mutableView = vector;
+    mutableView[0] = 100;
+    EXPECT_EQ(vector[0], 100);
+
+    Span<int, 4> fixedExtent = array;
+    static_assert(sizeof(fixedExtent) == sizeof(int*), "a static extent isn't stored");
+    EXPECT_EQ(fixedExtent.Size(), 4);
+    Span<const int> widened = fixedExtent;
+    EXPECT_EQ(widened.SizeBytes(), 16);
+    EXPECT_THROW((Span<int, 3>(vector.Data(), 4)), std::invalid_argument);
+
+    Span deduced = array;
+    static_assert(std::is_same_v<decltype(deduced), Span<int, 4>>);
+
+    const Span<const int> tail = Span<const int>(vector).Last(3);
+    EXPECT_EQ(tail.Front(), 8);
+    EXPECT_EQ(tail.Back(), 10);
+    EXPECT_EQ(Span<const int>(vector).Subspan(2, 2)[1], 4);
+    EXPECT_EQ(Span<const int>(vector).Subspan(8).Size(), 2);
+    EXPECT_EQ((Span<const int>(vector).First<2>()[1]), 2);
+    EXPECT_THROW(Span<const int>(vector).Subspan(11), std::out_of_range);
+    EXPECT_THROW(tail.At(3), std::out_of_range);
+    EXPECT_EQ(AsBytes(tail).Size(), 12);
+    EXPECT_TRUE(Span<int>().IsEmpty());
+}
+
+TEST(SpanTest, Temporaries)
+{
+    EXPECT_EQ(Sum(MakeVector()), 135);
+
+    const Vector<int> constant = MakeVector();
+    Span<const int> view = constant;
+    EXPECT_EQ(view.Size(), 10);
+    static_assert(!std::is_constructible_v<Span<int>, const Vector<int>&>, "const containers only give const spans");
+    static_assert(!std::is_constructible_v<Span<int>, Vector<int>&&>, "temporaries only give const spans");
+
+    const Set<int> set = Set<int>::FromSorted(MakeVector());
+    EXPECT_EQ(set.Size(), 10);
+    EXPECT_TRUE(set.Contains(27));
+
+    const StaticIndex<int> index(MakeVector());
+    EXPECT_EQ(index.Find(12), 4);
+
+    const Map<int, int> map = Map<int, int>::FromSorted(MakeVector(), MakeVector());
+    EXPECT_EQ(map.Size(), 10);
+    EXPECT_EQ(map.Get(9), 9);
+}
+
+TEST(SpanTest, StringView)
+{
+    constexpr StringView literal = "player.health";
+    static_assert(literal.Size() == 13);
+    static_assert(literal.StartsWith("player"));
+    static_assert(literal.Find('.') == 6);
+
+    const std::string owner = "banana";
+    EXPECT_EQ(CountA(owner), 3);
+    EXPECT_EQ(CountA("abracadabra"), 5);
+
+    const StringView view = owner;
+    EXPECT_EQ(view.Substring(1, 3), "ana");
+    EXPECT_EQ(view.Substring(4), "na");
+    EXPECT_EQ(view.Find("na"), 2);
+    EXPECT_EQ(view.Find("na", 3), 4);
+    EXPECT_EQ(view.Find("x"), StringView::NPos);
+    EXPECT_EQ(view.FindLast('b'), 0);
+    EXPECT_TRUE(view.EndsWith("ana"));
+    EXPECT_TRUE(StringView("apple") < view);
+    EXPECT_TRUE(StringView("ban") < view);
+    EXPECT_EQ(view.ToString(), owner);
+    EXPECT_THROW(view.At(6), std::out_of_range);
+    EXPECT_EQ(view.Hash(), HashKey(owner));
+
+    HashMap<StringView, int> counts;
+    counts.Insert("one", 1);
+    counts.Insert(view, 6);
+    EXPECT_EQ(counts.Get(StringView(std::string("banana"))), 6);
+}
+
+TEST(SpanTest, ForEach)
+{
+    Map<int, int> map;
+    Set<int> set;
+    HashMap<int, int> hashMap;
+    for(int i = 0; i < 100; i++)
+    {
+        map.Insert(i, i * 2);
+        set.Insert(i);
+        hashMap.Insert(i, i);
+    }
+
+    int previous = -1;
+    int sum = 0;
+    map.ForEach([&](const int& key, int& value)
+    {
+        EXPECT_LT(previous, key);
+        previous = key;
+        value += 1;
+    });
+    static_cast<const Map<int, int>&>(map).ForEach([&](const int&, const int& value) { sum += value; });
+    EXPECT_EQ(sum, 9900 + 100);
+
+    sum = 0;
+    set.ForEach([&](const int& value) { sum += value; });
+    EXPECT_EQ(sum, 4950);
+
+    sum = 0;
+    hashMap.ForEach([&](const int&, int& value) { sum += value; });
+    EXPECT_EQ(sum, 4950);
+    EXPECT_EQ(hashMap.GetKeys().Size(), 100);
+    EXPECT_EQ(hashMap.GetValues().Size(), 100);
+
+    Vector<int> keys;
+    Vector<int> values;
+    for(int i = 0; i < 10; i++)
+    {
+        keys.PushBack(i);
+        values.PushBack(-i);
+    }
+    const Map<int, int> sorted = Map<int, int>::FromSorted(keys, values);
+    EXPECT_EQ(sorted.Size(), 10);
+}
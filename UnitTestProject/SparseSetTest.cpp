@@ -0,0 +1,139 @@
+﻿#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+
+#include "WSTL/containers/SparseSet.hpp"
+
+using namespace WSTL;
+
+TEST(SparseSetTest, AddRemoveLookup)
+{
+    SparseSet<std::string> set;
+    set.Insert(3, "three");
+    set.Insert(100000, "far");
+    set.Emplace(7, 2, 'x');
+
+    EXPECT_EQ(set.Size(), 3);
+    EXPECT_TRUE(set.Contains(100000));
+    EXPECT_FALSE(set.Contains(4));
+    EXPECT_FALSE(set.Contains(1 << 30));
+    EXPECT_EQ(set[7], "xx");
+    EXPECT_EQ(set.Find(5), nullptr);
+    EXPECT_THROW(set.At(5), std::out_of_range);
+    EXPECT_THROW(set.Insert(3, "again"), std::invalid_argument);
+
+    EXPECT_TRUE(set.Remove(3));
+    EXPECT_FALSE(set.Remove(3));
+    EXPECT_EQ(set.Size(), 2);
+    EXPECT_EQ(set.At(100000), "far");
+    EXPECT_EQ(set.At(7), "xx");
+
+    std::map<UI32, std::string> seen;
+    set.ForEach([&](UI32 entity, const std::string& value) { seen[entity] = value; });
+    EXPECT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[100000], "far");
+
+    SparseSet<std::string> copy(set);
+    set.Clear();
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_FALSE(set.Contains(7));
+    EXPECT_EQ(copy.At(7), "xx");
+
+    std::mt19937 random(5);
+    SparseSet<int> numbers;
+    std::map<UI32, int> reference;
+    for(int i = 0; i < 20000; i++)
+    {
+        const UI32 entity = random() % 50000;
+        if(random() % 3 == 0)
+        {
+            EXPECT_EQ(numbers.Remove(entity), reference.erase(entity) == 1);
+        }
+        else if(reference.find(entity) == reference.end())
+        {
+            numbers.Insert(entity, i);
+            reference[entity] = i;
+        }
+    }
+    ASSERT_EQ(numbers.Size(), reference.size());
+    for(const auto& [entity, value] : reference) EXPECT_EQ(numbers.At(entity), value);
+    for(::Size i = 0; i < numbers.Size(); i++) EXPECT_EQ(numbers.IndexOf(numbers.Entities()[i]), i);
+}
+
+struct Position
+{
+    float x;
+    float y;
+};
+
+struct Velocity
+{
+    float dx;
+    float dy;
+};
+
+TEST(SparseSetTest, Group)
+{
+    SparseGroup<Position, Velocity> group;
+    for(UI32 entity = 0; entity < 100; entity++)
+    {
+        group.Emplace<Position>(entity, Position{ static_cast<float>(entity), 0.0f });
+        if(entity % 2 == 0) group.Emplace<Velocity>(entity, Velocity{ 1.0f, 2.0f });
+    }
+    EXPECT_EQ(group.Size(), 50);
+    EXPECT_EQ(group.Get<Position>().Size(), 100);
+
+    group.Remove<Velocity>(10);
+    group.RemoveAll(20);
+    group.Emplace<Velocity>(11, Velocity{ 1.0f, 2.0f });
+    EXPECT_EQ(group.Size(), 49);
+    EXPECT_TRUE(group.HasAll(11));
+    EXPECT_FALSE(group.Has<Position>(20));
+
+    ::Size visited = 0;
+    group.ForEach([&](UI32 entity, Position& position, Velocity& velocity)
+    {
+        EXPECT_TRUE(entity % 2 == 0 || entity == 11);
+        EXPECT_NE(entity, 10u);
+        EXPECT_EQ(position.x, static_cast<float>(entity));
+        position.x += velocity.dx;
+        visited++;
+    });
+    EXPECT_EQ(visited, 49);
+    EXPECT_EQ(group.Get<Position>().At(12).x, 13.0f);
+    EXPECT_EQ(group.Get<Position>().At(13).x, 13.0f);
+}
+
+namespace
+{
+    struct Positive
+    {
+        int value;
+
+        explicit Positive(int value) : value(value)
+        {
+            if(value < 0) throw std::invalid_argument("negative");
+        }
+    };
+}
+
+TEST(SparseSetTest, ThrowingConstructor)
+{
+    SparseSet<Positive> set;
+    set.Emplace(4, 1);
+    set.Emplace(9, 2);
+
+    EXPECT_THROW(set.Emplace(7, -1), std::invalid_argument);
+    EXPECT_FALSE(set.Contains(7));
+    EXPECT_EQ(set.Size(), 2);
+
+    // Removing the last element still finds its entity where the values are
+    ASSERT_TRUE(set.Remove(9));
+    ASSERT_TRUE(set.Remove(4));
+    EXPECT_EQ(set.Size(), 0);
+
+    set.Emplace(7, 3);
+    ASSERT_NE(set.Find(7), nullptr);
+    EXPECT_EQ(set.Find(7)->value, 3);
+}
@@ -0,0 +1,116 @@
+﻿#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include "WSTL/containers/StaticIndex.hpp"
+
+using namespace WSTL;
+
+TEST(StaticIndexTest, MatchesLowerBound)
+{
+    for (Size count : {0u, 1u, 2u, 3u, 7u, 8u, 9u, 100u, 1023u, 1024u, 1025u, 5000u})
+    {
+        Vector<UI32> keys;
+        for (Size i = 0; i < count; i++) keys.PushBack(static_cast<UI32>(i * 3 + 1));
+
+        const StaticIndex<UI32> index(keys);
+        ASSERT_EQ(index.Size(), count);
+
+        const UI32* pBegin = keys.Data();
+        const UI32* pEnd = keys.Data() + keys.Size();
+        for (UI32 key = 0; key < count * 3 + 3; key++)
+        {
+            const Size expected = static_cast<Size>(std::lower_bound(pBegin, pEnd, key) - pBegin);
+            ASSERT_EQ(index.LowerBound(key), expected);
+            ASSERT_EQ(index.Find(key), key % 3 == 1 && key < count * 3 ? expected : count);
+            ASSERT_EQ(index.Contains(key), key % 3 == 1 && key < count * 3);
+        }
+
+        for (Size rank = 0; rank < count; rank++) ASSERT_EQ(index.KeyAtRank(rank), keys[rank]);
+        EXPECT_THROW((void)index.KeyAtRank(count), std::out_of_range);
+    }
+}
+
+TEST(StaticIndexTest, Duplicates)
+{
+    const int sorted[] = { 1, 2, 2, 2, 5, 5, 9 };
+    const StaticIndex<int> index(sorted, 7);
+
+    EXPECT_EQ(index.LowerBound(2), 1u);
+    EXPECT_EQ(index.LowerBound(5), 4u);
+    EXPECT_EQ(index.Find(2), 1u);
+    EXPECT_EQ(index.Find(3), 7u);
+    EXPECT_EQ(index.LowerBound(10), 7u);
+
+    const int unsorted[] = { 3, 1 };
+    EXPECT_THROW((StaticIndex<int>(unsorted, 2)), std::invalid_argument);
+}
+
+TEST(StaticIndexTest, BatchQueries)
+{
+    Set<int> set;
+    std::vector<int> expected;
+    UI32 seed = 7;
+    for (int i = 0; i < 3000; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        set.Insert(static_cast<int>(seed >> 12));
+    }
+    const Vector<int> keys = set.GetKeys();
+    for (Size i = 0; i < keys.Size(); i++) expected.push_back(keys[i]);
+
+    const StaticIndex<int> index(set);
+    ASSERT_EQ(index.Size(), expected.size());
+
+    std::vector<int> queries;
+    for (Size i = 0; i < 1001; i++) queries.push_back(i % 2 == 0 ? expected[(i * 7) % expected.size()] : static_cast<int>(i * 1237));
+
+    std::vector<Size> found(queries.size());
+    std::vector<Size> lower(queries.size());
+    index.BatchFind(queries.data(), queries.size(), found.data());
+    index.BatchLowerBound(queries.data(), queries.size(), lower.data());
+    for (Size i = 0; i < queries.size(); i++)
+    {
+        ASSERT_EQ(found[i], index.Find(queries[i]));
+        ASSERT_EQ(lower[i], static_cast<Size>(std::lower_bound(expected.begin(), expected.end(), queries[i]) - expected.begin()));
+    }
+
+    StaticIndex<int> copy(index);
+    StaticIndex<int> moved(std::move(copy));
+    EXPECT_TRUE(copy.IsEmpty());
+    EXPECT_EQ(moved.Find(expected[5]), 5u);
+    EXPECT_EQ(copy.LowerBound(3), 0u);
+}
+
+TEST(StaticIndexTest, Move)
+{
+    Vector<int> keys;
+    for (int i = 0; i < 100; i++) keys.PushBack(i * 2);
+    const int queries[] = {10, 20, 11, 500};
+
+    StaticIndex<int> source(keys);
+    StaticIndex<int> moved(std::move(source));
+    EXPECT_EQ(source.Size(), 0u);
+
+    Size found[4];
+    Size lower[4];
+    moved.BatchFind(queries, 4, found);
+    moved.BatchLowerBound(queries, 4, lower);
+    EXPECT_EQ(moved.Find(20), 10u);
+    EXPECT_EQ(found[0], 5u);
+    EXPECT_EQ(found[1], 10u);
+    EXPECT_EQ(found[2], 100u);
+    EXPECT_EQ(found[3], 100u);
+    EXPECT_EQ(lower[2], 6u);
+    EXPECT_EQ(lower[3], 100u);
+
+    // The source is empty, batches on it find nothing
+    source.BatchFind(queries, 4, found);
+    EXPECT_EQ(found[0], 0u);
+
+    StaticIndex<int> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(moved.Size(), 0u);
+    assigned.BatchLowerBound(queries, 4, lower);
+    EXPECT_EQ(lower[0], 5u);
+}
@@ -0,0 +1,100 @@
+﻿#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/StringPool.hpp"
+#include "WSTL/containers/StringView.hpp"
+
+using namespace WSTL;
+
+TEST(StringPoolTest, InternAndResolve)
+{
+    StringPool pool;
+    EXPECT_EQ(pool.Size(), 1u);
+    EXPECT_EQ(sizeof(InternedString), 8u);
+
+    // The default handle is the empty string every pool starts with
+    const InternedString empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ(pool.Intern(""), empty);
+    EXPECT_EQ(pool.Intern("").Hash(), empty.Hash());
+    EXPECT_STREQ(pool.CStr(empty), "");
+
+    const InternedString health = pool.Intern("player.health");
+    const std::string text = "player.health";
+    EXPECT_EQ(pool.Intern(StringView(text)), health);
+    EXPECT_EQ(pool.Intern(StringView(text)).Handle(), health.Handle());
+    EXPECT_EQ(health.Hash(), StringView("player.health").Hash());
+    EXPECT_EQ(pool.View(health), "player.health");
+    EXPECT_STREQ(pool.CStr(health), "player.health");
+
+    const InternedString mana = pool.Intern("player.mana");
+    EXPECT_NE(mana, health);
+    EXPECT_EQ(pool.Size(), 3u);
+
+    EXPECT_TRUE(pool.Find("player.mana").HasValue());
+    EXPECT_EQ(pool.Find("player.mana").Value(), mana);
+    EXPECT_FALSE(pool.Find("player.stamina").HasValue());
+    EXPECT_EQ(pool.Size(), 3u);
+
+    StringPool other;
+    EXPECT_THROW(other.View(mana), std::out_of_range);
+
+    // Enough strings to fill several chunks
+    std::vector<InternedString> handles;
+    for(int i = 0; i < 5000; i++) handles.push_back(pool.Intern(StringView(("asset/" + std::to_string(i)).c_str())));
+    for(int i = 0; i < 5000; i++)
+    {
+        EXPECT_EQ(pool.View(handles[i]), StringView(("asset/" + std::to_string(i)).c_str()));
+        EXPECT_EQ(pool.Intern(StringView(("asset/" + std::to_string(i)).c_str())), handles[i]);
+    }
+    EXPECT_EQ(pool.Size(), 5003u);
+
+    HashMap<InternedString, int> map;
+    for(int i = 0; i < 5000; i++) map.Insert(handles[i], i);
+    for(int i = 0; i < 5000; i++) EXPECT_EQ(map.Get(handles[i]), i);
+    EXPECT_FALSE(map.Contains(health));
+}
+
+TEST(StringPoolTest, ConcurrentIntern)
+{
+    constexpr int ThreadCount = 4;
+    constexpr int Count = 2000;
+
+    StringPool pool;
+    const InternedString first = pool.Intern("tag.0");
+    std::vector<std::vector<InternedString>> results(ThreadCount);
+    std::atomic<bool> mismatch = false;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < ThreadCount; t++)
+    {
+        threads.emplace_back([&, t]
+        {
+            for(int i = 0; i < Count; i++)
+            {
+                const std::string text = "tag." + std::to_string((i * 7 + t) % Count);
+                results[t].push_back(pool.Intern(StringView(text)));
+
+                // Reads don't lock and run alongside the other threads' interning
+                if(pool.View(results[t].back()) != StringView(text)) mismatch = true;
+                if(pool.View(first) != "tag.0") mismatch = true;
+            }
+        });
+    }
+    for(std::thread& thread : threads) thread.join();
+
+    EXPECT_FALSE(mismatch);
+    EXPECT_EQ(pool.Size(), static_cast<::Size>(Count + 1));
+    for(int t = 0; t < ThreadCount; t++)
+    {
+        for(int i = 0; i < Count; i++)
+        {
+            const std::string text = "tag." + std::to_string((i * 7 + t) % Count);
+            EXPECT_EQ(results[t][i], pool.Find(StringView(text)).Value());
+        }
+    }
+}
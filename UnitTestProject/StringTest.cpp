@@ -0,0 +1,171 @@
+﻿#include <gtest/gtest.h>
+#include <string>
+
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/String.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/memory/Arena.hpp"
+
+using namespace WSTL;
+
+TEST(StringTest, SmallAndHeapStorage)
+{
+    EXPECT_EQ(sizeof(String), 32u);
+
+    String empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_TRUE(empty.IsInline());
+    EXPECT_STREQ(empty.CStr(), "");
+
+    String inlined("player.position.x.axis");
+    EXPECT_EQ(inlined.Size(), 22u);
+    EXPECT_TRUE(inlined.IsInline());
+
+    inlined.PushBack('!');
+    EXPECT_EQ(inlined.Size(), String::InlineCapacity);
+    EXPECT_TRUE(inlined.IsInline());
+    EXPECT_STREQ(inlined.CStr(), "player.position.x.axis!");
+
+    inlined.PushBack('?');
+    EXPECT_FALSE(inlined.IsInline());
+    EXPECT_STREQ(inlined.CStr(), "player.position.x.axis!?");
+    EXPECT_GE(inlined.Capacity(), 24u);
+
+    // Appending a string to itself reads the old buffer while growing
+    String twice("abcdefghijklmnop");
+    twice.Append(twice);
+    EXPECT_EQ(twice, "abcdefghijklmnopabcdefghijklmnop");
+    twice.Append(StringView(twice).Substring(0, 4));
+    EXPECT_EQ(twice.Size(), 36u);
+    EXPECT_TRUE(twice.EndsWith("abcd"));
+
+    // Moving and swapping carry all 23 inline characters, and the mode, whatever the word size
+    String full("abcdefghijklmnopqrstuvw");
+    String movedFull(std::move(full));
+    EXPECT_TRUE(movedFull.IsInline());
+    EXPECT_STREQ(movedFull.CStr(), "abcdefghijklmnopqrstuvw");
+    EXPECT_TRUE(full.IsEmpty());
+    movedFull.Swap(twice);
+    EXPECT_FALSE(movedFull.IsInline());
+    EXPECT_TRUE(twice.IsInline());
+    EXPECT_STREQ(twice.CStr(), "abcdefghijklmnopqrstuvw");
+    movedFull.Swap(twice);
+    EXPECT_EQ(twice.Size(), 36u);
+
+    String copy(twice);
+    EXPECT_EQ(copy, twice);
+    String moved(std::move(copy));
+    EXPECT_EQ(moved, twice);
+    EXPECT_TRUE(copy.IsEmpty());
+
+    String assigned = "short";
+    assigned = twice;
+    EXPECT_EQ(assigned, twice);
+    assigned = "short again";
+    EXPECT_EQ(assigned, "short again");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned, twice);
+
+    String resized("ab");
+    resized.Resize(30, 'x');
+    EXPECT_EQ(resized.Size(), 30u);
+    EXPECT_EQ(resized[29], 'x');
+    resized.Resize(1);
+    EXPECT_EQ(resized, "a");
+    resized.PopBack();
+    EXPECT_THROW(resized.PopBack(), std::out_of_range);
+    EXPECT_THROW(resized.At(0), std::out_of_range);
+
+    const String joined = String("key.") + "value";
+    EXPECT_EQ(joined, "key.value");
+    EXPECT_EQ(joined.Substring(4), "value");
+    EXPECT_EQ(joined.Find('.'), 3u);
+    EXPECT_EQ(joined.ToStdString(), std::string("key.value"));
+    EXPECT_TRUE(String("a") < String("b"));
+    EXPECT_THROW(joined.Substring(10), std::out_of_range);
+}
+
+TEST(StringTest, HashAndHashMap)
+{
+    const std::string text = "enemy.spawn.rate";
+    String key(text);
+    EXPECT_EQ(key.Hash(), StringView(text).Hash());
+    EXPECT_EQ(key.Hash(), HashKey(text));
+
+    // The cached hash is dropped whenever the characters change
+    key.PushBack('s');
+    EXPECT_EQ(key.Hash(), StringView("enemy.spawn.rates").Hash());
+    key[0] = 'E';
+    EXPECT_EQ(key.Hash(), StringView("Enemy.spawn.rates").Hash());
+
+    HashMap<String, int> map;
+    for(int i = 0; i < 100; i++) map.Insert(String(("key." + std::to_string(i)).c_str()), i);
+    EXPECT_EQ(map.Size(), 100u);
+    for(int i = 0; i < 100; i++) EXPECT_EQ(map.Get(String(("key." + std::to_string(i)).c_str())), i);
+    EXPECT_FALSE(map.Contains("key.100"));
+}
+
+TEST(StringTest, EqualityIgnoresCachedHash)
+{
+    String a("x.value");
+    const String b("y.value");
+
+    // The reference outlives the Hash call, so writing through it leaves a's cached hash stale
+    char& first = a[0];
+    a.Hash();
+    b.Hash();
+    first = 'y';
+
+    EXPECT_TRUE(a.View() == b.View());
+    EXPECT_TRUE(a == b);
+}
+
+TEST(StringTest, Arena)
+{
+    Arena arena(256);
+    EXPECT_EQ(arena.Capacity(), 0u);
+
+    int* pValues = arena.Allocate<int>(10);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pValues) % alignof(int), 0u);
+    double* pDouble = arena.New<double>(2.5);
+    EXPECT_EQ(*pDouble, 2.5);
+    void* pAligned = arena.Allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pAligned) % 64, 0u);
+
+    // Larger than a block, gets a block of its own
+    Byte* pLarge = arena.Allocate<Byte>(1000);
+    pLarge[999] = 1;
+    EXPECT_GE(arena.Capacity(), 1256u);
+
+    const ::Size capacity = arena.Capacity();
+    arena.Reset();
+    EXPECT_EQ(arena.BytesUsed(), 0u);
+    arena.Allocate<Byte>(100);
+    arena.Allocate<Byte>(1000);
+    EXPECT_EQ(arena.Capacity(), capacity);
+
+    {
+        ArenaString shortString("inline", ArenaStringAllocator(arena));
+        EXPECT_TRUE(shortString.IsInline());
+
+        const ::Size used = arena.BytesUsed();
+        ArenaString longString("a string too long to be stored inline", ArenaStringAllocator(arena));
+        EXPECT_FALSE(longString.IsInline());
+        EXPECT_GT(arena.BytesUsed(), used);
+        EXPECT_EQ(longString.GetAllocator().GetArena(), &arena);
+
+        ArenaString copy(longString);
+        EXPECT_EQ(copy, longString);
+        EXPECT_EQ(copy.GetAllocator().GetArena(), &arena);
+    }
+
+    // Without an arena the characters come from the heap
+    ArenaString heapString("a string too long to be stored inline");
+    EXPECT_EQ(heapString.GetAllocator().GetArena(), nullptr);
+    EXPECT_EQ(heapString, "a string too long to be stored inline");
+
+    const ::Size finalCapacity = arena.Capacity();
+    Arena moved(std::move(arena));
+    EXPECT_EQ(arena.Capacity(), 0u);
+    EXPECT_EQ(moved.Capacity(), finalCapacity);
+}
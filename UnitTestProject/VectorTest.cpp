@@ -275,6 +275,73 @@ TEST(VectorTest, Resize)
     }
 }
 
+TEST(VectorTest, ResizeEmpty)
+{
+    Vector<int> a;
+    a.Resize(10);
+    EXPECT_EQ(a.Size(), 10);
+    EXPECT_GE(a.Capacity(), 10);
+    for(int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(a[i], 0);
+    }
+
+    Vector<int> b;
+    b.Resize(10, 7);
+    EXPECT_EQ(b.Size(), 10);
+    EXPECT_GE(b.Capacity(), 10);
+    for(int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(b[i], 7);
+    }
+}
+
+TEST(VectorTest, ResizePastCapacity)
+{
+    Vector<int> a = {1, 2, 3, 4, 5};
+    a.SetCapacity(8);
+    a.Resize(8);
+    EXPECT_EQ(a.Capacity(), 8);
+
+    a.Resize(40, 9);
+    EXPECT_EQ(a.Size(), 40);
+    EXPECT_GE(a.Capacity(), 40);
+    for(int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(a[i], i + 1);
+    }
+    for(int i = 5; i < 8; i++)
+    {
+        EXPECT_EQ(a[i], 0);
+    }
+    for(int i = 8; i < 40; i++)
+    {
+        EXPECT_EQ(a[i], 9);
+    }
+}
+
+TEST(VectorTest, InsertShiftsForward)
+{
+    Vector<int> a = {1, 2, 3, 4, 5};
+    a.SetCapacity(16);
+    a.Insert(1, 3, 0);
+    const int expected[] = {1, 0, 0, 0, 2, 3, 4, 5};
+    ASSERT_EQ(a.Size(), 8);
+    for(int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(a[i], expected[i]);
+    }
+
+    a.Insert(0, {7, 8});
+    ASSERT_EQ(a.Size(), 10);
+    EXPECT_EQ(a[0], 7);
+    EXPECT_EQ(a[1], 8);
+    for(int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(a[i + 2], expected[i]);
+    }
+}
+
 TEST(VectorTest, SetCapacity)
 {
     Vector<int> a = {1, 2, 3, 4, 5};
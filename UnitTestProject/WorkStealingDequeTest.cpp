@@ -0,0 +1,81 @@
+﻿#include <thread>
+#include <gtest/gtest.h>
+
+#include "WSTL/containers/concurrent/WorkStealingDeque.hpp"
+
+using namespace WSTL;
+
+TEST(WorkStealingDequeTest, PushPop)
+{
+    WorkStealingDeque<int> a(4);
+    EXPECT_TRUE(a.IsEmpty());
+
+    a.Push(1);
+    a.Push(2);
+    a.Push(3);
+    EXPECT_EQ(a.Size(), 3);
+
+    int value = 0;
+    EXPECT_TRUE(a.Pop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_TRUE(a.Steal(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(a.Pop(value));
+    EXPECT_EQ(value, 2);
+
+    EXPECT_FALSE(a.Pop(value));
+    EXPECT_FALSE(a.Steal(value));
+}
+
+TEST(WorkStealingDequeTest, Grow)
+{
+    WorkStealingDeque<int> a(2);
+
+    for(int i = 0; i < 100; i++) a.Push(i);
+    EXPECT_EQ(a.Size(), 100);
+    EXPECT_GE(a.Capacity(), 100);
+
+    int value = 0;
+    for(int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(a.Steal(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(WorkStealingDequeTest, ConcurrentSteal)
+{
+    constexpr int count = 100000;
+    WorkStealingDeque<int> a(64);
+    std::atomic<long long> stolen = 0;
+    std::atomic<bool> done = false;
+
+    std::thread thieves[3];
+    for(auto& thief : thieves)
+    {
+        thief = std::thread([&]
+        {
+            long long local = 0;
+            int value = 0;
+            while(!done.load() || !a.IsEmpty())
+            {
+                if(a.Steal(value)) local += value;
+            }
+            stolen += local;
+        });
+    }
+
+    long long popped = 0;
+    int value = 0;
+    for(int i = 1; i <= count; i++)
+    {
+        a.Push(i);
+        if(i % 3 == 0 && a.Pop(value)) popped += value;
+    }
+    while(a.Pop(value)) popped += value;
+    done = true;
+
+    for(auto& thief : thieves) thief.join();
+
+    EXPECT_EQ(popped + stolen.load(), static_cast<long long>(count) * (count + 1) / 2);
+}
@@ -4,4 +4,6 @@
 #include "WSTL/utility/Utility.hpp"
 #include "WSTL/containers/Containers.hpp"
 #include "WSTL/memory/Memory.hpp"
-#include "WSTL/memory/SmartPointers.hpp"
\ No newline at end of file
+#include "WSTL/memory/SmartPointers.hpp"
+#include "WSTL/threading/Threading.hpp"
+#include "WSTL/algorithms/Algorithms.hpp"
\ No newline at end of file
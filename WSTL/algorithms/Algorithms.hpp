@@ -0,0 +1,6 @@
+#pragma once
+
+#include "WSTL/algorithms/Sort.hpp"
+#include "WSTL/algorithms/Search.hpp"
+#include "WSTL/algorithms/Parallel.hpp"
+#include "WSTL/algorithms/Ranges.hpp"
@@ -0,0 +1,486 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/algorithms/Sort.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/threading/JobSystem.hpp"
+#include "WSTL/utility/Functional.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+namespace WSTL::Parallel
+{
+    /**
+     * \brief Smallest amount of elements a job is given, below twice this the algorithms run serially
+     */
+    constexpr Size MinGrainSize = 4096;
+
+    /**
+     * \brief Returns how many elements each job should process, aiming for several chunks per thread
+     */
+    inline Size GrainSize(const JobSystem& jobs, Size count) noexcept
+    {
+        const Size grainSize = count / (jobs.ThreadCount() * 8);
+        return grainSize < MinGrainSize ? MinGrainSize : grainSize;
+    }
+
+    /**
+     * \brief Returns if the range is too small, or the pool too narrow, for splitting to pay off
+     */
+    inline bool RunSerially(const JobSystem& jobs, Size count) noexcept
+    {
+        return jobs.ThreadCount() == 1 || count < MinGrainSize * 2;
+    }
+
+    /**
+     * \brief Calls `function(element)` for every element of [first, last)
+     */
+    template<typename T, class F>
+    void ForEach(JobSystem& jobs, T* first, T* last, F&& function)
+    {
+        const Size count = last - first;
+        if(RunSerially(jobs, count))
+        {
+            for(; first != last; ++first) function(*first);
+            return;
+        }
+
+        jobs.ParallelForRange(count, [first, &function](Size begin, Size end)
+        {
+            for(Size i = begin; i < end; i++) function(first[i]);
+        }, GrainSize(jobs, count));
+    }
+
+    /**
+     * \brief Writes `function(input[i])` to `output[i]` for every element of [first, last). Output may alias input
+     */
+    template<typename T, typename U, class F>
+    void Transform(JobSystem& jobs, const T* first, const T* last, U* output, F&& function)
+    {
+        const Size count = last - first;
+        if(RunSerially(jobs, count))
+        {
+            for(Size i = 0; i < count; i++) output[i] = function(first[i]);
+            return;
+        }
+
+        jobs.ParallelForRange(count, [first, output, &function](Size begin, Size end)
+        {
+            for(Size i = begin; i < end; i++) output[i] = function(first[i]);
+        }, GrainSize(jobs, count));
+    }
+
+    /**
+     * \brief Folds [first, last) into `init` with `operation(Result, element)`. Every chunk is folded on its own
+     * starting from `identity`, and the chunk results are merged into `init` with `combine(Result, Result)`, which has
+     * to be associative with `identity` as its identity. Use this overload when folding an element differs from
+     * merging two results, e.g. a sum of squares folds with `acc + x * x` but merges with `Plus`
+     */
+    template<typename T, typename Result, class Operation, class Combine>
+    Result Reduce(JobSystem& jobs, const T* first, const T* last, Result init, Result identity, Operation operation,
+                  Combine combine)
+    {
+        const Size count = last - first;
+        if(RunSerially(jobs, count))
+        {
+            for(; first != last; ++first) init = operation(init, *first);
+            return init;
+        }
+
+        const Size grainSize = GrainSize(jobs, count);
+        const Size chunkCount = (count + grainSize - 1) / grainSize;
+        Vector<Result> partials(chunkCount);
+
+        jobs.ParallelForRange(chunkCount, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk; chunk < lastChunk; chunk++)
+            {
+                const Size begin = chunk * grainSize;
+                const Size end = begin + grainSize < count ? begin + grainSize : count;
+
+                Result partial = identity;
+                for(Size i = begin; i < end; i++) partial = operation(partial, first[i]);
+                partials[chunk] = std::move(partial);
+            }
+        }, 1);
+
+        for(Size chunk = 0; chunk < chunkCount; chunk++) init = combine(init, partials[chunk]);
+        return init;
+    }
+
+    /**
+     * \brief Folds [first, last) into `init` with `operation`, which has to be associative and has to treat an element
+     * like the Result it converts to: chunks are seeded with their first element and merged with `operation` too.
+     * Folds that do something else with each element need the overload taking an identity and a combine operation
+     */
+    template<typename T, typename Result, class Operation = Plus>
+    Result Reduce(JobSystem& jobs, const T* first, const T* last, Result init, Operation operation = Operation())
+    {
+        static_assert(std::is_convertible_v<const T&, Result>, "Parallel::Reduce seeds chunks with their first element");
+        static_assert(std::is_invocable_v<Operation&, const Result&, const Result&>,
+                      "Parallel::Reduce merges chunk results with the operation");
+
+        const Size count = last - first;
+        if(RunSerially(jobs, count))
+        {
+            for(; first != last; ++first) init = operation(init, *first);
+            return init;
+        }
+
+        const Size grainSize = GrainSize(jobs, count);
+        const Size chunkCount = (count + grainSize - 1) / grainSize;
+        Vector<Result> partials(chunkCount);
+
+        jobs.ParallelForRange(chunkCount, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk; chunk < lastChunk; chunk++)
+            {
+                const Size begin = chunk * grainSize;
+                const Size end = begin + grainSize < count ? begin + grainSize : count;
+
+                Result partial = static_cast<Result>(first[begin]);
+                for(Size i = begin + 1; i < end; i++) partial = operation(partial, first[i]);
+                partials[chunk] = std::move(partial);
+            }
+        }, 1);
+
+        for(Size chunk = 0; chunk < chunkCount; chunk++) init = operation(init, partials[chunk]);
+        return init;
+    }
+
+    /**
+     * \brief Writes the running fold of [first, last) to `output`, `operation` has to be associative. Output may
+     * alias input
+     */
+    template<typename T, typename U, class Operation = Plus>
+    void InclusiveScan(JobSystem& jobs, const T* first, const T* last, U* output, Operation operation = Operation())
+    {
+        const Size count = last - first;
+        if(count == 0) return;
+
+        if(RunSerially(jobs, count))
+        {
+            U running = first[0];
+            output[0] = running;
+            for(Size i = 1; i < count; i++)
+            {
+                running = operation(running, first[i]);
+                output[i] = running;
+            }
+            return;
+        }
+
+        // Pass one scans each chunk on its own, pass two adds the total of every chunk before it
+        const Size grainSize = GrainSize(jobs, count);
+        const Size chunkCount = (count + grainSize - 1) / grainSize;
+        Vector<U> totals(chunkCount);
+
+        jobs.ParallelForRange(chunkCount, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk; chunk < lastChunk; chunk++)
+            {
+                const Size begin = chunk * grainSize;
+                const Size end = begin + grainSize < count ? begin + grainSize : count;
+
+                U running = first[begin];
+                output[begin] = running;
+                for(Size i = begin + 1; i < end; i++)
+                {
+                    running = operation(running, first[i]);
+                    output[i] = running;
+                }
+                totals[chunk] = running;
+            }
+        }, 1);
+
+        for(Size chunk = 1; chunk < chunkCount; chunk++) totals[chunk] = operation(totals[chunk - 1], totals[chunk]);
+
+        jobs.ParallelForRange(chunkCount - 1, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk + 1; chunk <= lastChunk; chunk++)
+            {
+                const Size begin = chunk * grainSize;
+                const Size end = begin + grainSize < count ? begin + grainSize : count;
+                const U& offset = totals[chunk - 1];
+
+                for(Size i = begin; i < end; i++) output[i] = operation(offset, output[i]);
+            }
+        }, 1);
+    }
+
+    /**
+     * \brief Moves the elements satisfying `predicate` in front of the others and returns the first element of the
+     * second group. The partition is stable: both groups keep their relative order
+     */
+    template<typename T, class Predicate>
+    T* Partition(JobSystem& jobs, T* first, T* last, Predicate&& predicate)
+    {
+        const Size count = last - first;
+        if(count == 0) return first;
+        if(RunSerially(jobs, count))
+        {
+            // Matches slide forward in place, the rest are moved into raw memory until the boundary is known
+            T* pRejected = Allocator::Allocate<T>(sizeof(T) * count);
+            Size rejectedCount = 0;
+
+            T* boundary = first;
+            try
+            {
+                for(T* current = first; current != last; ++current)
+                {
+                    if(!predicate(*current))
+                    {
+                        new (pRejected + rejectedCount) T(std::move(*current));
+                        rejectedCount++;
+                    }
+                    else
+                    {
+                        if(current != boundary) *boundary = std::move(*current);
+                        ++boundary;
+                    }
+                }
+                for(Size i = 0; i < rejectedCount; i++) boundary[i] = std::move(pRejected[i]);
+            }
+            catch(...)
+            {
+                Allocator::DestructAndDeallocate(&pRejected, rejectedCount);
+                throw;
+            }
+
+            Allocator::DestructAndDeallocate(&pRejected, rejectedCount);
+            return boundary;
+        }
+
+        const Size grainSize = GrainSize(jobs, count);
+        const Size chunkCount = (count + grainSize - 1) / grainSize;
+        Vector<Size> selected(chunkCount);
+
+        auto chunkEnd = [grainSize, count](Size begin)
+        {
+            return begin + grainSize < count ? begin + grainSize : count;
+        };
+
+        // Count the matches per chunk, turn the counts into offsets, then scatter into a buffer and move back
+        jobs.ParallelForRange(chunkCount, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk; chunk < lastChunk; chunk++)
+            {
+                Size matches = 0;
+                for(Size i = chunk * grainSize, end = chunkEnd(chunk * grainSize); i < end; i++)
+                {
+                    matches += predicate(first[i]) ? 1 : 0;
+                }
+                selected[chunk] = matches;
+            }
+        }, 1);
+
+        Size totalSelected = 0;
+        for(Size chunk = 0; chunk < chunkCount; chunk++)
+        {
+            const Size matches = selected[chunk];
+            selected[chunk] = totalSelected;
+            totalSelected += matches;
+        }
+
+        T* pBuffer = Allocator::Allocate<T>(sizeof(T) * count);
+
+        jobs.ParallelForRange(chunkCount, [&](Size firstChunk, Size lastChunk)
+        {
+            for(Size chunk = firstChunk; chunk < lastChunk; chunk++)
+            {
+                const Size begin = chunk * grainSize;
+                Size trueIndex = selected[chunk];
+                Size falseIndex = totalSelected + (begin - selected[chunk]);
+
+                for(Size i = begin, end = chunkEnd(begin); i < end; i++)
+                {
+                    if(predicate(first[i])) new (pBuffer + trueIndex++) T(std::move(first[i]));
+                    else new (pBuffer + falseIndex++) T(std::move(first[i]));
+                }
+            }
+        }, 1);
+
+        jobs.ParallelForRange(count, [first, pBuffer](Size begin, Size end)
+        {
+            for(Size i = begin; i < end; i++) first[i] = std::move(pBuffer[i]);
+        }, grainSize);
+
+        Allocator::DestructAndDeallocate(&pBuffer, count);
+        return first + totalSelected;
+    }
+
+    namespace SortInternal
+    {
+        /**
+         * \brief Finds how many of the first `k` merged elements come from `a`, so merges can be cut anywhere
+         */
+        template<typename T, class Compare>
+        Size CoRank(Size k, const T* a, Size aCount, const T* b, Size bCount, Compare& compare)
+        {
+            Size low = k > bCount ? k - bCount : 0;
+            Size high = k < aCount ? k : aCount;
+
+            while(low < high)
+            {
+                const Size i = low + (high - low) / 2;
+                const Size j = k - i;
+
+                // a[i] still belongs to the first k elements when it does not come after b[j - 1]
+                if(i < aCount && j > 0 && !compare(b[j - 1], a[i])) low = i + 1;
+                else high = i;
+            }
+            return low;
+        }
+    }
+
+    /**
+     * \brief Sorts [first, last): every thread sorts a slice, then the slices are merged pairwise with each merge
+     * cut into independent pieces by co-ranking. Not stable
+     */
+    template<typename T, class Compare = Less>
+    void Sort(JobSystem& jobs, T* first, T* last, Compare compare = Compare())
+    {
+        const Size count = last - first;
+        if(RunSerially(jobs, count))
+        {
+            WSTL::Sort(first, last, compare);
+            return;
+        }
+
+        Size runCount = 1;
+        while(runCount < jobs.ThreadCount() * 2 && count / (runCount * 2) >= MinGrainSize) runCount *= 2;
+        const Size runSize = (count + runCount - 1) / runCount;
+
+        jobs.ParallelForRange(runCount, [&](Size firstRun, Size lastRun)
+        {
+            for(Size run = firstRun; run < lastRun; run++)
+            {
+                const Size begin = run * runSize < count ? run * runSize : count;
+                const Size end = begin + runSize < count ? begin + runSize : count;
+                WSTL::Sort(first + begin, first + end, compare);
+            }
+        }, 1);
+
+        WSTL::SortInternal::TemporaryBuffer<T> buffer(count);
+        T* pSource = first;
+        T* pTarget = buffer.Data();
+
+        const Size maxPieceCount = jobs.ThreadCount() * 4 > runCount ? jobs.ThreadCount() * 4 : runCount;
+        WSTL::SortInternal::TemporaryBuffer<Size> splits(maxPieceCount);
+        Size* pSplits = splits.Data();
+
+        for(Size width = runSize; width < count; width *= 2)
+        {
+            const Size pairCount = (count + width * 2 - 1) / (width * 2);
+            Size piecesPerPair = jobs.ThreadCount() * 4 / pairCount;
+            if(piecesPerPair == 0) piecesPerPair = 1;
+            const Size pieceCount = pairCount * piecesPerPair;
+
+            auto pairBounds = [&](Size pair, Size& aBegin, Size& aEnd, Size& bEnd)
+            {
+                aBegin = pair * width * 2;
+                aEnd = aBegin + width < count ? aBegin + width : count;
+                bEnd = aEnd + width < count ? aEnd + width : count;
+            };
+
+            // Every cut is ranked before any merge starts, the merges move elements out of the ranges being ranked
+            jobs.ParallelForRange(pieceCount, [&](Size firstPiece, Size lastPiece)
+            {
+                for(Size piece = firstPiece; piece < lastPiece; piece++)
+                {
+                    Size aBegin, aEnd, bEnd;
+                    pairBounds(piece / piecesPerPair, aBegin, aEnd, bEnd);
+
+                    const Size kBegin = (aEnd - aBegin + bEnd - aEnd) * (piece % piecesPerPair) / piecesPerPair;
+                    pSplits[piece] = SortInternal::CoRank(kBegin, pSource + aBegin, aEnd - aBegin, pSource + aEnd,
+                                                          bEnd - aEnd, compare);
+                }
+            }, 1);
+
+            jobs.ParallelForRange(pieceCount, [&](Size firstPiece, Size lastPiece)
+            {
+                for(Size piece = firstPiece; piece < lastPiece; piece++)
+                {
+                    const Size part = piece % piecesPerPair;
+                    Size aBegin, aEnd, bEnd;
+                    pairBounds(piece / piecesPerPair, aBegin, aEnd, bEnd);
+
+                    const Size aCount = aEnd - aBegin;
+                    const Size total = aCount + bEnd - aEnd;
+                    const Size kBegin = total * part / piecesPerPair;
+                    const Size kEnd = total * (part + 1) / piecesPerPair;
+                    const Size iBegin = pSplits[piece];
+                    const Size iEnd = part + 1 < piecesPerPair ? pSplits[piece + 1] : aCount;
+
+                    WSTL::SortInternal::MergeMove(pSource + aBegin + iBegin, pSource + aBegin + iEnd,
+                                                  pSource + aEnd + (kBegin - iBegin), pSource + aEnd + (kEnd - iEnd),
+                                                  pTarget + aBegin + kBegin, compare);
+                }
+            }, 1);
+
+            std::swap(pSource, pTarget);
+        }
+
+        if(pSource != first)
+        {
+            jobs.ParallelForRange(count, [first, pSource](Size begin, Size end)
+            {
+                for(Size i = begin; i < end; i++) first[i] = std::move(pSource[i]);
+            }, GrainSize(jobs, count));
+        }
+    }
+
+    /**
+     * \brief Container overloads, for Vector, Array, FixedVector and anything else with Data() and Size()
+     */
+    template<class Container, class F, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    void ForEach(JobSystem& jobs, Container& container, F&& function)
+    {
+        ForEach(jobs, container.Data(), container.Data() + container.Size(), std::forward<F>(function));
+    }
+
+    template<class Input, class Output, class F, typename = EnableIfT<IsContiguousContainerV<Input>>>
+    void Transform(JobSystem& jobs, const Input& input, Output& output, F&& function)
+    {
+        if(output.Size() < input.Size()) throw std::out_of_range("Transform output is smaller than the input");
+        Transform(jobs, input.Data(), input.Data() + input.Size(), output.Data(), std::forward<F>(function));
+    }
+
+    template<class Container, typename Result, class Operation = Plus,
+             typename = EnableIfT<IsContiguousContainerV<Container>>>
+    Result Reduce(JobSystem& jobs, const Container& container, Result init, Operation operation = Operation())
+    {
+        return Reduce(jobs, container.Data(), container.Data() + container.Size(), std::move(init), operation);
+    }
+
+    template<class Container, typename Result, class Operation, class Combine,
+             typename = EnableIfT<IsContiguousContainerV<Container>>>
+    Result Reduce(JobSystem& jobs, const Container& container, Result init, Result identity, Operation operation,
+                  Combine combine)
+    {
+        return Reduce(jobs, container.Data(), container.Data() + container.Size(), std::move(init),
+                      std::move(identity), operation, combine);
+    }
+
+    template<class Input, class Output, class Operation = Plus, typename = EnableIfT<IsContiguousContainerV<Input>>>
+    void InclusiveScan(JobSystem& jobs, const Input& input, Output& output, Operation operation = Operation())
+    {
+        if(output.Size() < input.Size()) throw std::out_of_range("InclusiveScan output is smaller than the input");
+        InclusiveScan(jobs, input.Data(), input.Data() + input.Size(), output.Data(), operation);
+    }
+
+    template<class Container, class Predicate, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    Size Partition(JobSystem& jobs, Container& container, Predicate&& predicate)
+    {
+        auto first = container.Data();
+        return Partition(jobs, first, first + container.Size(), std::forward<Predicate>(predicate)) - first;
+    }
+
+    template<class Container, class Compare = Less, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    void Sort(JobSystem& jobs, Container& container, Compare compare = Compare())
+    {
+        Sort(jobs, container.Data(), container.Data() + container.Size(), compare);
+    }
+}
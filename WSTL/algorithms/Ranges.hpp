@@ -0,0 +1,858 @@
+#pragma once
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+/**
+ * Lazy range adaptors. Each adaptor wraps its source in a view whose iterators do the work as they are advanced, so
+ * a chain like `values | Filter(f) | Transform(g) | Take(10)` runs as one pass over values and allocates nothing
+ * until Collect. Lvalue sources are referenced, so they have to outlive the views; temporaries are moved into the
+ * view. Every adaptor can be called directly, Filter(values, f), or piped, values | Filter(f)
+ */
+namespace WSTL::Ranges
+{
+    namespace RangesInternal
+    {
+        /**
+         * \brief Base of every view, so nesting a view copies it instead of referencing it
+         */
+        struct ViewBase
+        {
+        };
+
+        template<class Range, typename = void>
+        struct HasSize : FalseType {};
+
+        template<class Range>
+        struct HasSize<Range, std::void_t<decltype(std::declval<const Range&>().Size())>> : TrueType {};
+
+        template<class Range>
+        using IteratorOf = decltype(std::declval<const Range&>().begin());
+
+        /**
+         * \brief Pointer range over a contiguous container, built from Data() and Size()
+         */
+        template<typename T>
+        class PointerRange : public ViewBase
+        {
+        public:
+            PointerRange(T* pFirst, ::Size count) noexcept : pFirst(pFirst), count(count)
+            {
+            }
+
+            T* begin() const noexcept
+            {
+                return pFirst;
+            }
+
+            T* end() const noexcept
+            {
+                return pFirst + count;
+            }
+
+            ::Size Size() const noexcept
+            {
+                return count;
+            }
+
+        private:
+            T* pFirst;
+            ::Size count;
+        };
+
+        /**
+         * \brief Reference to an lvalue container that is only reachable through its iterators, like List
+         */
+        template<class Container>
+        class ReferenceRange : public ViewBase
+        {
+        public:
+            explicit ReferenceRange(Container& container) noexcept : pContainer(&container)
+            {
+            }
+
+            auto begin() const
+            {
+                return pContainer->begin();
+            }
+
+            auto end() const
+            {
+                return pContainer->end();
+            }
+
+            template<class C = Container, typename = EnableIfT<HasSize<C>::value>>
+            ::Size Size() const
+            {
+                return static_cast<::Size>(pContainer->Size());
+            }
+
+        private:
+            Container* pContainer;
+        };
+
+        /**
+         * \brief A temporary container moved into the view that iterates it
+         */
+        template<class Container>
+        class OwningRange : public ViewBase
+        {
+        public:
+            explicit OwningRange(Container&& container) : container(std::move(container))
+            {
+            }
+
+            auto begin() const
+            {
+                if constexpr(IsContiguousContainerV<const Container>) return container.Data();
+                else return container.begin();
+            }
+
+            auto end() const
+            {
+                if constexpr(IsContiguousContainerV<const Container>) return container.Data() + container.Size();
+                else return container.end();
+            }
+
+            template<class C = Container, typename = EnableIfT<HasSize<C>::value>>
+            ::Size Size() const
+            {
+                return static_cast<::Size>(container.Size());
+            }
+
+        private:
+            Container container;
+        };
+
+        /**
+         * \brief Returns what a view stores for its source: views by value, lvalue containers by reference (as a
+         * pointer range when contiguous) and temporaries by moving them in
+         */
+        template<class Range>
+        auto Hold(Range&& range)
+        {
+            using R = std::remove_cv_t<std::remove_reference_t<Range>>;
+            if constexpr(std::is_base_of_v<ViewBase, R>) return R(std::forward<Range>(range));
+            else if constexpr(!std::is_lvalue_reference_v<Range>) return OwningRange<R>(std::move(range));
+            else if constexpr(IsContiguousContainerV<std::remove_reference_t<Range>>)
+            {
+                using T = std::remove_pointer_t<decltype(range.Data())>;
+                return PointerRange<T>(range.Data(), static_cast<::Size>(range.Size()));
+            }
+            else return ReferenceRange<std::remove_reference_t<Range>>(range);
+        }
+
+        template<class Range>
+        using HeldT = decltype(Hold(std::declval<Range>()));
+
+        /**
+         * \brief Iterator over at most count elements of [current, last), shared by Take and Chunk
+         */
+        template<class BaseIterator>
+        class CountedIterator
+        {
+        public:
+            CountedIterator(BaseIterator current, BaseIterator last, ::Size remaining)
+                : current(current), last(last), remaining(remaining)
+            {
+            }
+
+            decltype(auto) operator*() const
+            {
+                return *current;
+            }
+
+            CountedIterator& operator++()
+            {
+                ++current;
+                --remaining;
+                return *this;
+            }
+
+            bool operator==(const CountedIterator& other) const
+            {
+                const bool done = IsDone();
+                return done == other.IsDone() && (done || current == other.current);
+            }
+
+            bool operator!=(const CountedIterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            bool IsDone() const
+            {
+                return remaining == 0 || current == last;
+            }
+
+            BaseIterator current;
+            BaseIterator last;
+            ::Size remaining;
+        };
+
+        /**
+         * \brief Lets an adaptor called without its range be applied with range | adaptor
+         */
+        template<class Function>
+        struct Pipe
+        {
+            Function function;
+        };
+
+        template<class Function>
+        Pipe<Function> MakePipe(Function function)
+        {
+            return Pipe<Function>{ std::move(function) };
+        }
+
+        template<class Range, class Function>
+        auto operator|(Range&& range, const Pipe<Function>& pipe) -> decltype(pipe.function(std::forward<Range>(range)))
+        {
+            return pipe.function(std::forward<Range>(range));
+        }
+
+        template<class Range>
+        ::Size SizeOf(const Range& range)
+        {
+            return static_cast<::Size>(range.Size());
+        }
+    }
+
+    /**
+     * \brief View of the elements of Base for which predicate returns true
+     */
+    template<class Base, class Predicate>
+    class FilterView : public RangesInternal::ViewBase
+    {
+        typedef RangesInternal::IteratorOf<Base> BaseIterator;
+
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(BaseIterator current, BaseIterator last, const Predicate* pPredicate)
+                : current(current), last(last), pPredicate(pPredicate)
+            {
+                SkipRejected();
+            }
+
+            decltype(auto) operator*() const
+            {
+                return *current;
+            }
+
+            Iterator& operator++()
+            {
+                ++current;
+                SkipRejected();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(current == other.current);
+            }
+
+        private:
+            void SkipRejected()
+            {
+                while(current != last && !(*pPredicate)(*current)) ++current;
+            }
+
+            BaseIterator current;
+            BaseIterator last;
+            const Predicate* pPredicate;
+        };
+
+        FilterView(Base base, Predicate predicate) : base(std::move(base)), predicate(std::move(predicate))
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(base.begin(), base.end(), &predicate);
+        }
+
+        Iterator end() const
+        {
+            return Iterator(base.end(), base.end(), &predicate);
+        }
+
+    private:
+        Base base;
+        Predicate predicate;
+    };
+
+    /**
+     * \brief View of function(element) for every element of Base, computed when dereferenced
+     */
+    template<class Base, class Function>
+    class TransformView : public RangesInternal::ViewBase
+    {
+        typedef RangesInternal::IteratorOf<Base> BaseIterator;
+
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(BaseIterator current, const Function* pFunction) : current(current), pFunction(pFunction)
+            {
+            }
+
+            decltype(auto) operator*() const
+            {
+                return (*pFunction)(*current);
+            }
+
+            Iterator& operator++()
+            {
+                ++current;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(current == other.current);
+            }
+
+        private:
+            BaseIterator current;
+            const Function* pFunction;
+        };
+
+        TransformView(Base base, Function function) : base(std::move(base)), function(std::move(function))
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(base.begin(), &function);
+        }
+
+        Iterator end() const
+        {
+            return Iterator(base.end(), &function);
+        }
+
+        template<class B = Base, typename = EnableIfT<RangesInternal::HasSize<B>::value>>
+        ::Size Size() const
+        {
+            return RangesInternal::SizeOf(base);
+        }
+
+    private:
+        Base base;
+        Function function;
+    };
+
+    /**
+     * \brief View of the first count elements of Base, or all of them if there are fewer
+     */
+    template<class Base>
+    class TakeView : public RangesInternal::ViewBase
+    {
+    public:
+        typedef RangesInternal::CountedIterator<RangesInternal::IteratorOf<Base>> Iterator;
+
+        TakeView(Base base, ::Size count) : base(std::move(base)), count(count)
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(base.begin(), base.end(), count);
+        }
+
+        Iterator end() const
+        {
+            return Iterator(base.end(), base.end(), 0);
+        }
+
+        template<class B = Base, typename = EnableIfT<RangesInternal::HasSize<B>::value>>
+        ::Size Size() const
+        {
+            const ::Size baseSize = RangesInternal::SizeOf(base);
+            return count < baseSize ? count : baseSize;
+        }
+
+    private:
+        Base base;
+        ::Size count;
+    };
+
+    /**
+     * \brief View of (index, element) pairs, with indices counting from 0
+     */
+    template<class Base>
+    class EnumerateView : public RangesInternal::ViewBase
+    {
+        typedef RangesInternal::IteratorOf<Base> BaseIterator;
+
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(BaseIterator current, ::Size index) : current(current), index(index)
+            {
+            }
+
+            std::pair<::Size, decltype(*std::declval<const BaseIterator&>())> operator*() const
+            {
+                return { index, *current };
+            }
+
+            Iterator& operator++()
+            {
+                ++current;
+                ++index;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(current == other.current);
+            }
+
+        private:
+            BaseIterator current;
+            ::Size index;
+        };
+
+        explicit EnumerateView(Base base) : base(std::move(base))
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(base.begin(), 0);
+        }
+
+        Iterator end() const
+        {
+            return Iterator(base.end(), 0);
+        }
+
+        template<class B = Base, typename = EnableIfT<RangesInternal::HasSize<B>::value>>
+        ::Size Size() const
+        {
+            return RangesInternal::SizeOf(base);
+        }
+
+    private:
+        Base base;
+    };
+
+    /**
+     * \brief View of pairs of the elements of First and Second at the same position, as long as the shorter one
+     */
+    template<class First, class Second>
+    class ZipView : public RangesInternal::ViewBase
+    {
+        typedef RangesInternal::IteratorOf<First> FirstIterator;
+        typedef RangesInternal::IteratorOf<Second> SecondIterator;
+
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(FirstIterator first, SecondIterator second) : first(first), second(second)
+            {
+            }
+
+            std::pair<decltype(*std::declval<const FirstIterator&>()), decltype(*std::declval<const SecondIterator&>())>
+            operator*() const
+            {
+                return { *first, *second };
+            }
+
+            Iterator& operator++()
+            {
+                ++first;
+                ++second;
+                return *this;
+            }
+
+            /**
+             * \brief Equal once either side reaches the matching side of other, so the end of the shorter range
+             * ends the zip
+             */
+            bool operator==(const Iterator& other) const
+            {
+                return first == other.first || second == other.second;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            FirstIterator first;
+            SecondIterator second;
+        };
+
+        ZipView(First first, Second second) : first(std::move(first)), second(std::move(second))
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(first.begin(), second.begin());
+        }
+
+        Iterator end() const
+        {
+            return Iterator(first.end(), second.end());
+        }
+
+        template<class F = First, class S = Second,
+                 typename = EnableIfT<RangesInternal::HasSize<F>::value && RangesInternal::HasSize<S>::value>>
+        ::Size Size() const
+        {
+            const ::Size firstSize = RangesInternal::SizeOf(first);
+            const ::Size secondSize = RangesInternal::SizeOf(second);
+            return firstSize < secondSize ? firstSize : secondSize;
+        }
+
+    private:
+        First first;
+        Second second;
+    };
+
+    /**
+     * \brief View of consecutive chunks of count elements of Base, the last one may be shorter. Every chunk is
+     * itself a range over Base
+     */
+    template<class Base>
+    class ChunkView : public RangesInternal::ViewBase
+    {
+        typedef RangesInternal::IteratorOf<Base> BaseIterator;
+
+    public:
+        /**
+         * \brief One chunk, iterated without copying its elements
+         */
+        class Chunk
+        {
+        public:
+            typedef RangesInternal::CountedIterator<BaseIterator> Iterator;
+
+            Chunk(BaseIterator first, BaseIterator last, ::Size count) : first(first), last(last), count(count)
+            {
+            }
+
+            Iterator begin() const
+            {
+                return Iterator(first, last, count);
+            }
+
+            Iterator end() const
+            {
+                return Iterator(last, last, 0);
+            }
+
+        private:
+            BaseIterator first;
+            BaseIterator last;
+            ::Size count;
+        };
+
+        class Iterator
+        {
+        public:
+            Iterator(BaseIterator current, BaseIterator last, ::Size count) : current(current), last(last), count(count)
+            {
+            }
+
+            Chunk operator*() const
+            {
+                return Chunk(current, last, count);
+            }
+
+            Iterator& operator++()
+            {
+                for(::Size i = 0; i < count && current != last; i++) ++current;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return current == other.current;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(current == other.current);
+            }
+
+        private:
+            BaseIterator current;
+            BaseIterator last;
+            ::Size count;
+        };
+
+        /**
+         * \brief Constructor. Throws std::invalid_argument if count is 0
+         */
+        ChunkView(Base base, ::Size count) : base(std::move(base)), count(count)
+        {
+            if(count == 0) throw std::invalid_argument("Ranges::Chunk: count must be greater than 0");
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(base.begin(), base.end(), count);
+        }
+
+        Iterator end() const
+        {
+            return Iterator(base.end(), base.end(), count);
+        }
+
+        template<class B = Base, typename = EnableIfT<RangesInternal::HasSize<B>::value>>
+        ::Size Size() const
+        {
+            return (RangesInternal::SizeOf(base) + count - 1) / count;
+        }
+
+    private:
+        Base base;
+        ::Size count;
+    };
+
+    /**
+     * \brief Returns a view of the elements of range for which predicate returns true
+     */
+    template<class Range, class Predicate>
+    auto Filter(Range&& range, Predicate predicate)
+    {
+        using Base = RangesInternal::HeldT<Range>;
+        return FilterView<Base, Predicate>(RangesInternal::Hold(std::forward<Range>(range)), std::move(predicate));
+    }
+
+    template<class Predicate>
+    auto Filter(Predicate predicate)
+    {
+        return RangesInternal::MakePipe([predicate](auto&& range)
+        {
+            return Filter(std::forward<decltype(range)>(range), predicate);
+        });
+    }
+
+    /**
+     * \brief Returns a view of function(element) for every element of range
+     */
+    template<class Range, class Function>
+    auto Transform(Range&& range, Function function)
+    {
+        using Base = RangesInternal::HeldT<Range>;
+        return TransformView<Base, Function>(RangesInternal::Hold(std::forward<Range>(range)), std::move(function));
+    }
+
+    template<class Function>
+    auto Transform(Function function)
+    {
+        return RangesInternal::MakePipe([function](auto&& range)
+        {
+            return Transform(std::forward<decltype(range)>(range), function);
+        });
+    }
+
+    /**
+     * \brief Returns a view of the first count elements of range
+     */
+    template<class Range>
+    auto Take(Range&& range, ::Size count)
+    {
+        using Base = RangesInternal::HeldT<Range>;
+        return TakeView<Base>(RangesInternal::Hold(std::forward<Range>(range)), count);
+    }
+
+    inline auto Take(::Size count)
+    {
+        return RangesInternal::MakePipe([count](auto&& range)
+        {
+            return Take(std::forward<decltype(range)>(range), count);
+        });
+    }
+
+    /**
+     * \brief Returns a view of (index, element) pairs of range
+     */
+    template<class Range>
+    auto Enumerate(Range&& range)
+    {
+        using Base = RangesInternal::HeldT<Range>;
+        return EnumerateView<Base>(RangesInternal::Hold(std::forward<Range>(range)));
+    }
+
+    inline auto Enumerate()
+    {
+        return RangesInternal::MakePipe([](auto&& range)
+        {
+            return Enumerate(std::forward<decltype(range)>(range));
+        });
+    }
+
+    /**
+     * \brief Returns a view of pairs of the elements of first and second, as long as the shorter one
+     */
+    template<class First, class Second>
+    auto Zip(First&& first, Second&& second)
+    {
+        using FirstBase = RangesInternal::HeldT<First>;
+        using SecondBase = RangesInternal::HeldT<Second>;
+        return ZipView<FirstBase, SecondBase>(RangesInternal::Hold(std::forward<First>(first)),
+                                              RangesInternal::Hold(std::forward<Second>(second)));
+    }
+
+    /**
+     * \brief Pipe form, range | Zip(second) pairs range with second. second is held like any source
+     */
+    template<class Second>
+    auto Zip(Second&& second)
+    {
+        return RangesInternal::MakePipe([second = RangesInternal::Hold(std::forward<Second>(second))](auto&& range)
+        {
+            return Zip(std::forward<decltype(range)>(range), second);
+        });
+    }
+
+    /**
+     * \brief Returns a view of consecutive chunks of count elements of range
+     */
+    template<class Range>
+    auto Chunk(Range&& range, ::Size count)
+    {
+        using Base = RangesInternal::HeldT<Range>;
+        return ChunkView<Base>(RangesInternal::Hold(std::forward<Range>(range)), count);
+    }
+
+    inline auto Chunk(::Size count)
+    {
+        return RangesInternal::MakePipe([count](auto&& range)
+        {
+            return Chunk(std::forward<decltype(range)>(range), count);
+        });
+    }
+
+    namespace RangesInternal
+    {
+        template<class Container, typename = void>
+        struct HasReserve : FalseType {};
+
+        template<class Container>
+        struct HasReserve<Container, std::void_t<decltype(std::declval<Container&>().Reserve(::Size{}))>> : TrueType {};
+
+        template<class Container, typename = void>
+        struct HasSetCapacity : FalseType {};
+
+        template<class Container>
+        struct HasSetCapacity<Container, std::void_t<decltype(std::declval<Container&>().SetCapacity(::Size{}))>>
+            : TrueType {};
+
+        template<class Container, class Value, typename = void>
+        struct HasPushBack : FalseType {};
+
+        template<class Container, class Value>
+        struct HasPushBack<Container, Value,
+                           std::void_t<decltype(std::declval<Container&>().PushBack(std::declval<Value>()))>> : TrueType {};
+
+        template<class Container>
+        void ReserveExact(Container& container, ::Size count)
+        {
+            if constexpr(HasReserve<Container>::value) container.Reserve(count);
+            else if constexpr(HasSetCapacity<Container>::value) container.SetCapacity(count);
+        }
+
+        template<class Container, class Value>
+        void Append(Container& container, Value&& value)
+        {
+            if constexpr(HasPushBack<Container, Value&&>::value) container.PushBack(std::forward<Value>(value));
+            else container.Insert(std::forward<Value>(value));
+        }
+
+        template<class Container>
+        struct CollectPipe
+        {
+        };
+
+        template<template<typename...> class Container>
+        struct CollectTemplatePipe
+        {
+        };
+    }
+
+    /**
+     * \brief Runs range once and stores its elements in a new Container, with PushBack or else Insert. When the
+     * size of range is known the container reserves exactly that much first
+     */
+    template<class Container, class Range>
+    Container Collect(Range&& range)
+    {
+        const auto held = RangesInternal::Hold(std::forward<Range>(range));
+
+        Container container;
+        if constexpr(RangesInternal::HasSize<decltype(held)>::value)
+            RangesInternal::ReserveExact(container, held.Size());
+        for(auto&& value : held) RangesInternal::Append(container, std::forward<decltype(value)>(value));
+        return container;
+    }
+
+    /**
+     * \brief Collect into Container<element type of range>, e.g. Collect<Vector>(range)
+     */
+    template<template<typename...> class Container, class Range>
+    auto Collect(Range&& range)
+    {
+        using Element = decltype(*std::declval<const RangesInternal::HeldT<Range>&>().begin());
+        using Value = std::remove_cv_t<std::remove_reference_t<Element>>;
+        return Collect<Container<Value>>(std::forward<Range>(range));
+    }
+
+    template<class Container>
+    RangesInternal::CollectPipe<Container> Collect()
+    {
+        return {};
+    }
+
+    template<template<typename...> class Container>
+    RangesInternal::CollectTemplatePipe<Container> Collect()
+    {
+        return {};
+    }
+
+    namespace RangesInternal
+    {
+        template<class Range, class Container>
+        Container operator|(Range&& range, CollectPipe<Container>)
+        {
+            return Ranges::Collect<Container>(std::forward<Range>(range));
+        }
+
+        template<class Range, template<typename...> class Container>
+        auto operator|(Range&& range, CollectTemplatePipe<Container>)
+        {
+            return Ranges::Collect<Container>(std::forward<Range>(range));
+        }
+    }
+}
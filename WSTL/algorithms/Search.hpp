@@ -0,0 +1,85 @@
+#pragma once
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Pair.hpp"
+#include "WSTL/utility/Functional.hpp"
+#include "WSTL/utility/Prefetch.hpp"
+
+namespace WSTL
+{
+    namespace SearchInternal
+    {
+        /**
+         * \brief Ranges with more elements than this prefetch both possible midpoints of the next step
+         */
+        constexpr Size PrefetchThreshold = 1024;
+    }
+
+    /**
+     * \brief Returns the first element of the sorted range [first, last) that is not less than value. The loop has no
+     * data dependent branch: the comparison only picks which half to keep, which compiles to a conditional move
+     */
+    template<typename T, typename Value, class Compare = Less>
+    T* LowerBound(T* first, T* last, const Value& value, Compare compare = Compare())
+    {
+        Size length = static_cast<Size>(last - first);
+        if(length == 0) return first;
+
+        while(length > 1)
+        {
+            const Size half = length / 2;
+            if(length > SearchInternal::PrefetchThreshold)
+            {
+                Prefetch(first + half / 2);
+                Prefetch(first + half + half / 2);
+            }
+            first = compare(first[half], value) ? first + half : first;
+            length -= half;
+        }
+        return first + compare(*first, value);
+    }
+
+    /**
+     * \brief Returns the first element of the sorted range [first, last) that is greater than value, branchless like
+     * LowerBound
+     */
+    template<typename T, typename Value, class Compare = Less>
+    T* UpperBound(T* first, T* last, const Value& value, Compare compare = Compare())
+    {
+        Size length = static_cast<Size>(last - first);
+        if(length == 0) return first;
+
+        while(length > 1)
+        {
+            const Size half = length / 2;
+            if(length > SearchInternal::PrefetchThreshold)
+            {
+                Prefetch(first + half / 2);
+                Prefetch(first + half + half / 2);
+            }
+            first = compare(value, first[half]) ? first : first + half;
+            length -= half;
+        }
+        return first + !compare(value, *first);
+    }
+
+    /**
+     * \brief Returns the range of elements of the sorted range [first, last) equal to value
+     */
+    template<typename T, typename Value, class Compare = Less>
+    Pair<T*, T*> EqualRange(T* first, T* last, const Value& value, Compare compare = Compare())
+    {
+        T* lower = LowerBound(first, last, value, compare);
+        return Pair<T*, T*>(lower, UpperBound(lower, last, value, compare));
+    }
+
+    /**
+     * \brief Returns if the sorted range [first, last) contains value
+     */
+    template<typename T, typename Value, class Compare = Less>
+    bool BinarySearch(T* first, T* last, const Value& value, Compare compare = Compare())
+    {
+        T* lower = LowerBound(first, last, value, compare);
+        return lower != last && !compare(value, *lower);
+    }
+}
@@ -0,0 +1,728 @@
+#pragma once
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/utility/Functional.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Radix key extractor that reads a member, e.g. `RadixSort(particles, MemberKey<&Particle::depth>())`
+     */
+    template<auto Member>
+    struct MemberKey
+    {
+        template<typename T>
+        constexpr auto operator()(const T& value) const noexcept
+        {
+            return value.*Member;
+        }
+    };
+
+    namespace SortInternal
+    {
+        constexpr PtrDiff InsertionSortThreshold = 24;
+        constexpr PtrDiff NetworkSortThreshold = 8;
+        constexpr PtrDiff NintherThreshold = 128;
+        constexpr PtrDiff PartialInsertionSortLimit = 8;
+        constexpr PtrDiff PartitionBlockSize = 64;
+        constexpr PtrDiff StableRunSize = 16;
+        constexpr Size RadixSortThreshold = 2048;
+
+        /**
+         * \brief Scratch memory from the WSTL Allocator, default constructed unless T is trivial
+         */
+        template<typename T>
+        class TemporaryBuffer
+        {
+        public:
+            explicit TemporaryBuffer(Size count) : count(count)
+            {
+                pData = Allocator::Allocate<T>(sizeof(T) * (count == 0 ? 1 : count));
+                if constexpr (!IsTrivialV<T>) Allocator::Construct(pData, count);
+            }
+
+            TemporaryBuffer(const TemporaryBuffer& other) = delete;
+            TemporaryBuffer& operator=(const TemporaryBuffer& other) = delete;
+
+            ~TemporaryBuffer()
+            {
+                if constexpr (!IsTrivialV<T>) Allocator::Destruct(pData, count);
+                Allocator::Deallocate(&pData);
+            }
+
+            T* Data() noexcept
+            {
+                return pData;
+            }
+
+        private:
+            T* pData;
+            Size count;
+        };
+
+        /**
+         * \brief Orders two elements without a branch for types the compiler can select between
+         */
+        template<typename T, class Compare>
+        inline void CompareExchange(T& a, T& b, Compare& compare)
+        {
+            if constexpr (IsTrivialV<T>)
+            {
+                const T first = a;
+                const T second = b;
+                const bool swap = compare(second, first);
+                a = swap ? second : first;
+                b = swap ? first : second;
+            }
+            else
+            {
+                if(compare(b, a)) std::swap(a, b);
+            }
+        }
+
+        /**
+         * \brief Optimal sorting networks for 2 to 8 elements, stored as pairs of indices
+         */
+        constexpr UI8 Network2[] = {0, 1};
+        constexpr UI8 Network3[] = {0, 2, 0, 1, 1, 2};
+        constexpr UI8 Network4[] = {0, 2, 1, 3, 0, 1, 2, 3, 1, 2};
+        constexpr UI8 Network5[] = {0, 3, 1, 4, 0, 2, 1, 3, 0, 1, 2, 4, 1, 2, 3, 4, 2, 3};
+        constexpr UI8 Network6[] = {0, 5, 1, 3, 2, 4, 1, 2, 3, 4, 0, 3, 2, 5, 0, 1, 2, 3, 4, 5, 1, 2, 3, 4};
+        constexpr UI8 Network7[] = {0, 6, 2, 3, 4, 5, 0, 2, 1, 4, 3, 6, 0, 1, 2, 5, 3, 4, 1, 2, 4, 6, 2, 3, 4, 5,
+                                    1, 2, 3, 4, 5, 6};
+        constexpr UI8 Network8[] = {0, 2, 1, 3, 4, 6, 5, 7, 0, 4, 1, 5, 2, 6, 3, 7, 0, 1, 2, 3, 4, 5, 6, 7, 2, 4,
+                                    3, 5, 1, 4, 3, 6, 1, 2, 3, 4, 5, 6};
+
+        template<typename T, class Compare, Size PairCount>
+        inline void ApplyNetwork(T* first, const UI8 (&network)[PairCount], Compare& compare)
+        {
+            for(Size i = 0; i < PairCount; i += 2) CompareExchange(first[network[i]], first[network[i + 1]], compare);
+        }
+
+        template<typename T, class Compare>
+        void NetworkSort(T* first, PtrDiff count, Compare& compare)
+        {
+            switch(count)
+            {
+            case 2: ApplyNetwork(first, Network2, compare); break;
+            case 3: ApplyNetwork(first, Network3, compare); break;
+            case 4: ApplyNetwork(first, Network4, compare); break;
+            case 5: ApplyNetwork(first, Network5, compare); break;
+            case 6: ApplyNetwork(first, Network6, compare); break;
+            case 7: ApplyNetwork(first, Network7, compare); break;
+            case 8: ApplyNetwork(first, Network8, compare); break;
+            default: break;
+            }
+        }
+
+        template<typename T, class Compare>
+        void InsertionSort(T* first, T* last, Compare& compare)
+        {
+            if(first == last) return;
+
+            for(T* current = first + 1; current != last; ++current)
+            {
+                if(!compare(*current, *(current - 1))) continue;
+
+                T value = std::move(*current);
+                T* hole = current;
+                do
+                {
+                    *hole = std::move(*(hole - 1));
+                    --hole;
+                }
+                while(hole != first && compare(value, *(hole - 1)));
+                *hole = std::move(value);
+            }
+        }
+
+        /**
+         * \brief Insertion sort that relies on the element before `first` being no greater than any in the range
+         */
+        template<typename T, class Compare>
+        void UnguardedInsertionSort(T* first, T* last, Compare& compare)
+        {
+            if(first == last) return;
+
+            for(T* current = first + 1; current != last; ++current)
+            {
+                if(!compare(*current, *(current - 1))) continue;
+
+                T value = std::move(*current);
+                T* hole = current;
+                do
+                {
+                    *hole = std::move(*(hole - 1));
+                    --hole;
+                }
+                while(compare(value, *(hole - 1)));
+                *hole = std::move(value);
+            }
+        }
+
+        /**
+         * \brief Insertion sort that gives up after a few moves, returns if the range ended up sorted
+         */
+        template<typename T, class Compare>
+        bool PartialInsertionSort(T* first, T* last, Compare& compare)
+        {
+            if(first == last) return true;
+
+            PtrDiff moves = 0;
+            for(T* current = first + 1; current != last; ++current)
+            {
+                if(!compare(*current, *(current - 1))) continue;
+
+                T value = std::move(*current);
+                T* hole = current;
+                do
+                {
+                    *hole = std::move(*(hole - 1));
+                    --hole;
+                }
+                while(hole != first && compare(value, *(hole - 1)));
+                *hole = std::move(value);
+
+                moves += current - hole;
+                if(moves > PartialInsertionSortLimit) return current + 1 == last;
+            }
+            return true;
+        }
+
+        template<typename T, class Compare>
+        void SmallSort(T* first, T* last, bool leftmost, Compare& compare)
+        {
+            const PtrDiff count = last - first;
+            if(count <= NetworkSortThreshold) NetworkSort(first, count, compare);
+            else if(leftmost) InsertionSort(first, last, compare);
+            else UnguardedInsertionSort(first, last, compare);
+        }
+
+        template<typename T, class Compare>
+        void SiftDown(T* first, PtrDiff index, PtrDiff count, Compare& compare)
+        {
+            T value = std::move(first[index]);
+            for(PtrDiff child = index * 2 + 1; child < count; child = index * 2 + 1)
+            {
+                if(child + 1 < count && compare(first[child], first[child + 1])) child++;
+                if(!compare(value, first[child])) break;
+
+                first[index] = std::move(first[child]);
+                index = child;
+            }
+            first[index] = std::move(value);
+        }
+
+        template<typename T, class Compare>
+        void HeapSort(T* first, T* last, Compare& compare)
+        {
+            const PtrDiff count = last - first;
+            for(PtrDiff i = count / 2 - 1; i >= 0; i--) SiftDown(first, i, count, compare);
+
+            for(PtrDiff end = count - 1; end > 0; end--)
+            {
+                std::swap(first[0], first[end]);
+                SiftDown(first, 0, end, compare);
+            }
+        }
+
+        template<typename T, class Compare>
+        inline void Sort3(T* a, T* b, T* c, Compare& compare)
+        {
+            CompareExchange(*a, *b, compare);
+            CompareExchange(*b, *c, compare);
+            CompareExchange(*a, *b, compare);
+        }
+
+        /**
+         * \brief Partitions around *first, equal elements go right. Reports if no swap was needed
+         */
+        template<typename T, class Compare>
+        T* PartitionRight(T* begin, T* end, bool& alreadyPartitioned, Compare& compare)
+        {
+            T pivot = std::move(*begin);
+            T* first = begin;
+            T* last = end;
+
+            while(compare(*++first, pivot)) { }
+
+            if(first - 1 == begin)
+            {
+                while(first < last && !compare(*--last, pivot)) { }
+            }
+            else
+            {
+                while(!compare(*--last, pivot)) { }
+            }
+
+            alreadyPartitioned = first >= last;
+
+            while(first < last)
+            {
+                std::swap(*first, *last);
+                while(compare(*++first, pivot)) { }
+                while(!compare(*--last, pivot)) { }
+            }
+
+            T* pivotPosition = first - 1;
+            *begin = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+            return pivotPosition;
+        }
+
+        /**
+         * \brief Moves the misplaced elements found by PartitionRightBranchless across, with a cyclic permutation
+         * instead of swaps when the two sides found a different amount
+         */
+        template<typename T>
+        inline void SwapOffsets(T* first, T* last, const UI8* pLeftOffsets, const UI8* pRightOffsets, PtrDiff count,
+                                bool useSwaps)
+        {
+            if(useSwaps)
+            {
+                for(PtrDiff i = 0; i < count; i++) std::swap(first[pLeftOffsets[i]], *(last - pRightOffsets[i]));
+                return;
+            }
+            if(count == 0) return;
+
+            T* pLeft = first + pLeftOffsets[0];
+            T* pRight = last - pRightOffsets[0];
+            T value = std::move(*pLeft);
+            *pLeft = std::move(*pRight);
+            for(PtrDiff i = 1; i < count; i++)
+            {
+                pLeft = first + pLeftOffsets[i];
+                *pRight = std::move(*pLeft);
+                pRight = last - pRightOffsets[i];
+                *pLeft = std::move(*pRight);
+            }
+            *pRight = std::move(value);
+        }
+
+        /**
+         * \brief PartitionRight for cheap comparisons: both sides first record the offsets of misplaced elements in
+         * blocks, without branching on the comparison, then the recorded elements are swapped across
+         */
+        template<typename T, class Compare>
+        T* PartitionRightBranchless(T* begin, T* end, bool& alreadyPartitioned, Compare& compare)
+        {
+            T pivot = std::move(*begin);
+            T* first = begin;
+            T* last = end;
+
+            while(compare(*++first, pivot)) { }
+
+            if(first - 1 == begin)
+            {
+                while(first < last && !compare(*--last, pivot)) { }
+            }
+            else
+            {
+                while(!compare(*--last, pivot)) { }
+            }
+
+            alreadyPartitioned = first >= last;
+            if(!alreadyPartitioned)
+            {
+                std::swap(*first, *last);
+                ++first;
+
+                alignas(SystemCacheLineSize) UI8 leftOffsets[PartitionBlockSize];
+                alignas(SystemCacheLineSize) UI8 rightOffsets[PartitionBlockSize];
+                T* pLeftBase = first;
+                T* pRightBase = last;
+                PtrDiff leftCount = 0, rightCount = 0, leftStart = 0, rightStart = 0;
+
+                while(first < last)
+                {
+                    // Only refill a side once all of its recorded offsets were used
+                    const PtrDiff unknown = last - first;
+                    const PtrDiff leftSplit = leftCount == 0 ? (rightCount == 0 ? unknown / 2 : unknown) : 0;
+                    const PtrDiff rightSplit = rightCount == 0 ? unknown - leftSplit : 0;
+
+                    const PtrDiff leftBlock = leftSplit < PartitionBlockSize ? leftSplit : PartitionBlockSize;
+                    for(PtrDiff i = 0; i < leftBlock; i++)
+                    {
+                        leftOffsets[leftCount] = static_cast<UI8>(i);
+                        leftCount += !compare(*first, pivot);
+                        ++first;
+                    }
+
+                    const PtrDiff rightBlock = rightSplit < PartitionBlockSize ? rightSplit : PartitionBlockSize;
+                    for(PtrDiff i = 0; i < rightBlock;)
+                    {
+                        rightOffsets[rightCount] = static_cast<UI8>(++i);
+                        rightCount += compare(*--last, pivot);
+                    }
+
+                    const PtrDiff count = leftCount < rightCount ? leftCount : rightCount;
+                    SwapOffsets(pLeftBase, pRightBase, leftOffsets + leftStart, rightOffsets + rightStart, count,
+                                leftCount == rightCount);
+                    leftCount -= count;
+                    rightCount -= count;
+                    leftStart += count;
+                    rightStart += count;
+
+                    if(leftCount == 0)
+                    {
+                        leftStart = 0;
+                        pLeftBase = first;
+                    }
+                    if(rightCount == 0)
+                    {
+                        rightStart = 0;
+                        pRightBase = last;
+                    }
+                }
+
+                // Whatever is left over on one side is moved to the boundary
+                if(leftCount != 0)
+                {
+                    while(leftCount--) std::swap(pLeftBase[leftOffsets[leftStart + leftCount]], *--last);
+                    first = last;
+                }
+                if(rightCount != 0)
+                {
+                    while(rightCount--) std::swap(*(pRightBase - rightOffsets[rightStart + rightCount]), *first++);
+                }
+            }
+
+            T* pivotPosition = first - 1;
+            *begin = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+            return pivotPosition;
+        }
+
+        /**
+         * \brief Partitions around *first, equal elements go left. Used when the pivot equals the element before the
+         * range, so the whole equal run is finished in one step
+         */
+        template<typename T, class Compare>
+        T* PartitionLeft(T* begin, T* end, Compare& compare)
+        {
+            T pivot = std::move(*begin);
+            T* first = begin;
+            T* last = end;
+
+            while(compare(pivot, *--last)) { }
+
+            if(last + 1 == end)
+            {
+                while(first < last && !compare(pivot, *++first)) { }
+            }
+            else
+            {
+                while(!compare(pivot, *++first)) { }
+            }
+
+            while(first < last)
+            {
+                std::swap(*first, *last);
+                while(compare(pivot, *--last)) { }
+                while(!compare(pivot, *++first)) { }
+            }
+
+            *begin = std::move(*last);
+            *last = std::move(pivot);
+            return last;
+        }
+
+        /**
+         * \brief Swaps a few elements around to break up patterns that produced an unbalanced partition
+         */
+        template<typename T>
+        void BreakPatterns(T* first, T* last)
+        {
+            const PtrDiff count = last - first;
+            if(count < InsertionSortThreshold) return;
+
+            std::swap(first[0], first[count / 4]);
+            std::swap(last[-1], last[-count / 4]);
+
+            if(count > NintherThreshold)
+            {
+                std::swap(first[1], first[count / 4 + 1]);
+                std::swap(first[2], first[count / 4 + 2]);
+                std::swap(last[-2], last[-count / 4 - 1]);
+                std::swap(last[-3], last[-count / 4 - 2]);
+            }
+        }
+
+        /**
+         * \brief Pattern-defeating quicksort: quicksort with ninther pivots that detects sorted and equal runs, and
+         * falls back to heapsort after too many unbalanced partitions
+         */
+        template<typename T, class Compare>
+        void PdqSort(T* begin, T* end, int badAllowed, bool leftmost, Compare& compare)
+        {
+            for(;;)
+            {
+                const PtrDiff count = end - begin;
+                if(count < InsertionSortThreshold)
+                {
+                    SmallSort(begin, end, leftmost, compare);
+                    return;
+                }
+
+                const PtrDiff half = count / 2;
+                if(count > NintherThreshold)
+                {
+                    Sort3(begin, begin + half, end - 1, compare);
+                    Sort3(begin + 1, begin + (half - 1), end - 2, compare);
+                    Sort3(begin + 2, begin + (half + 1), end - 3, compare);
+                    Sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+                    std::swap(*begin, *(begin + half));
+                }
+                else
+                {
+                    Sort3(begin + half, begin, end - 1, compare);
+                }
+
+                if(!leftmost && !compare(*(begin - 1), *begin))
+                {
+                    begin = PartitionLeft(begin, end, compare) + 1;
+                    continue;
+                }
+
+                bool alreadyPartitioned = false;
+                T* pivot = nullptr;
+                if constexpr (std::is_arithmetic_v<T>) pivot = PartitionRightBranchless(begin, end, alreadyPartitioned, compare);
+                else pivot = PartitionRight(begin, end, alreadyPartitioned, compare);
+
+                const PtrDiff leftCount = pivot - begin;
+                const PtrDiff rightCount = end - (pivot + 1);
+
+                if(leftCount < count / 8 || rightCount < count / 8)
+                {
+                    if(--badAllowed == 0)
+                    {
+                        HeapSort(begin, end, compare);
+                        return;
+                    }
+
+                    BreakPatterns(begin, pivot);
+                    BreakPatterns(pivot + 1, end);
+                }
+                else if(alreadyPartitioned && PartialInsertionSort(begin, pivot, compare) &&
+                        PartialInsertionSort(pivot + 1, end, compare))
+                {
+                    return;
+                }
+
+                PdqSort(begin, pivot, badAllowed, leftmost, compare);
+                begin = pivot + 1;
+                leftmost = false;
+            }
+        }
+
+        template<typename T, class Compare>
+        void MergeMove(T* a, T* aEnd, T* b, T* bEnd, T* output, Compare& compare)
+        {
+            while(a != aEnd && b != bEnd)
+            {
+                if(compare(*b, *a)) *output++ = std::move(*b++);
+                else *output++ = std::move(*a++);
+            }
+            while(a != aEnd) *output++ = std::move(*a++);
+            while(b != bEnd) *output++ = std::move(*b++);
+        }
+
+        /**
+         * \brief Maps a radix key onto an unsigned integer with the same ordering
+         */
+        template<typename Key>
+        inline auto RadixBits(Key key) noexcept
+        {
+            if constexpr (std::is_floating_point_v<Key>)
+            {
+                typedef ConditionalT<sizeof(Key) == 4, UI32, UI64> Bits;
+                const Bits bits = __builtin_bit_cast(Bits, key);
+                const Bits signBit = Bits{1} << (sizeof(Bits) * 8 - 1);
+                return (bits & signBit) != 0 ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+            }
+            else if constexpr (std::is_signed_v<Key>)
+            {
+                typedef std::make_unsigned_t<Key> Bits;
+                return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits{1} << (sizeof(Bits) * 8 - 1)));
+            }
+            else
+            {
+                return static_cast<std::make_unsigned_t<Key>>(key);
+            }
+        }
+    }
+
+    /**
+     * \brief Returns if [first, last) is sorted according to `compare`
+     */
+    template<typename T, class Compare = Less>
+    bool IsSorted(const T* first, const T* last, Compare compare = Compare())
+    {
+        if(first == last) return true;
+        for(++first; first != last; ++first)
+        {
+            if(compare(*first, *(first - 1))) return false;
+        }
+        return true;
+    }
+
+    /**
+     * \brief Sorts [first, last) with a stable LSD radix sort on 8-bit digits. `key` maps an element to an integer or
+     * floating point key; digits that are equal across all keys are skipped
+     */
+    template<typename T, class KeyExtractor = Identity>
+    void RadixSort(T* first, T* last, KeyExtractor key = KeyExtractor())
+    {
+        typedef std::remove_cvref_t<decltype(key(*first))> Key;
+        typedef decltype(SortInternal::RadixBits(Key())) Bits;
+        static_assert(std::is_arithmetic_v<Key>, "RadixSort keys have to be integers or floating point numbers");
+
+        constexpr Size DigitCount = sizeof(Bits);
+        const Size count = last - first;
+        if(count < 2) return;
+
+        // One pass builds the histogram of every digit
+        SortInternal::TemporaryBuffer<Size> histogram(DigitCount * 256);
+        Size* pHistogram = histogram.Data();
+        for(Size i = 0; i < DigitCount * 256; i++) pHistogram[i] = 0;
+
+        for(Size i = 0; i < count; i++)
+        {
+            const Bits bits = SortInternal::RadixBits(static_cast<Key>(key(first[i])));
+            for(Size digit = 0; digit < DigitCount; digit++)
+            {
+                pHistogram[digit * 256 + ((bits >> (digit * 8)) & 0xFF)]++;
+            }
+        }
+
+        SortInternal::TemporaryBuffer<T> buffer(count);
+        T* pSource = first;
+        T* pTarget = buffer.Data();
+
+        for(Size digit = 0; digit < DigitCount; digit++)
+        {
+            Size* pCounts = pHistogram + digit * 256;
+
+            bool trivial = false;
+            for(Size bucket = 0; bucket < 256 && !trivial; bucket++) trivial = pCounts[bucket] == count;
+            if(trivial) continue;
+
+            Size offset = 0;
+            for(Size bucket = 0; bucket < 256; bucket++)
+            {
+                const Size bucketCount = pCounts[bucket];
+                pCounts[bucket] = offset;
+                offset += bucketCount;
+            }
+
+            for(Size i = 0; i < count; i++)
+            {
+                const Bits bits = SortInternal::RadixBits(static_cast<Key>(key(pSource[i])));
+                pTarget[pCounts[(bits >> (digit * 8)) & 0xFF]++] = std::move(pSource[i]);
+            }
+
+            std::swap(pSource, pTarget);
+        }
+
+        if(pSource != first)
+        {
+            for(Size i = 0; i < count; i++) first[i] = std::move(pSource[i]);
+        }
+    }
+
+    /**
+     * \brief Sorts [first, last) with a pattern-defeating introsort, not stable. Sorting networks handle partitions up
+     * to 8 elements and insertion sort the rest of the small ones. Large arrays of plain numbers sorted ascending use
+     * RadixSort instead
+     */
+    template<typename T, class Compare = Less>
+    void Sort(T* first, T* last, Compare compare = Compare())
+    {
+        const PtrDiff count = last - first;
+        if(count < 2) return;
+
+        if constexpr (std::is_same_v<Compare, Less> && std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        {
+            // Radix sort does not notice presorted input the way the pdqsort does
+            if(static_cast<Size>(count) >= SortInternal::RadixSortThreshold && !IsSorted(first, last))
+            {
+                RadixSort(first, last);
+                return;
+            }
+        }
+
+        int badAllowed = 0;
+        for(PtrDiff remaining = count; remaining > 1; remaining >>= 1) badAllowed++;
+
+        SortInternal::PdqSort(first, last, badAllowed, true, compare);
+    }
+
+    /**
+     * \brief Sorts [first, last) keeping the order of equal elements: insertion sorted runs merged bottom-up through
+     * a buffer from the WSTL Allocator
+     */
+    template<typename T, class Compare = Less>
+    void StableSort(T* first, T* last, Compare compare = Compare())
+    {
+        const PtrDiff count = last - first;
+        if(count < 2) return;
+
+        for(PtrDiff run = 0; run < count; run += SortInternal::StableRunSize)
+        {
+            const PtrDiff runEnd = run + SortInternal::StableRunSize < count ? run + SortInternal::StableRunSize : count;
+            SortInternal::InsertionSort(first + run, first + runEnd, compare);
+        }
+        if(count <= SortInternal::StableRunSize) return;
+
+        SortInternal::TemporaryBuffer<T> buffer(static_cast<Size>(count));
+        T* pSource = first;
+        T* pTarget = buffer.Data();
+
+        for(PtrDiff width = SortInternal::StableRunSize; width < count; width *= 2)
+        {
+            for(PtrDiff begin = 0; begin < count; begin += width * 2)
+            {
+                const PtrDiff middle = begin + width < count ? begin + width : count;
+                const PtrDiff end = middle + width < count ? middle + width : count;
+                SortInternal::MergeMove(pSource + begin, pSource + middle, pSource + middle, pSource + end,
+                                        pTarget + begin, compare);
+            }
+            std::swap(pSource, pTarget);
+        }
+
+        if(pSource != first)
+        {
+            for(PtrDiff i = 0; i < count; i++) first[i] = std::move(pSource[i]);
+        }
+    }
+
+    /**
+     * \brief Container overloads, for Vector, Array, FixedVector and anything else with Data() and Size()
+     */
+    template<class Container, class Compare = Less, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    void Sort(Container& container, Compare compare = Compare())
+    {
+        Sort(container.Data(), container.Data() + container.Size(), compare);
+    }
+
+    template<class Container, class Compare = Less, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    void StableSort(Container& container, Compare compare = Compare())
+    {
+        StableSort(container.Data(), container.Data() + container.Size(), compare);
+    }
+
+    template<class Container, class KeyExtractor = Identity, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    void RadixSort(Container& container, KeyExtractor key = KeyExtractor())
+    {
+        RadixSort(container.Data(), container.Data() + container.Size(), key);
+    }
+
+    template<class Container, class Compare = Less, typename = EnableIfT<IsContiguousContainerV<Container>>>
+    bool IsSorted(const Container& container, Compare compare = Compare())
+    {
+        return IsSorted(container.Data(), container.Data() + container.Size(), compare);
+    }
+}
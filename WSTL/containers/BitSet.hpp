@@ -2,6 +2,8 @@
 
 #include "stdexcept"
 #include "WSTL/Types.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/BitKernels.hpp"
 #include "WSTL/utility/TypeTraits.hpp"
 
 namespace WSTL
@@ -206,7 +208,7 @@ namespace WSTL
          */
         constexpr BitSet& operator &=(const BitSet& other) noexcept
         {
-            for (::Size i = 0; i <= Words; i++) bits[i] &= other.bits[i];
+            BitKernels::And(bits, bits, other.bits, WordCount);
             return *this;
         }
 
@@ -215,7 +217,7 @@ namespace WSTL
          */
         constexpr BitSet& operator |=(const BitSet& other) noexcept
         {
-            for (::Size i = 0; i <= Words; i++) bits[i] |= other.bits[i];
+            BitKernels::Or(bits, bits, other.bits, WordCount);
             return *this;
         }
 
@@ -224,34 +226,61 @@ namespace WSTL
          */
         constexpr BitSet& operator ^=(const BitSet& other) noexcept
         {
-            for (::Size i = 0; i <= Words; i++) bits[i] ^= other.bits[i];
+            BitKernels::Xor(bits, bits, other.bits, WordCount);
             return *this;
         }
 
         /**
-         * @brief Shifts the BitSet to the left by the specified amount
+         * @brief Clears every bit that is Set (1) in other, same as &= ~other without the temporary
          */
-        constexpr BitSet& operator<<=(::Size shift) noexcept
+        constexpr BitSet& AndNot(const BitSet& other) noexcept
         {
-            const auto wordShift = static_cast<PtrDiff>(shift / BitsPerWord);
-            if (wordShift != 0)
-            {
-                for (auto i = Words; 0 <= i; i--)
-                {
-                    bits[i] = wordShift <= i ? bits[i - wordShift] : 0;
-                }
-            }
+            BitKernels::AndNot(bits, bits, other.bits, WordCount);
+            return *this;
+        }
 
-            if ((shift %= BitsPerWord) != 0)
-            {
-                for (auto i = Words; 0 < i; i--)
-                {
-                    bits[i] = (bits[i] << shift) | bits[i - 1] >> (BitsPerWord - shift);
-                }
+        /**
+         * @brief Stores a & ~b in this BitSet without temporaries
+         */
+        constexpr BitSet& AndNot(const BitSet& a, const BitSet& b) noexcept
+        {
+            BitKernels::AndNot(bits, a.bits, b.bits, WordCount);
+            return *this;
+        }
 
-                bits[0] <<= shift;
-            }
+        /**
+         * @brief Stores a & b in this BitSet without temporaries
+         */
+        constexpr BitSet& AndWith(const BitSet& a, const BitSet& b) noexcept
+        {
+            BitKernels::And(bits, a.bits, b.bits, WordCount);
+            return *this;
+        }
+
+        /**
+         * @brief Stores a | b in this BitSet without temporaries
+         */
+        constexpr BitSet& OrWith(const BitSet& a, const BitSet& b) noexcept
+        {
+            BitKernels::Or(bits, a.bits, b.bits, WordCount);
+            return *this;
+        }
+
+        /**
+         * @brief Stores a ^ b in this BitSet without temporaries
+         */
+        constexpr BitSet& XorWith(const BitSet& a, const BitSet& b) noexcept
+        {
+            BitKernels::Xor(bits, a.bits, b.bits, WordCount);
+            return *this;
+        }
 
+        /**
+         * @brief Shifts the BitSet to the left by the specified amount
+         */
+        constexpr BitSet& operator<<=(::Size shift) noexcept
+        {
+            BitKernels::ShiftLeft(bits, bits, WordCount, shift);
             Trim();
             return *this;
         }
@@ -261,74 +290,55 @@ namespace WSTL
          */
         constexpr BitSet& operator>>=(::Size shift) noexcept
         {
-            const auto wordShift = static_cast<PtrDiff>(shift / BitsPerWord);
-            if (wordShift != 0)
-            {
-                for (PtrDiff i = 0; i <= Words; i++)
-                {
-                    bits[i] = wordShift <= Words - i ? bits[i + wordShift] : 0;
-                }
-            }
-
-            if ((shift %= BitsPerWord) != 0)
-            {
-                for (PtrDiff i = 0; i < Words; i++)
-                {
-                    bits[i] = (bits[i] >> shift) | bits[i + 1] << (BitsPerWord - shift);
-                }
-
-                bits[Words] >>= shift;
-            }
-
+            BitKernels::ShiftRight(bits, bits, WordCount, shift);
             return *this;
         }
 
         [[nodiscard]]
         constexpr BitSet operator~() const noexcept
         {
-            auto tmp = *this;
-            tmp.Flip();
-            return tmp;
+            BitSet result;
+            BitKernels::Not(result.bits, bits, WordCount);
+            result.Trim();
+            return result;
         }
 
         [[nodiscard]]
-        constexpr BitSet operator&(const BitSet& other) noexcept
+        constexpr BitSet operator&(const BitSet& other) const noexcept
         {
-            auto tmp = *this;
-            tmp &= other;
-            return tmp;
+            BitSet result;
+            return result.AndWith(*this, other);
         }
 
         [[nodiscard]]
-        constexpr BitSet operator|(const BitSet& other) const
+        constexpr BitSet operator|(const BitSet& other) const noexcept
         {
-            auto tmp = *this;
-            tmp |= other;
-            return tmp;
+            BitSet result;
+            return result.OrWith(*this, other);
         }
 
         [[nodiscard]]
-        constexpr BitSet operator^(const BitSet& other) const
+        constexpr BitSet operator^(const BitSet& other) const noexcept
         {
-            auto tmp = *this;
-            tmp ^= other;
-            return tmp;
+            BitSet result;
+            return result.XorWith(*this, other);
         }
 
         [[nodiscard]]
         constexpr BitSet operator<<(const ::Size shift) const noexcept
         {
-            auto tmp = *this;
-            tmp <<= shift;
-            return tmp;
+            BitSet result;
+            BitKernels::ShiftLeft(result.bits, bits, WordCount, shift);
+            result.Trim();
+            return result;
         }
 
         [[nodiscard]]
         constexpr BitSet operator>>(const ::Size shift) const noexcept
         {
-            auto tmp = *this;
-            tmp >>= shift;
-            return tmp;
+            BitSet result;
+            BitKernels::ShiftRight(result.bits, bits, WordCount, shift);
+            return result;
         }
 
         [[nodiscard]]
@@ -404,7 +414,7 @@ namespace WSTL
          */
         constexpr BitSet& Flip() noexcept
         {
-            for (::Size i = 0; i <= Words; i++) bits[i] = ~bits[i];
+            BitKernels::Not(bits, bits, WordCount);
 
             Trim();
             return *this;
@@ -423,21 +433,16 @@ namespace WSTL
          * @brief Returns true if at least one bit is Set (1)
          */
         [[nodiscard]]
-        constexpr bool Any() noexcept
+        constexpr bool Any() const noexcept
         {
-            for (::Size i = 0; i <= Words; i++)
-            {
-                if (bits[i] != 0) return true;
-            }
-
-            return false;
+            return BitKernels::Any(bits, WordCount);
         }
 
         /**
          * @brief Returns true if no bits are Set (1)
          */
         [[nodiscard]]
-        constexpr bool None() noexcept
+        constexpr bool None() const noexcept
         {
             return !Any();
         }
@@ -446,15 +451,12 @@ namespace WSTL
          * @brief Returns true if all bits are Set (1)
          */
         [[nodiscard]]
-        constexpr bool All() noexcept
+        constexpr bool All() const noexcept
         {
             if (BitAmount == 0) return true;
 
             constexpr bool noPadding = BitAmount % BitsPerWord == 0;
-            for (::Size i = 0; i < Words + noPadding; i++)
-            {
-                if (bits[i] != ~static_cast<ArrayType>(0)) return false;
-            }
+            if (!BitKernels::All(bits, Words + noPadding)) return false;
 
             return noPadding || bits[Words] == (ArrayType{1} << (BitAmount % BitsPerWord)) - 1;
         }
@@ -463,17 +465,110 @@ namespace WSTL
          * @brief Returns the number of bits that are Set (1)
          */
         [[nodiscard]]
-        constexpr ::Size Count() noexcept
+        constexpr ::Size Count() const noexcept
+        {
+            return BitKernels::Count(bits, WordCount);
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindFirst() const noexcept
+        {
+            return FindFrom(0);
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit after pos, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindNext(const ::Size pos) const noexcept
+        {
+            return pos + 1 >= BitAmount ? BitAmount : FindFrom(pos + 1);
+        }
+
+        /**
+         * @brief Returns the position of the last Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindLast() const noexcept
+        {
+            for (PtrDiff i = Words; i >= 0; i--)
+            {
+                if (bits[i] != 0) return (i + 1) * BitsPerWord - 1 - CountLeadingZeros(bits[i]);
+            }
+            return BitAmount;
+        }
+
+        /**
+         * @brief Calls function with the position of every Set (1) bit, in increasing order
+         */
+        template <class Function>
+        constexpr void ForEachSetBit(Function&& function) const
         {
-            ::Size count = 0;
             for (::Size i = 0; i <= Words; i++)
             {
-                for (::Size j = 0; j < BitsPerWord; j++)
+                for (ArrayType word = bits[i]; word != 0; word &= word - 1)
                 {
-                    count += (bits[i] >> j) & 1;
+                    function(i * BitsPerWord + CountTrailingZeros(word));
                 }
             }
-            return count;
+        }
+
+        /**
+         * @brief Iterates the positions of the Set (1) bits
+         */
+        class SetBitIterator
+        {
+        public:
+            constexpr SetBitIterator(const BitSet* pBitSet, const ::Size pos) noexcept : pBitSet(pBitSet), pos(pos)
+            {
+            }
+
+            constexpr ::Size operator*() const noexcept
+            {
+                return pos;
+            }
+
+            constexpr SetBitIterator& operator++() noexcept
+            {
+                pos = pBitSet->FindNext(pos);
+                return *this;
+            }
+
+            constexpr bool operator!=(const SetBitIterator& other) const noexcept
+            {
+                return pos != other.pos;
+            }
+
+        private:
+            const BitSet* pBitSet;
+            ::Size pos;
+        };
+
+        struct SetBitRange
+        {
+            const BitSet* pBitSet;
+
+            constexpr SetBitIterator begin() const noexcept
+            {
+                return SetBitIterator(pBitSet, pBitSet->FindFirst());
+            }
+
+            constexpr SetBitIterator end() const noexcept
+            {
+                return SetBitIterator(pBitSet, BitAmount);
+            }
+        };
+
+        /**
+         * @brief Returns a range over the positions of the Set (1) bits, for (auto pos : bitSet.SetBits())
+         */
+        [[nodiscard]]
+        constexpr SetBitRange SetBits() const noexcept
+        {
+            return SetBitRange{this};
         }
 
         /**
@@ -571,6 +666,19 @@ namespace WSTL
     private:
         static constexpr PtrDiff BitsPerWord = CHAR_BIT * sizeof(ArrayType);
         static constexpr PtrDiff Words = BitAmount == 0 ? 0 : (BitAmount - 1) / BitsPerWord;
+        static constexpr ::Size WordCount = Words + 1;
+
+        constexpr ::Size FindFrom(const ::Size pos) const noexcept
+        {
+            ::Size i = pos / BitsPerWord;
+            ArrayType word = bits[i] & (~ArrayType{0} << (pos % BitsPerWord));
+            while (word == 0)
+            {
+                if (++i > static_cast<::Size>(Words)) return BitAmount;
+                word = bits[i];
+            }
+            return i * BitsPerWord + CountTrailingZeros(word);
+        }
 
         constexpr void Trim() noexcept
         {
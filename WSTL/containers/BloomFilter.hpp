@@ -0,0 +1,648 @@
+#pragma once
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/DynamicBitSet.hpp"
+#include "WSTL/utility/Hash.hpp"
+#include "WSTL/utility/Prefetch.hpp"
+
+namespace WSTL
+{
+    namespace BloomInternal
+    {
+        constexpr UI32 FilterMagic = 0x31464257; // "WBF1"
+        constexpr UI32 BlockedFilterMagic = 0x32424257; // "WBB2"
+        constexpr UI32 MaxHashCount = 30;
+        constexpr Size BatchSize = 16;
+
+        struct SerializedHeader
+        {
+            UI32 magic;
+            UI32 hashCount;
+            UI64 bitCount;
+        };
+
+        /**
+         * \brief SplitMix64 finalizer, spreads the key hash over 64 bits so two independent probes can be taken from it
+         */
+        constexpr UI64 Mix(UI64 value) noexcept
+        {
+            value ^= value >> 30;
+            value *= 0xbf58476d1ce4e5b9ULL;
+            value ^= value >> 27;
+            value *= 0x94d049bb133111ebULL;
+            value ^= value >> 31;
+            return value;
+        }
+
+        /**
+         * \brief Whether a key with a Hash() member also exposes its characters through Data() and Size()
+         */
+        template<typename Key, typename = void>
+        struct HasCharacters : FalseType {};
+
+        template<typename Key>
+        struct HasCharacters<Key, std::void_t<decltype(static_cast<const char*>(std::declval<const Key&>().Data())),
+                                              decltype(std::declval<const Key&>().Size())>> : TrueType {};
+
+        /**
+         * \brief 64-bit hash of a key, since 32 bits alone would collide long before a large filter fills up. Keys
+         * without a Hash() member get two MurmurHash3 passes with different seeds. Keys with one keep it as the low
+         * half; strings (String, StringView) add a seeded pass over their characters as the high half, while other
+         * keys (HashedName, InternedString) only have their 32-bit hash, so past a few million keys of those the
+         * false positive rate is bounded by its collisions rather than by the configured rate
+         */
+        template<typename Key>
+        inline UI64 KeyHash(const Key& key)
+        {
+            if constexpr (HasCustomHash<Key>::value && HasCharacters<Key>::value)
+            {
+                const UI32 high = Hash(key.Data(), static_cast<UI32>(key.Size()), 0x9e3779b9);
+                return Mix(static_cast<UI64>(high) << 32 | static_cast<UI32>(HashKey(key)));
+            }
+            else if constexpr (HasCustomHash<Key>::value)
+            {
+                return Mix(static_cast<UI64>(HashKey(key)));
+            }
+            else
+            {
+                return Mix(static_cast<UI64>(HashKey(key, 0x9e3779b9)) << 32 | static_cast<UI32>(HashKey(key)));
+            }
+        }
+
+        /**
+         * \brief Maps a probe to [0, count) with a multiply-shift on its high half, falls back to a modulo when count
+         * does not fit in 32 bits
+         */
+        inline Size Reduce(UI64 probe, Size count) noexcept
+        {
+            if(count <= 0xFFFFFFFFull) return static_cast<Size>((probe >> 32) * count >> 32);
+            return static_cast<Size>(probe % count);
+        }
+
+        /**
+         * \brief Bits needed for expectedCount keys at the false positive rate, m = -n ln(p) / ln(2)^2
+         */
+        inline Size OptimalBitCount(Size expectedCount, double falsePositiveRate)
+        {
+            if(!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+                throw std::invalid_argument("BloomFilter: false positive rate has to be in (0, 1)");
+
+            const double n = static_cast<double>(expectedCount == 0 ? 1 : expectedCount);
+            const double ln2 = 0.6931471805599453;
+            return static_cast<Size>(std::ceil(-n * std::log(falsePositiveRate) / (ln2 * ln2)));
+        }
+
+        /**
+         * \brief Hash count that minimizes the false positive rate, k = m / n ln(2)
+         */
+        inline UI32 OptimalHashCount(Size bitCount, Size expectedCount)
+        {
+            const double n = static_cast<double>(expectedCount == 0 ? 1 : expectedCount);
+            const double k = std::round(static_cast<double>(bitCount) / n * 0.6931471805599453);
+            return k < 1.0 ? 1 : k > MaxHashCount ? MaxHashCount : static_cast<UI32>(k);
+        }
+
+        /**
+         * \brief False positive rate of a blocked filter. The keys per block follow a Poisson law of mean
+         * n * blockBits / m, and a block holding i keys answers like a standard filter of blockBits bits holding i keys
+         */
+        inline double BlockedFalsePositiveRate(Size bitCount, Size expectedCount, UI32 hashCount, Size blockBits)
+        {
+            const double n = static_cast<double>(expectedCount == 0 ? 1 : expectedCount);
+            const double load = n * static_cast<double>(blockBits) / static_cast<double>(bitCount);
+            const double k = static_cast<double>(hashCount);
+            const double empty = 1.0 - 1.0 / static_cast<double>(blockBits);
+            const double last = load + 12.0 * std::sqrt(load) + 16.0;
+
+            double probability = std::exp(-load);
+            double rate = 0.0;
+            for(double i = 0.0; i <= last; i += 1.0)
+            {
+                if(i > 0.0) probability *= load / i;
+                rate += probability * std::pow(1.0 - std::pow(empty, i * k), k);
+            }
+            return rate;
+        }
+
+        /**
+         * \brief Smallest blocked filter that reaches the false positive rate. Uneven block loads cost more bits the
+         * lower the rate, so the size grows from the standard one in steps of 1/32, trying the hash counts around
+         * the optimum of each size
+         */
+        inline void BlockedGeometry(Size expectedCount, double falsePositiveRate, Size blockBits, Size& bitCount,
+                                    UI32& hashCount)
+        {
+            const Size standard = OptimalBitCount(expectedCount, falsePositiveRate);
+            const Size step = standard / 32 > blockBits ? standard / 32 : blockBits;
+            for(bitCount = (standard + blockBits - 1) / blockBits * blockBits;; bitCount += step)
+            {
+                const UI32 optimal = OptimalHashCount(bitCount, expectedCount);
+                double best = 1.0;
+                for(UI32 k = optimal > 2 ? optimal - 2 : 1; k <= optimal + 1 && k <= MaxHashCount; k++)
+                {
+                    const double rate = BlockedFalsePositiveRate(bitCount, expectedCount, k, blockBits);
+                    if(rate < best)
+                    {
+                        best = rate;
+                        hashCount = k;
+                    }
+                }
+                if(best <= falsePositiveRate) return;
+            }
+        }
+
+        inline void Serialize(void* pBuffer, UI32 magic, UI32 hashCount, const DynamicBitSet& bits)
+        {
+            const SerializedHeader header = {magic, hashCount, static_cast<UI64>(bits.Size())};
+            std::memcpy(pBuffer, &header, sizeof(header));
+            std::memcpy(static_cast<Byte*>(pBuffer) + sizeof(header), bits.Data(), bits.WordCount() * sizeof(UI64));
+        }
+
+        /**
+         * \brief Validates a serialized filter and copies its bits, throws std::invalid_argument
+         */
+        inline SerializedHeader Deserialize(const void* pData, Size size, UI32 magic, Size bitGranularity,
+                                            DynamicBitSet& bits)
+        {
+            SerializedHeader header;
+            if(size < sizeof(header)) throw std::invalid_argument("BloomFilter::Deserialize: buffer too small");
+
+            std::memcpy(&header, pData, sizeof(header));
+            if(header.magic != magic) throw std::invalid_argument("BloomFilter::Deserialize: not a serialized filter");
+            if(header.hashCount == 0 || header.hashCount > MaxHashCount || header.bitCount == 0 ||
+               header.bitCount % bitGranularity != 0)
+                throw std::invalid_argument("BloomFilter::Deserialize: corrupted header");
+            if((size - sizeof(header)) / sizeof(UI64) < header.bitCount / 64)
+                throw std::invalid_argument("BloomFilter::Deserialize: truncated bits");
+
+            bits.Resize(static_cast<Size>(header.bitCount));
+            std::memcpy(bits.Data(), static_cast<const Byte*>(pData) + sizeof(header), bits.WordCount() * sizeof(UI64));
+            return header;
+        }
+    }
+
+    /**
+     * \brief Probabilistic set: MayContain never misses an inserted key, and reports absent keys as present at
+     * roughly the false positive rate it was built for. Keys are hashed to 64 bits by BloomInternal::KeyHash
+     * (see there for keys with their own 32-bit Hash()) and the k probes come from double hashing, h1 + i * h2
+     */
+    template<typename Key>
+    class BloomFilter
+    {
+    public:
+        typedef BloomFilter<Key> Self;
+
+        /**
+         * \brief Constructor sized for expectedCount keys at the target false positive rate.
+         * Throws std::invalid_argument if the rate is not in (0, 1)
+         */
+        BloomFilter(::Size expectedCount, double falsePositiveRate)
+        {
+            const ::Size bitCount = BloomInternal::OptimalBitCount(expectedCount, falsePositiveRate);
+            Initialize(bitCount, BloomInternal::OptimalHashCount(bitCount, expectedCount));
+        }
+
+        /**
+         * \brief Returns a filter with bitCount bits (rounded up to a whole word) and hashCount probes per key
+         */
+        static Self FromBitCount(::Size bitCount, UI32 hashCount)
+        {
+            if(bitCount == 0 || hashCount == 0 || hashCount > BloomInternal::MaxHashCount)
+                throw std::invalid_argument("BloomFilter::FromBitCount: invalid geometry");
+
+            Self filter;
+            filter.Initialize(bitCount, hashCount);
+            return filter;
+        }
+
+        /**
+         * \brief Adds the key
+         */
+        void Insert(const Key& key)
+        {
+            const UI64 first = BloomInternal::KeyHash(key);
+            const UI64 second = BloomInternal::Mix(first) | 1;
+            UI64* pWords = bits.Data();
+
+            UI64 probe = first;
+            for(UI32 i = 0; i < hashCount; i++, probe += second)
+            {
+                const ::Size bit = BloomInternal::Reduce(probe, bitCount);
+                pWords[bit / 64] |= UI64{1} << (bit % 64);
+            }
+        }
+
+        /**
+         * \brief Adds every key in [first, last). Keys are hashed in batches so the first probe of each can be
+         * prefetched before any bit is written
+         */
+        template<class Iterator>
+        void InsertMany(Iterator first, Iterator last)
+        {
+            UI64 hashes[BloomInternal::BatchSize];
+            UI64* pWords = bits.Data();
+
+            while(first != last)
+            {
+                ::Size count = 0;
+                for(; first != last && count < BloomInternal::BatchSize; ++first, count++)
+                {
+                    hashes[count] = BloomInternal::KeyHash(*first);
+                    PrefetchWrite(pWords + BloomInternal::Reduce(hashes[count], bitCount) / 64);
+                }
+
+                for(::Size j = 0; j < count; j++)
+                {
+                    const UI64 second = BloomInternal::Mix(hashes[j]) | 1;
+                    UI64 probe = hashes[j];
+                    for(UI32 i = 0; i < hashCount; i++, probe += second)
+                    {
+                        const ::Size bit = BloomInternal::Reduce(probe, bitCount);
+                        pWords[bit / 64] |= UI64{1} << (bit % 64);
+                    }
+                }
+            }
+        }
+
+        /**
+         * \brief Returns false if the key was never inserted, true if it probably was
+         */
+        [[nodiscard]]
+        bool MayContain(const Key& key) const
+        {
+            const UI64 first = BloomInternal::KeyHash(key);
+            const UI64 second = BloomInternal::Mix(first) | 1;
+            const UI64* pWords = bits.Data();
+
+            UI64 probe = first;
+            for(UI32 i = 0; i < hashCount; i++, probe += second)
+            {
+                const ::Size bit = BloomInternal::Reduce(probe, bitCount);
+                if((pWords[bit / 64] >> (bit % 64) & 1) == 0) return false;
+            }
+            return true;
+        }
+
+        /**
+         * \brief Removes every key
+         */
+        void Clear() noexcept
+        {
+            bits.Reset();
+        }
+
+        /**
+         * \brief Adds every key of other, which needs the same bit and hash count.
+         * Throws std::invalid_argument if they differ
+         */
+        Self& operator|=(const Self& other)
+        {
+            if(bitCount != other.bitCount || hashCount != other.hashCount)
+                throw std::invalid_argument("BloomFilter::operator|=: filters have different geometry");
+
+            bits |= other.bits;
+            return *this;
+        }
+
+        Self operator|(const Self& other) const
+        {
+            Self result(*this);
+            result |= other;
+            return result;
+        }
+
+        /**
+         * \brief Returns the number of bits
+         */
+        [[nodiscard]]
+        ::Size BitCount() const noexcept
+        {
+            return bitCount;
+        }
+
+        /**
+         * \brief Returns the number of probes per key
+         */
+        [[nodiscard]]
+        UI32 HashCount() const noexcept
+        {
+            return hashCount;
+        }
+
+        /**
+         * \brief Returns the fraction of Set bits
+         */
+        [[nodiscard]]
+        double FillRatio() const noexcept
+        {
+            return static_cast<double>(bits.Count()) / static_cast<double>(bitCount);
+        }
+
+        /**
+         * \brief Returns the false positive rate expected from the current fill ratio
+         */
+        [[nodiscard]]
+        double EstimatedFalsePositiveRate() const noexcept
+        {
+            return std::pow(FillRatio(), static_cast<double>(hashCount));
+        }
+
+        /**
+         * \brief Returns the number of bytes Serialize writes
+         */
+        [[nodiscard]]
+        ::Size SerializedSize() const noexcept
+        {
+            return sizeof(BloomInternal::SerializedHeader) + bits.WordCount() * sizeof(UI64);
+        }
+
+        /**
+         * \brief Writes the filter into pBuffer, which needs SerializedSize() bytes
+         */
+        void Serialize(void* pBuffer) const
+        {
+            BloomInternal::Serialize(pBuffer, BloomInternal::FilterMagic, hashCount, bits);
+        }
+
+        /**
+         * \brief Reads a filter written by Serialize. Throws std::invalid_argument if the data is not one
+         */
+        static Self Deserialize(const void* pData, ::Size size)
+        {
+            Self filter;
+            const auto header = BloomInternal::Deserialize(pData, size, BloomInternal::FilterMagic, 64, filter.bits);
+            filter.bitCount = static_cast<::Size>(header.bitCount);
+            filter.hashCount = header.hashCount;
+            return filter;
+        }
+
+    private:
+        BloomFilter() = default;
+
+        void Initialize(::Size bits, UI32 hashes)
+        {
+            bitCount = (bits + 63) / 64 * 64;
+            hashCount = hashes;
+            this->bits.Resize(bitCount);
+        }
+
+        DynamicBitSet bits;
+        ::Size bitCount = 0;
+        UI32 hashCount = 0;
+    };
+
+    /**
+     * \brief Bloom filter that keeps all the probes of a key inside one 512-bit block, so a lookup touches a single
+     * cache line instead of k. Keys spread unevenly over the blocks, so it needs more bits than BloomFilter for the
+     * same false positive rate, more so at low rates; the constructor sizes it from the rate of blocked filters
+     */
+    template<typename Key>
+    class BlockedBloomFilter
+    {
+    public:
+        typedef BlockedBloomFilter<Key> Self;
+
+        static constexpr ::Size BlockBits = 512;
+        static constexpr ::Size BlockWords = BlockBits / 64;
+
+        /**
+         * \brief Bits of hash per probe, log2(BlockBits)
+         */
+        static constexpr UI32 ProbeBits = 9;
+
+        /**
+         * \brief Constructor sized for expectedCount keys at the target false positive rate.
+         * Throws std::invalid_argument if the rate is not in (0, 1)
+         */
+        BlockedBloomFilter(::Size expectedCount, double falsePositiveRate)
+        {
+            ::Size bitCount = 0;
+            UI32 hashes = 0;
+            BloomInternal::BlockedGeometry(expectedCount, falsePositiveRate, BlockBits, bitCount, hashes);
+            Initialize(bitCount, hashes);
+        }
+
+        /**
+         * \brief Returns a filter with at least bitCount bits (rounded up to a whole block) and hashCount probes per key
+         */
+        static Self FromBitCount(::Size bitCount, UI32 hashCount)
+        {
+            if(bitCount == 0 || hashCount == 0 || hashCount > BloomInternal::MaxHashCount)
+                throw std::invalid_argument("BlockedBloomFilter::FromBitCount: invalid geometry");
+
+            Self filter;
+            filter.Initialize(bitCount, hashCount);
+            return filter;
+        }
+
+        /**
+         * \brief Adds the key
+         */
+        void Insert(const Key& key)
+        {
+            InsertHash(BloomInternal::KeyHash(key));
+        }
+
+        /**
+         * \brief Adds every key in [first, last). Keys are hashed in batches and their blocks prefetched before any
+         * of them is written
+         */
+        template<class Iterator>
+        void InsertMany(Iterator first, Iterator last)
+        {
+            UI64 hashes[BloomInternal::BatchSize];
+
+            while(first != last)
+            {
+                ::Size count = 0;
+                for(; first != last && count < BloomInternal::BatchSize; ++first, count++)
+                {
+                    hashes[count] = BloomInternal::KeyHash(*first);
+                    PrefetchWrite(Block(hashes[count]));
+                }
+
+                for(::Size i = 0; i < count; i++) InsertHash(hashes[i]);
+            }
+        }
+
+        /**
+         * \brief Returns false if the key was never inserted, true if it probably was
+         */
+        [[nodiscard]]
+        bool MayContain(const Key& key) const
+        {
+            return ContainsHash(BloomInternal::KeyHash(key));
+        }
+
+        /**
+         * \brief Writes MayContain of every key in [first, last) to pResults, prefetching blocks a batch ahead
+         */
+        template<class Iterator>
+        void MayContainMany(Iterator first, Iterator last, bool* pResults) const
+        {
+            UI64 hashes[BloomInternal::BatchSize];
+
+            while(first != last)
+            {
+                ::Size count = 0;
+                for(; first != last && count < BloomInternal::BatchSize; ++first, count++)
+                {
+                    hashes[count] = BloomInternal::KeyHash(*first);
+                    Prefetch(Block(hashes[count]));
+                }
+
+                for(::Size i = 0; i < count; i++) *pResults++ = ContainsHash(hashes[i]);
+            }
+        }
+
+        /**
+         * \brief Removes every key
+         */
+        void Clear() noexcept
+        {
+            bits.Reset();
+        }
+
+        /**
+         * \brief Adds every key of other, which needs the same block and hash count.
+         * Throws std::invalid_argument if they differ
+         */
+        Self& operator|=(const Self& other)
+        {
+            if(blockCount != other.blockCount || hashCount != other.hashCount)
+                throw std::invalid_argument("BlockedBloomFilter::operator|=: filters have different geometry");
+
+            bits |= other.bits;
+            return *this;
+        }
+
+        Self operator|(const Self& other) const
+        {
+            Self result(*this);
+            result |= other;
+            return result;
+        }
+
+        /**
+         * \brief Returns the number of bits
+         */
+        [[nodiscard]]
+        ::Size BitCount() const noexcept
+        {
+            return blockCount * BlockBits;
+        }
+
+        /**
+         * \brief Returns the number of probes per key
+         */
+        [[nodiscard]]
+        UI32 HashCount() const noexcept
+        {
+            return hashCount;
+        }
+
+        /**
+         * \brief Returns the fraction of Set bits
+         */
+        [[nodiscard]]
+        double FillRatio() const noexcept
+        {
+            return static_cast<double>(bits.Count()) / static_cast<double>(BitCount());
+        }
+
+        /**
+         * \brief Returns the number of bytes Serialize writes
+         */
+        [[nodiscard]]
+        ::Size SerializedSize() const noexcept
+        {
+            return sizeof(BloomInternal::SerializedHeader) + bits.WordCount() * sizeof(UI64);
+        }
+
+        /**
+         * \brief Writes the filter into pBuffer, which needs SerializedSize() bytes
+         */
+        void Serialize(void* pBuffer) const
+        {
+            BloomInternal::Serialize(pBuffer, BloomInternal::BlockedFilterMagic, hashCount, bits);
+        }
+
+        /**
+         * \brief Reads a filter written by Serialize. Throws std::invalid_argument if the data is not one
+         */
+        static Self Deserialize(const void* pData, ::Size size)
+        {
+            Self filter;
+            const auto header = BloomInternal::Deserialize(pData, size, BloomInternal::BlockedFilterMagic, BlockBits,
+                                                           filter.bits);
+            filter.blockCount = static_cast<::Size>(header.bitCount / BlockBits);
+            filter.hashCount = header.hashCount;
+            return filter;
+        }
+
+    private:
+        BlockedBloomFilter() = default;
+
+        void Initialize(::Size bitCount, UI32 hashes)
+        {
+            blockCount = (bitCount + BlockBits - 1) / BlockBits;
+            hashCount = hashes;
+            bits.Resize(blockCount * BlockBits);
+        }
+
+        /**
+         * \brief The high half of the hash picks the block (multiply-shift instead of a modulo)
+         */
+        const UI64* Block(UI64 hash) const noexcept
+        {
+            return bits.Data() + ((hash >> 32) * blockCount >> 32) * BlockWords;
+        }
+
+        /**
+         * \brief Calls function with the position of every probe of a key inside its block. Each probe takes its own
+         * 9 bits of the remixed hash, which is mixed again once its 7 probes are used: arithmetic probe sequences
+         * overlap too much inside 512 bits and double the false positive rate at 0.1%
+         */
+        template<class Function>
+        void ForEachProbe(UI64 hash, Function function) const noexcept
+        {
+            UI64 inner = BloomInternal::Mix(hash);
+            UI32 shift = 0;
+            for(UI32 i = 0; i < hashCount; i++)
+            {
+                if(shift + ProbeBits > 64)
+                {
+                    inner = BloomInternal::Mix(inner);
+                    shift = 0;
+                }
+                function(static_cast<UI32>(inner >> shift) & (BlockBits - 1));
+                shift += ProbeBits;
+            }
+        }
+
+        void InsertHash(UI64 hash) noexcept
+        {
+            UI64* pBlock = const_cast<UI64*>(Block(hash));
+            ForEachProbe(hash, [pBlock](UI32 bit) { pBlock[bit / 64] |= UI64{1} << (bit % 64); });
+        }
+
+        bool ContainsHash(UI64 hash) const noexcept
+        {
+            const UI64* pBlock = Block(hash);
+
+            // Collects every probe before testing, so the loop has no early exit to mispredict
+            UI64 missing = 0;
+            ForEachProbe(hash, [pBlock, &missing](UI32 bit) { missing |= ~pBlock[bit / 64] & (UI64{1} << (bit % 64)); });
+            return missing == 0;
+        }
+
+        DynamicBitSet bits;
+        ::Size blockCount = 0;
+        UI32 hashCount = 0;
+    };
+}
@@ -3,14 +3,34 @@
 #include "WSTL/containers/Array.hpp"
 #include "WSTL/containers/Vector.hpp"
 #include "WSTL/containers/Pair.hpp"
+#include "WSTL/containers/NodeHandle.hpp"
 #include "WSTL/containers/List.hpp"
 #include "WSTL/containers/SList.hpp"
 #include "WSTL/containers/Stack.hpp"
 #include "WSTL/containers/Queue.hpp"
 #include "WSTL/containers/Map.hpp"
 #include "WSTL/containers/Set.hpp"
+#include "WSTL/containers/FlatMap.hpp"
+#include "WSTL/containers/FlatSet.hpp"
+#include "WSTL/containers/StaticIndex.hpp"
+#include "WSTL/containers/FrozenMap.hpp"
 #include "WSTL/containers/Deque.hpp"
 #include "WSTL/containers/BitSet.hpp"
+#include "WSTL/containers/DynamicBitSet.hpp"
+#include "WSTL/containers/HierarchicalBitSet.hpp"
+#include "WSTL/containers/RoaringBitmap.hpp"
+#include "WSTL/containers/BloomFilter.hpp"
 #include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/SoAVector.hpp"
+#include "WSTL/containers/DenseArray.hpp"
+#include "WSTL/containers/Span.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/containers/String.hpp"
+#include "WSTL/containers/StringPool.hpp"
+#include "WSTL/containers/SlotMap.hpp"
+#include "WSTL/containers/SparseSet.hpp"
 
 #include "WSTL/containers/fixed/FixedVector.hpp"
+
+#include "WSTL/containers/concurrent/MpmcQueue.hpp"
+#include "WSTL/containers/concurrent/WorkStealingDeque.hpp"
@@ -0,0 +1,232 @@
+#pragma once
+#include <stdexcept>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Growable array in uninitialized storage, so T only needs to be move constructible. It backs the dense
+     * side of SparseSet and SlotMap: elements are appended at the back and erased by moving the last one into the
+     * hole. Pointers into it are invalidated by growth and by EraseSwap
+     */
+    template<typename T>
+    class DenseArray
+    {
+        typedef DenseArray<T> Self;
+
+    public:
+        /**
+         * \brief Default constructor
+         */
+        DenseArray() = default;
+
+        /**
+         * \brief Copy constructor
+         */
+        DenseArray(const Self& other) : DenseArray()
+        {
+            Reserve(other.count);
+            for(; count < other.count; count++) new(pValues + count) T(other.pValues[count]);
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        DenseArray(Self&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~DenseArray()
+        {
+            Allocator::Destruct(pValues, count);
+            Allocator::Deallocate(&pValues);
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            Self copy(other);
+            Swap(copy);
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Self moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * \brief Swaps the contents with other
+         */
+        void Swap(Self& other) noexcept
+        {
+            std::swap(pValues, other.pValues);
+            std::swap(count, other.count);
+            std::swap(capacity, other.capacity);
+        }
+
+        /**
+         * \brief Returns the number of elements
+         */
+        ::Size Size() const noexcept
+        {
+            return count;
+        }
+
+        /**
+         * \brief Returns whether there are no elements
+         */
+        bool IsEmpty() const noexcept
+        {
+            return count == 0;
+        }
+
+        /**
+         * \brief Returns the number of elements that fit before the array grows
+         */
+        ::Size Capacity() const noexcept
+        {
+            return capacity;
+        }
+
+        /**
+         * \brief Makes room for amount elements
+         */
+        void Reserve(::Size amount)
+        {
+            if(amount > capacity) Grow(amount);
+        }
+
+        /**
+         * \brief Constructs an element at the back and returns it
+         */
+        template<class... Args>
+        T& EmplaceBack(Args&&... args)
+        {
+            if(count == capacity)
+            {
+                // The arguments may refer to an element, so they are used before the old array goes away
+                T value(std::forward<Args>(args)...);
+                Grow(capacity == 0 ? 8 : capacity * 2);
+                new(pValues + count) T(std::move(value));
+            }
+            else new(pValues + count) T(std::forward<Args>(args)...);
+
+            return pValues[count++];
+        }
+
+        /**
+         * \brief Removes the last element
+         */
+        void PopBack()
+        {
+            if(count == 0) throw std::out_of_range("DenseArray::PopBack: array is empty");
+            Allocator::Destruct(pValues + --count);
+        }
+
+        /**
+         * \brief Removes the element at index by moving the last element into its place
+         */
+        void EraseSwap(::Size index)
+        {
+            if(index >= count) throw std::out_of_range("DenseArray::EraseSwap: index out of range");
+            if(index != count - 1) pValues[index] = std::move(pValues[count - 1]);
+            PopBack();
+        }
+
+        /**
+         * \brief Removes every element, the capacity is kept
+         */
+        void Clear() noexcept
+        {
+            Allocator::Destruct(pValues, count);
+            count = 0;
+        }
+
+        T& operator[](::Size index) noexcept
+        {
+            return pValues[index];
+        }
+
+        const T& operator[](::Size index) const noexcept
+        {
+            return pValues[index];
+        }
+
+        T* Data() noexcept
+        {
+            return pValues;
+        }
+
+        const T* Data() const noexcept
+        {
+            return pValues;
+        }
+
+        T* begin() noexcept
+        {
+            return pValues;
+        }
+
+        const T* begin() const noexcept
+        {
+            return pValues;
+        }
+
+        T* end() noexcept
+        {
+            return pValues + count;
+        }
+
+        const T* end() const noexcept
+        {
+            return pValues + count;
+        }
+
+    private:
+        /**
+         * \brief Moves the elements to a larger buffer. Elements whose move can throw are copied instead when they can
+         * be, so a throw leaves the old buffer intact; the new buffer's constructed prefix is destroyed either way
+         */
+        void Grow(::Size newCapacity)
+        {
+            T* pNewValues = Allocator::AllocateAligned<T>(newCapacity * sizeof(T), alignof(T));
+            ::Size moved = 0;
+            try
+            {
+                for(; moved < count; moved++) new(pNewValues + moved) T(std::move_if_noexcept(pValues[moved]));
+            }
+            catch(...)
+            {
+                Allocator::Destruct(pNewValues, moved);
+                Allocator::Deallocate(&pNewValues);
+                throw;
+            }
+            Allocator::Destruct(pValues, count);
+            Allocator::Deallocate(&pValues);
+
+            pValues = pNewValues;
+            capacity = newCapacity;
+        }
+
+        T* pValues = nullptr;
+        ::Size count = 0;
+        ::Size capacity = 0;
+    };
+}
@@ -0,0 +1,881 @@
+#pragma once
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/BitKernels.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+namespace WSTL
+{
+    /**
+     * @brief BitSet whose size is chosen at runtime. Bits are packed into 64-bit words on the WSTL Allocator and it
+     * grows like a Vector, so it also serves as a packed Vector<bool>: PushBack, PopBack, Front, Back and iterators
+     * work the same way
+     */
+    class DynamicBitSet
+    {
+    public:
+        typedef UI64 Word;
+
+        class BitReference
+        {
+            friend DynamicBitSet;
+
+            constexpr BitReference(Word* pWord, const Word mask) noexcept : pWord(pWord), mask(mask)
+            {
+            }
+
+        public:
+            BitReference& operator=(const bool val) noexcept
+            {
+                if (val) *pWord |= mask;
+                else *pWord &= ~mask;
+                return *this;
+            }
+
+            BitReference& operator=(const BitReference& other) noexcept
+            {
+                return *this = static_cast<bool>(other);
+            }
+
+            [[nodiscard]]
+            bool operator~() const noexcept
+            {
+                return (*pWord & mask) == 0;
+            }
+
+            operator bool() const noexcept
+            {
+                return (*pWord & mask) != 0;
+            }
+
+            BitReference& flip() noexcept
+            {
+                *pWord ^= mask;
+                return *this;
+            }
+
+        private:
+            Word* pWord;
+            Word mask;
+        };
+
+        class Iterator
+        {
+        public:
+            Iterator(DynamicBitSet* pBitSet, const ::Size pos) noexcept : pBitSet(pBitSet), pos(pos)
+            {
+            }
+
+            BitReference operator*() const noexcept
+            {
+                return pBitSet->Reference(pos);
+            }
+
+            Iterator& operator++() noexcept
+            {
+                pos++;
+                return *this;
+            }
+
+            bool operator!=(const Iterator& other) const noexcept
+            {
+                return pos != other.pos;
+            }
+
+        private:
+            DynamicBitSet* pBitSet;
+            ::Size pos;
+        };
+
+        class ConstIterator
+        {
+        public:
+            ConstIterator(const DynamicBitSet* pBitSet, const ::Size pos) noexcept : pBitSet(pBitSet), pos(pos)
+            {
+            }
+
+            bool operator*() const noexcept
+            {
+                return pBitSet->Subscript(pos);
+            }
+
+            ConstIterator& operator++() noexcept
+            {
+                pos++;
+                return *this;
+            }
+
+            bool operator!=(const ConstIterator& other) const noexcept
+            {
+                return pos != other.pos;
+            }
+
+        private:
+            const DynamicBitSet* pBitSet;
+            ::Size pos;
+        };
+
+        /**
+         * @brief Iterates the positions of the Set (1) bits
+         */
+        class SetBitIterator
+        {
+        public:
+            SetBitIterator(const DynamicBitSet* pBitSet, const ::Size pos) noexcept : pBitSet(pBitSet), pos(pos)
+            {
+            }
+
+            ::Size operator*() const noexcept
+            {
+                return pos;
+            }
+
+            SetBitIterator& operator++() noexcept
+            {
+                pos = pBitSet->FindNext(pos);
+                return *this;
+            }
+
+            bool operator!=(const SetBitIterator& other) const noexcept
+            {
+                return pos != other.pos;
+            }
+
+        private:
+            const DynamicBitSet* pBitSet;
+            ::Size pos;
+        };
+
+        struct SetBitRange
+        {
+            const DynamicBitSet* pBitSet;
+
+            SetBitIterator begin() const noexcept
+            {
+                return SetBitIterator(pBitSet, pBitSet->FindFirst());
+            }
+
+            SetBitIterator end() const noexcept
+            {
+                return SetBitIterator(pBitSet, pBitSet->Size());
+            }
+        };
+
+        /**
+         * @brief Default Constructor
+         */
+        DynamicBitSet() noexcept : pWords(nullptr), bitCount(0), capacity(0)
+        {
+        }
+
+        /**
+         * @brief Constructor with a start size and value for every bit
+         */
+        explicit DynamicBitSet(const ::Size count, const bool val = false) : DynamicBitSet()
+        {
+            Resize(count, val);
+        }
+
+        /**
+         * @brief Constructor that generates a bitset from a string of '0' and '1'. As in BitSet, the last character
+         * is bit 0, while ToString writes bit 0 first. A template so a literal 0 picks the size constructor instead
+         * of being ambiguous with a null string
+         */
+        template<typename Char, typename = EnableIfT<std::is_same_v<Char, char>>>
+        explicit DynamicBitSet(const Char* str) : DynamicBitSet()
+        {
+            const ::Size length = std::char_traits<char>::length(str);
+            Resize(length);
+            for (::Size i = 0; i < length; i++)
+            {
+                const char c = str[length - 1 - i];
+                if (c != '0' && c != '1') throw std::invalid_argument("Invalid Bitset Character");
+                if (c == '1') (*this)[i] = true;
+            }
+        }
+
+        /**
+         * @brief Copy Constructor
+         */
+        DynamicBitSet(const DynamicBitSet& other) : DynamicBitSet()
+        {
+            Reserve(other.bitCount);
+            for (::Size i = 0; i < other.WordCount(); i++) pWords[i] = other.pWords[i];
+            bitCount = other.bitCount;
+        }
+
+        /**
+         * @brief Move Constructor
+         */
+        DynamicBitSet(DynamicBitSet&& other) noexcept : pWords(other.pWords), bitCount(other.bitCount),
+                                                        capacity(other.capacity)
+        {
+            other.pWords = nullptr;
+            other.bitCount = 0;
+            other.capacity = 0;
+        }
+
+        /**
+         * @brief Destructor
+         */
+        ~DynamicBitSet()
+        {
+            Allocator::Deallocate(&pWords);
+        }
+
+        /**
+         * @brief Copy Assignment Operator
+         */
+        DynamicBitSet& operator=(const DynamicBitSet& other)
+        {
+            if (this == &other) return *this;
+
+            DynamicBitSet copy(other);
+            Swap(copy);
+            return *this;
+        }
+
+        /**
+         * @brief Move Assignment Operator
+         */
+        DynamicBitSet& operator=(DynamicBitSet&& other) noexcept
+        {
+            DynamicBitSet moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * @brief Returns if the bit at the specified position is Set (1)
+         */
+        [[nodiscard]]
+        bool operator[](const ::Size pos) const
+        {
+            Validate(pos);
+            return Subscript(pos);
+        }
+
+        /**
+         * @brief Returns a bit reference to the specified position
+         */
+        [[nodiscard]]
+        BitReference operator[](const ::Size pos)
+        {
+            Validate(pos);
+            return Reference(pos);
+        }
+
+        /**
+         * @brief Runs a bitwise AND operation on the two BitSets, they have to be the same size
+         */
+        DynamicBitSet& operator&=(const DynamicBitSet& other)
+        {
+            ValidateSize(other);
+            BitKernels::And(pWords, pWords, other.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Runs a bitwise OR operation on the two BitSets, they have to be the same size
+         */
+        DynamicBitSet& operator|=(const DynamicBitSet& other)
+        {
+            ValidateSize(other);
+            BitKernels::Or(pWords, pWords, other.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Runs a bitwise XOR operation on the two BitSets, they have to be the same size
+         */
+        DynamicBitSet& operator^=(const DynamicBitSet& other)
+        {
+            ValidateSize(other);
+            BitKernels::Xor(pWords, pWords, other.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Clears every bit that is Set (1) in other, same as &= ~other without the temporary
+         */
+        DynamicBitSet& AndNot(const DynamicBitSet& other)
+        {
+            ValidateSize(other);
+            BitKernels::AndNot(pWords, pWords, other.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Stores a & ~b in this BitSet, resizing it to their size
+         */
+        DynamicBitSet& AndNot(const DynamicBitSet& a, const DynamicBitSet& b)
+        {
+            a.ValidateSize(b);
+            Resize(a.bitCount);
+            BitKernels::AndNot(pWords, a.pWords, b.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Stores a & b in this BitSet, resizing it to their size
+         */
+        DynamicBitSet& AndWith(const DynamicBitSet& a, const DynamicBitSet& b)
+        {
+            a.ValidateSize(b);
+            Resize(a.bitCount);
+            BitKernels::And(pWords, a.pWords, b.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Stores a | b in this BitSet, resizing it to their size
+         */
+        DynamicBitSet& OrWith(const DynamicBitSet& a, const DynamicBitSet& b)
+        {
+            a.ValidateSize(b);
+            Resize(a.bitCount);
+            BitKernels::Or(pWords, a.pWords, b.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Stores a ^ b in this BitSet, resizing it to their size
+         */
+        DynamicBitSet& XorWith(const DynamicBitSet& a, const DynamicBitSet& b)
+        {
+            a.ValidateSize(b);
+            Resize(a.bitCount);
+            BitKernels::Xor(pWords, a.pWords, b.pWords, WordCount());
+            return *this;
+        }
+
+        /**
+         * @brief Shifts the BitSet to the left by the specified amount
+         */
+        DynamicBitSet& operator<<=(const ::Size shift) noexcept
+        {
+            BitKernels::ShiftLeft(pWords, pWords, WordCount(), shift);
+            Trim();
+            return *this;
+        }
+
+        /**
+         * @brief Shifts the BitSet to the right by the specified amount
+         */
+        DynamicBitSet& operator>>=(const ::Size shift) noexcept
+        {
+            BitKernels::ShiftRight(pWords, pWords, WordCount(), shift);
+            return *this;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator~() const
+        {
+            DynamicBitSet result(bitCount);
+            BitKernels::Not(result.pWords, pWords, WordCount());
+            result.Trim();
+            return result;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator&(const DynamicBitSet& other) const
+        {
+            DynamicBitSet result;
+            result.AndWith(*this, other);
+            return result;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator|(const DynamicBitSet& other) const
+        {
+            DynamicBitSet result;
+            result.OrWith(*this, other);
+            return result;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator^(const DynamicBitSet& other) const
+        {
+            DynamicBitSet result;
+            result.XorWith(*this, other);
+            return result;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator<<(const ::Size shift) const
+        {
+            DynamicBitSet result(bitCount);
+            BitKernels::ShiftLeft(result.pWords, pWords, WordCount(), shift);
+            result.Trim();
+            return result;
+        }
+
+        [[nodiscard]]
+        DynamicBitSet operator>>(const ::Size shift) const
+        {
+            DynamicBitSet result(bitCount);
+            BitKernels::ShiftRight(result.pWords, pWords, WordCount(), shift);
+            return result;
+        }
+
+        [[nodiscard]]
+        bool operator==(const DynamicBitSet& other) const noexcept
+        {
+            if (bitCount != other.bitCount) return false;
+
+            for (::Size i = 0; i < WordCount(); i++)
+            {
+                if (pWords[i] != other.pWords[i]) return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]]
+        bool operator!=(const DynamicBitSet& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Sets all bits to 1
+         */
+        DynamicBitSet& Set() noexcept
+        {
+            for (::Size i = 0; i < WordCount(); i++) pWords[i] = ~Word{0};
+            Trim();
+            return *this;
+        }
+
+        /**
+         * @brief Sets the bit at the specified position to the specified value
+         */
+        DynamicBitSet& Set(const ::Size pos, const bool val = true)
+        {
+            Validate(pos);
+            Reference(pos) = val;
+            return *this;
+        }
+
+        /**
+         * @brief Sets all bits to 0
+         */
+        DynamicBitSet& Reset() noexcept
+        {
+            for (::Size i = 0; i < WordCount(); i++) pWords[i] = 0;
+            return *this;
+        }
+
+        /**
+         * @brief Set bit at the specified position to 0
+         */
+        DynamicBitSet& Reset(const ::Size pos)
+        {
+            return Set(pos, false);
+        }
+
+        /**
+         * @brief Flips all bits
+         */
+        DynamicBitSet& Flip() noexcept
+        {
+            BitKernels::Not(pWords, pWords, WordCount());
+            Trim();
+            return *this;
+        }
+
+        /**
+         * @brief Flips the bit at the specified position
+         */
+        DynamicBitSet& Flip(const ::Size pos)
+        {
+            Validate(pos);
+            Reference(pos).flip();
+            return *this;
+        }
+
+        /**
+         * @brief Returns true if at least one bit is Set (1)
+         */
+        [[nodiscard]]
+        bool Any() const noexcept
+        {
+            return BitKernels::Any(pWords, WordCount());
+        }
+
+        /**
+         * @brief Returns true if no bits are Set (1)
+         */
+        [[nodiscard]]
+        bool None() const noexcept
+        {
+            return !Any();
+        }
+
+        /**
+         * @brief Returns true if all bits are Set (1), which includes the empty BitSet
+         */
+        [[nodiscard]]
+        bool All() const noexcept
+        {
+            const ::Size fullWords = bitCount / BitsPerWord;
+            if (!BitKernels::All(pWords, fullWords)) return false;
+
+            return bitCount % BitsPerWord == 0 || pWords[fullWords] == LastWordMask();
+        }
+
+        /**
+         * @brief Returns the number of bits that are Set (1)
+         */
+        [[nodiscard]]
+        ::Size Count() const noexcept
+        {
+            return BitKernels::Count(pWords, WordCount());
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        ::Size FindFirst() const noexcept
+        {
+            return FindFrom(0);
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit after pos, or Size() if there is none
+         */
+        [[nodiscard]]
+        ::Size FindNext(const ::Size pos) const noexcept
+        {
+            return pos + 1 >= bitCount ? bitCount : FindFrom(pos + 1);
+        }
+
+        /**
+         * @brief Returns the position of the last Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        ::Size FindLast() const noexcept
+        {
+            for (::Size i = WordCount(); i > 0; i--)
+            {
+                if (pWords[i - 1] != 0) return i * BitsPerWord - 1 - CountLeadingZeros(pWords[i - 1]);
+            }
+            return bitCount;
+        }
+
+        /**
+         * @brief Calls function with the position of every Set (1) bit, in increasing order
+         */
+        template <class Function>
+        void ForEachSetBit(Function&& function) const
+        {
+            for (::Size i = 0; i < WordCount(); i++)
+            {
+                for (Word word = pWords[i]; word != 0; word &= word - 1)
+                {
+                    function(i * BitsPerWord + CountTrailingZeros(word));
+                }
+            }
+        }
+
+        /**
+         * @brief Returns a range over the positions of the Set (1) bits, for (auto pos : bitSet.SetBits())
+         */
+        [[nodiscard]]
+        SetBitRange SetBits() const noexcept
+        {
+            return SetBitRange{this};
+        }
+
+        /**
+         * @brief Returns the bit at the specified position
+         */
+        [[nodiscard]]
+        bool At(const ::Size pos) const
+        {
+            return (*this)[pos];
+        }
+
+        /**
+         * @brief Returns the first bit
+         */
+        [[nodiscard]]
+        bool Front() const
+        {
+            return (*this)[0];
+        }
+
+        /**
+         * @brief Returns the last bit
+         */
+        [[nodiscard]]
+        bool Back() const
+        {
+            if (bitCount == 0) throw std::out_of_range("DynamicBitSet::Back: BitSet is empty");
+            return Subscript(bitCount - 1);
+        }
+
+        /**
+         * @brief Appends a bit
+         */
+        void PushBack(const bool val)
+        {
+            if (bitCount == capacity * BitsPerWord) Grow(bitCount + 1);
+
+            if (bitCount % BitsPerWord == 0) pWords[bitCount / BitsPerWord] = 0;
+            bitCount++;
+            Reference(bitCount - 1) = val;
+        }
+
+        /**
+         * @brief Removes the last bit
+         */
+        void PopBack()
+        {
+            if (bitCount == 0) throw std::out_of_range("DynamicBitSet::PopBack: BitSet is empty");
+
+            Reference(bitCount - 1) = false;
+            bitCount--;
+        }
+
+        /**
+         * @brief Resizes the BitSet, new bits are set to val
+         */
+        void Resize(const ::Size count, const bool val = false)
+        {
+            if (count <= bitCount)
+            {
+                bitCount = count;
+                Trim();
+                return;
+            }
+
+            if (count > capacity * BitsPerWord) Grow(count);
+
+            const ::Size oldWordCount = WordCount();
+            if (val && bitCount % BitsPerWord != 0) pWords[oldWordCount - 1] |= ~LastWordMask();
+
+            const ::Size newWordCount = (count + BitsPerWord - 1) / BitsPerWord;
+            for (::Size i = oldWordCount; i < newWordCount; i++) pWords[i] = val ? ~Word{0} : 0;
+
+            bitCount = count;
+            Trim();
+        }
+
+        /**
+         * @brief Makes room for at least count bits without changing the size
+         */
+        void Reserve(const ::Size count)
+        {
+            if (count > capacity * BitsPerWord) Reallocate((count + BitsPerWord - 1) / BitsPerWord);
+        }
+
+        /**
+         * @brief Removes every bit, keeps the memory
+         */
+        void Clear() noexcept
+        {
+            bitCount = 0;
+        }
+
+        /**
+         * @brief Releases the memory that is not needed for the current size
+         */
+        void ShrinkToFit()
+        {
+            if (WordCount() < capacity) Reallocate(WordCount());
+        }
+
+        /**
+         * @brief Swaps the contents with another BitSet
+         */
+        void Swap(DynamicBitSet& other) noexcept
+        {
+            std::swap(pWords, other.pWords);
+            std::swap(bitCount, other.bitCount);
+            std::swap(capacity, other.capacity);
+        }
+
+        /**
+         * @brief Returns the size of the BitSet
+         */
+        [[nodiscard]]
+        ::Size Size() const noexcept
+        {
+            return bitCount;
+        }
+
+        /**
+         * @brief Returns whether the BitSet is empty
+         */
+        [[nodiscard]]
+        bool IsEmpty() const noexcept
+        {
+            return bitCount == 0;
+        }
+
+        /**
+         * @brief Returns how many bits fit without reallocating
+         */
+        [[nodiscard]]
+        ::Size Capacity() const noexcept
+        {
+            return capacity * BitsPerWord;
+        }
+
+        /**
+         * @brief Returns the number of words in use
+         */
+        [[nodiscard]]
+        ::Size WordCount() const noexcept
+        {
+            return (bitCount + BitsPerWord - 1) / BitsPerWord;
+        }
+
+        /**
+         * @brief Returns the word at the specified position
+         */
+        [[nodiscard]]
+        Word GetWord(const ::Size pos) const noexcept
+        {
+            return pWords[pos];
+        }
+
+        /**
+         * @brief Returns the packed words, bits past Size() in the last word are always 0
+         */
+        [[nodiscard]]
+        const Word* Data() const noexcept
+        {
+            return pWords;
+        }
+
+        /**
+         * @brief Returns the packed words for direct writes, bits past Size() in the last word have to stay 0
+         */
+        [[nodiscard]]
+        Word* Data() noexcept
+        {
+            return pWords;
+        }
+
+        /**
+         * @brief Validates the index. Throws std::out_of_range if index is out of range
+         */
+        void Validate(const ::Size pos) const
+        {
+            if (pos >= bitCount) throw std::out_of_range("DynamicBitSet::Validate: Index out of range");
+        }
+
+        /**
+         * @brief Checks if the bit at the specified position is Set (1)
+         */
+        [[nodiscard]]
+        bool Subscript(const ::Size pos) const noexcept
+        {
+            return (pWords[pos / BitsPerWord] >> (pos % BitsPerWord) & 1) != 0;
+        }
+
+        /**
+         * @brief Returns the string representation of the BitSet
+         */
+        [[nodiscard]]
+        std::string ToString() const
+        {
+            std::string str;
+            str.reserve(bitCount);
+            for (::Size i = 0; i < bitCount; i++) str.push_back(Subscript(i) ? '1' : '0');
+            return str;
+        }
+
+        Iterator begin() noexcept
+        {
+            return Iterator(this, 0);
+        }
+
+        Iterator end() noexcept
+        {
+            return Iterator(this, bitCount);
+        }
+
+        ConstIterator begin() const noexcept
+        {
+            return ConstIterator(this, 0);
+        }
+
+        ConstIterator end() const noexcept
+        {
+            return ConstIterator(this, bitCount);
+        }
+
+    private:
+        static constexpr ::Size BitsPerWord = 64;
+
+        BitReference Reference(const ::Size pos) noexcept
+        {
+            return BitReference(&pWords[pos / BitsPerWord], Word{1} << (pos % BitsPerWord));
+        }
+
+        Word LastWordMask() const noexcept
+        {
+            return (Word{1} << (bitCount % BitsPerWord)) - 1;
+        }
+
+        void ValidateSize(const DynamicBitSet& other) const
+        {
+            if (bitCount != other.bitCount)
+                throw std::invalid_argument("DynamicBitSet: BitSets have different sizes");
+        }
+
+        ::Size FindFrom(const ::Size pos) const noexcept
+        {
+            if (pos >= bitCount) return bitCount;
+
+            ::Size i = pos / BitsPerWord;
+            Word word = pWords[i] & (~Word{0} << (pos % BitsPerWord));
+            while (word == 0)
+            {
+                if (++i == WordCount()) return bitCount;
+                word = pWords[i];
+            }
+            return i * BitsPerWord + CountTrailingZeros(word);
+        }
+
+        /**
+         * @brief Clears the bits past the size in the last word
+         */
+        void Trim() noexcept
+        {
+            if (bitCount % BitsPerWord != 0) pWords[bitCount / BitsPerWord] &= LastWordMask();
+        }
+
+        /**
+         * @brief Reallocates for at least count bits, doubling the capacity like Vector does
+         */
+        void Grow(const ::Size count)
+        {
+            const ::Size words = (count + BitsPerWord - 1) / BitsPerWord;
+            Reallocate(words > capacity * 2 ? words : capacity * 2);
+        }
+
+        void Reallocate(const ::Size words)
+        {
+            Word* pNewWords = words == 0 ? nullptr
+                : Allocator::AllocateAligned<Word>(words * sizeof(Word), SystemCacheLineSize);
+            for (::Size i = 0; i < WordCount(); i++) pNewWords[i] = pWords[i];
+
+            Allocator::Deallocate(&pWords);
+            pWords = pNewWords;
+            capacity = words;
+        }
+
+        Word* pWords;
+        ::Size bitCount;
+        ::Size capacity;
+    };
+}
@@ -0,0 +1,377 @@
+#pragma once
+#include <stdexcept>
+#include <utility>
+
+#include "WSTL/algorithms/Search.hpp"
+#include "WSTL/algorithms/Sort.hpp"
+#include "WSTL/containers/Map.hpp"
+#include "WSTL/containers/Pair.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+namespace WSTL
+{
+    namespace FlatInternal
+    {
+        /**
+         * \brief Returns if every key is less than the next one, so the keys can be used as they are
+         */
+        template<typename Key>
+        bool IsStrictlySorted(const Vector<Key>& keys)
+        {
+            for(Size i = 1; i < keys.Size(); i++)
+            {
+                if(!(keys[i - 1] < keys[i])) return false;
+            }
+            return true;
+        }
+
+        /**
+         * \brief Returns the positions of the keys in sorted order, keeping only the first of equal keys
+         */
+        template<typename Key>
+        Vector<Size> SortedUniqueOrder(const Vector<Key>& keys)
+        {
+            Vector<Size> order(keys.Size());
+            for(Size i = 0; i < order.Size(); i++) order[i] = i;
+
+            const Key* pKeys = keys.Data();
+            StableSort(order, [pKeys](Size a, Size b) { return pKeys[a] < pKeys[b]; });
+
+            Size kept = 0;
+            for(Size i = 0; i < order.Size(); i++)
+            {
+                if(kept != 0 && !(pKeys[order[kept - 1]] < pKeys[order[i]])) continue;
+                order[kept++] = order[i];
+            }
+            order.Resize(kept);
+            return order;
+        }
+    }
+
+    /**
+     * \brief Sorted associative container for data that is built once and then mostly read. Keys and values live in
+     * two parallel Vectors, so a lookup is a branchless binary search over contiguous keys instead of a walk
+     * through tree nodes. Inserting or erasing a single entry is O(n)
+     */
+    template<typename Key, typename Value>
+    class FlatMap
+    {
+        typedef FlatMap<Key, Value> Self;
+
+    public:
+        /**
+         * \brief Default constructor
+         */
+        FlatMap() = default;
+
+        /**
+         * \brief Constructor from unsorted keys and their values in O(n log n). For equal keys the first one wins,
+         * like Map::Insert. Throws std::invalid_argument if the sizes differ
+         */
+        FlatMap(Vector<Key> keys, Vector<Value> values) : keys(std::move(keys)), values(std::move(values))
+        {
+            if(this->keys.Size() != this->values.Size())
+                throw std::invalid_argument("FlatMap: keys and values have different sizes");
+
+            if(FlatInternal::IsStrictlySorted(this->keys)) return;
+
+            const Vector<::Size> order = FlatInternal::SortedUniqueOrder(this->keys);
+            Vector<Key> sortedKeys(order.Size());
+            Vector<Value> sortedValues(order.Size());
+            for(::Size i = 0; i < order.Size(); i++)
+            {
+                sortedKeys[i] = std::move(this->keys[order[i]]);
+                sortedValues[i] = std::move(this->values[order[i]]);
+            }
+            this->keys.Swap(sortedKeys);
+            this->values.Swap(sortedValues);
+        }
+
+        /**
+         * \brief Constructor from a Map in O(n), its keys already come out sorted
+         */
+        explicit FlatMap(const Map<Key, Value>& map) : keys(map.GetKeys()), values(map.GetValues())
+        {
+        }
+
+        /**
+         * \brief Copy constructor
+         */
+        FlatMap(const Self& other) : keys(other.keys), values(other.values)
+        {
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        FlatMap(Self&& other) noexcept : keys(std::move(other.keys)), values(std::move(other.values))
+        {
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~FlatMap() = default;
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            keys = other.keys;
+            values = other.values;
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            keys.Swap(other.keys);
+            values.Swap(other.values);
+            other.Clear();
+            return *this;
+        }
+
+        /**
+         * \brief Returns a Map with the same entries, built in O(n) from the sorted keys
+         */
+        Map<Key, Value> ToMap() const
+        {
+            Map<Key, Value> map;
+            map.tree.AssignSorted(keys.Data(), values.Data(), keys.Size());
+            return map;
+        }
+
+        /**
+         * \brief Returns the size of the container
+         */
+        ::Size Size() const noexcept
+        {
+            return keys.Size();
+        }
+
+        /**
+         * \brief Returns whether the container is empty
+         */
+        bool IsEmpty() const noexcept
+        {
+            return keys.IsEmpty();
+        }
+
+        /**
+         * \brief Removes all entries from the container
+         */
+        void Clear()
+        {
+            keys.Clear();
+            values.Clear();
+        }
+
+        /**
+         * \brief Reserves space for count entries
+         */
+        void Reserve(::Size count)
+        {
+            if(count <= keys.Capacity()) return;
+            keys.SetCapacity(count);
+            values.SetCapacity(count);
+        }
+
+        /**
+         * \brief Returns the index of the first key not less than key, or Size()
+         */
+        ::Size LowerBound(const Key& key) const
+        {
+            return static_cast<::Size>(WSTL::LowerBound(keys.Data(), keys.Data() + keys.Size(), key) - keys.Data());
+        }
+
+        /**
+         * \brief Returns the index of the first key greater than key, or Size()
+         */
+        ::Size UpperBound(const Key& key) const
+        {
+            return static_cast<::Size>(WSTL::UpperBound(keys.Data(), keys.Data() + keys.Size(), key) - keys.Data());
+        }
+
+        /**
+         * \brief Returns the [first, second) index range of the entries with the key, empty if there is none
+         */
+        Pair<::Size, ::Size> EqualRange(const Key& key) const
+        {
+            const ::Size lower = LowerBound(key);
+            return Pair<::Size, ::Size>(lower, lower + (lower < Size() && !(key < keys[lower])));
+        }
+
+        /**
+         * \brief Returns the index of the key, or Size() if it is not in the container
+         */
+        ::Size IndexOf(const Key& key) const
+        {
+            const ::Size index = LowerBound(key);
+            return index < Size() && !(key < keys[index]) ? index : Size();
+        }
+
+        /**
+         * \brief Returns whether the container contains the given key
+         */
+        bool Contains(const Key& key) const
+        {
+            return IndexOf(key) != Size();
+        }
+
+        /**
+         * \brief Returns a pointer to the value associated with the given key, or nullptr
+         */
+        Value* Find(const Key& key)
+        {
+            const ::Size index = IndexOf(key);
+            return index == Size() ? nullptr : &values[index];
+        }
+
+        const Value* Find(const Key& key) const
+        {
+            const ::Size index = IndexOf(key);
+            return index == Size() ? nullptr : &values[index];
+        }
+
+        /**
+         * \brief Returns the value associated with the given key. Throws std::out_of_range if it doesn't exist
+         */
+        Value& Get(const Key& key)
+        {
+            Value* pValue = Find(key);
+            if(pValue == nullptr) throw std::out_of_range("Key not found");
+            return *pValue;
+        }
+
+        const Value& Get(const Key& key) const
+        {
+            const Value* pValue = Find(key);
+            if(pValue == nullptr) throw std::out_of_range("Key not found");
+            return *pValue;
+        }
+
+        Value& At(const Key& key)
+        {
+            return Get(key);
+        }
+
+        const Value& At(const Key& key) const
+        {
+            return Get(key);
+        }
+
+        /**
+         * \brief Returns the value associated with the given key. If the key doesn't exist, it will be created
+         */
+        Value& operator[](const Key& key)
+        {
+            const ::Size index = LowerBound(key);
+            if(index < Size() && !(key < keys[index])) return values[index];
+            return values[InsertAt(index, key, Value())];
+        }
+
+        /**
+         * \brief Inserts a new entry, returns false and keeps the old value if the key already exists
+         */
+        bool Insert(const Key& key, const Value& value)
+        {
+            const ::Size index = LowerBound(key);
+            if(index < Size() && !(key < keys[index])) return false;
+            InsertAt(index, key, value);
+            return true;
+        }
+
+        /**
+         * \brief Removes the entry with the key, returns whether it existed
+         */
+        bool Erase(const Key& key)
+        {
+            const ::Size index = IndexOf(key);
+            if(index == Size()) return false;
+            keys.Erase(index);
+            values.Erase(index);
+            return true;
+        }
+
+        bool Remove(const Key& key)
+        {
+            return Erase(key);
+        }
+
+        /**
+         * \brief Returns the key at the given position in sorted order
+         */
+        const Key& KeyAt(::Size index) const
+        {
+            return keys[index];
+        }
+
+        /**
+         * \brief Returns the value at the given position in sorted order
+         */
+        Value& ValueAt(::Size index)
+        {
+            return values[index];
+        }
+
+        const Value& ValueAt(::Size index) const
+        {
+            return values[index];
+        }
+
+        /**
+         * \brief Returns the sorted keys
+         */
+        const Vector<Key>& GetKeys() const noexcept
+        {
+            return keys;
+        }
+
+        /**
+         * \brief Returns the values, in the order of their keys
+         */
+        const Vector<Value>& GetValues() const noexcept
+        {
+            return values;
+        }
+
+        /**
+         * \brief Calls function(key, value) for every entry in key order
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            for(::Size i = 0; i < Size(); i++) function(keys[i], values[i]);
+        }
+
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(::Size i = 0; i < Size(); i++) function(keys[i], values[i]);
+        }
+
+    private:
+        ::Size InsertAt(::Size index, const Key& key, const Value& value)
+        {
+            if(index == Size())
+            {
+                keys.PushBack(key);
+                values.PushBack(value);
+            }
+            else
+            {
+                keys.Insert(index, key);
+                values.Insert(index, value);
+            }
+            return index;
+        }
+
+        Vector<Key> keys;
+        Vector<Value> values;
+    };
+}
@@ -0,0 +1,243 @@
+#pragma once
+#include <utility>
+
+#include "WSTL/algorithms/Search.hpp"
+#include "WSTL/containers/FlatMap.hpp"
+#include "WSTL/containers/Pair.hpp"
+#include "WSTL/containers/Set.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Sorted set over a single Vector, for data that is built once and then mostly read. Lookups are
+     * branchless binary searches, inserting or erasing a single value is O(n)
+     */
+    template<typename Key>
+    class FlatSet
+    {
+        typedef FlatSet<Key> Self;
+
+    public:
+        /**
+         * \brief Default constructor
+         */
+        FlatSet() = default;
+
+        /**
+         * \brief Constructor from unsorted values in O(n log n), duplicates are dropped
+         */
+        explicit FlatSet(Vector<Key> values) : keys(std::move(values))
+        {
+            if(FlatInternal::IsStrictlySorted(keys)) return;
+
+            StableSort(keys);
+            ::Size kept = 0;
+            for(::Size i = 0; i < keys.Size(); i++)
+            {
+                if(kept != 0 && !(keys[kept - 1] < keys[i])) continue;
+                if(kept != i) keys[kept] = std::move(keys[i]);
+                kept++;
+            }
+            keys.Resize(kept);
+        }
+
+        /**
+         * \brief Constructor from a Set in O(n)
+         */
+        explicit FlatSet(const Set<Key>& set) : keys(set.GetKeys())
+        {
+        }
+
+        /**
+         * \brief Copy constructor
+         */
+        FlatSet(const Self& other) : keys(other.keys)
+        {
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        FlatSet(Self&& other) noexcept : keys(std::move(other.keys))
+        {
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~FlatSet() = default;
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            keys = other.keys;
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            keys.Swap(other.keys);
+            other.Clear();
+            return *this;
+        }
+
+        /**
+         * \brief Returns a Set with the same values, built in O(n) from the sorted keys
+         */
+        Set<Key> ToSet() const
+        {
+            Set<Key> set;
+            set.tree.AssignSorted(keys.Data(), nullptr, keys.Size());
+            return set;
+        }
+
+        /**
+         * \brief Returns size of the set
+         */
+        ::Size Size() const noexcept
+        {
+            return keys.Size();
+        }
+
+        /**
+         * \brief Checks if set is empty
+         */
+        bool IsEmpty() const noexcept
+        {
+            return keys.IsEmpty();
+        }
+
+        /**
+         * \brief Clears the set
+         */
+        void Clear()
+        {
+            keys.Clear();
+        }
+
+        /**
+         * \brief Reserves space for count values
+         */
+        void Reserve(::Size count)
+        {
+            if(count > keys.Capacity()) keys.SetCapacity(count);
+        }
+
+        /**
+         * \brief Returns the index of the first value not less than key, or Size()
+         */
+        ::Size LowerBound(const Key& key) const
+        {
+            return static_cast<::Size>(WSTL::LowerBound(keys.Data(), keys.Data() + keys.Size(), key) - keys.Data());
+        }
+
+        /**
+         * \brief Returns the index of the first value greater than key, or Size()
+         */
+        ::Size UpperBound(const Key& key) const
+        {
+            return static_cast<::Size>(WSTL::UpperBound(keys.Data(), keys.Data() + keys.Size(), key) - keys.Data());
+        }
+
+        /**
+         * \brief Returns the [first, second) index range of the values equal to key, empty if there is none
+         */
+        Pair<::Size, ::Size> EqualRange(const Key& key) const
+        {
+            const ::Size lower = LowerBound(key);
+            return Pair<::Size, ::Size>(lower, lower + (lower < Size() && !(key < keys[lower])));
+        }
+
+        /**
+         * \brief Returns the index of the value, or Size() if it is not in the set
+         */
+        ::Size IndexOf(const Key& key) const
+        {
+            const ::Size index = LowerBound(key);
+            return index < Size() && !(key < keys[index]) ? index : Size();
+        }
+
+        /**
+         * \brief Checks if set contains specified value
+         */
+        bool Contains(const Key& key) const
+        {
+            return IndexOf(key) != Size();
+        }
+
+        /**
+         * \brief Inserts a value, returns false if it was already in the set
+         */
+        bool Insert(const Key& key)
+        {
+            const ::Size index = LowerBound(key);
+            if(index < Size() && !(key < keys[index])) return false;
+
+            if(index == Size()) keys.PushBack(key);
+            else keys.Insert(index, key);
+            return true;
+        }
+
+        /**
+         * \brief Erases a value, returns whether it was in the set
+         */
+        bool Erase(const Key& key)
+        {
+            const ::Size index = IndexOf(key);
+            if(index == Size()) return false;
+            keys.Erase(index);
+            return true;
+        }
+
+        bool Remove(const Key& key)
+        {
+            return Erase(key);
+        }
+
+        /**
+         * \brief Returns value at specified index in ascending order
+         */
+        const Key& operator[](::Size index) const
+        {
+            return keys[index];
+        }
+
+        /**
+         * \brief Returns value at specified index. Throws std::out_of_range if index is out of range
+         */
+        const Key& At(::Size index) const
+        {
+            if(index >= Size()) throw std::out_of_range("Index out of range");
+            return keys[index];
+        }
+
+        /**
+         * \brief Returns the values in ascending order
+         */
+        const Vector<Key>& ToVector() const noexcept
+        {
+            return keys;
+        }
+
+        const Key* begin() const noexcept
+        {
+            return keys.Data();
+        }
+
+        const Key* end() const noexcept
+        {
+            return keys.Data() + keys.Size();
+        }
+
+    private:
+        Vector<Key> keys;
+    };
+}
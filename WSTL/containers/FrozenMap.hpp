@@ -0,0 +1,287 @@
+#pragma once
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Span.hpp"
+#include "WSTL/utility/Hash.hpp"
+
+namespace WSTL
+{
+    namespace FrozenMapInternal
+    {
+        template<typename T>
+        inline constexpr bool AlwaysFalse = false;
+
+        /**
+         * \brief Hash of a key usable in constant expressions: the Hash() member of keys like StringView and
+         * HashedName, or the mixed value of integral and enum keys
+         */
+        template<typename Key>
+        constexpr UI32 KeyHash(const Key& key) noexcept
+        {
+            if constexpr(HasCustomHash<Key>::value)
+            {
+                return static_cast<UI32>(key.Hash());
+            }
+            else if constexpr(std::is_integral_v<Key> || std::is_enum_v<Key>)
+            {
+                UI64 value = static_cast<UI64>(key);
+                value ^= value >> 33;
+                value *= 0xff51afd7ed558ccdULL;
+                value ^= value >> 33;
+                value *= 0xc4ceb9fe1a85ec53ULL;
+                value ^= value >> 33;
+                return static_cast<UI32>(value);
+            }
+            else
+            {
+                static_assert(AlwaysFalse<Key>, "FrozenMap keys need a constexpr Hash() member or an integral type");
+                return 0;
+            }
+        }
+
+        /**
+         * \brief Second level hash, picks one of count slots from the hash of a key and the displacement of its
+         * bucket. The hash is already mixed, so one multiply scatters it, and the high half of the product with count
+         * selects the slot without a division
+         */
+        constexpr ::Size Displace(UI32 hash, UI32 displacement, ::Size count) noexcept
+        {
+            const UI32 mixed = (hash ^ displacement) * 0x9e3779b9u;
+            return static_cast<::Size>((static_cast<UI64>(mixed) * count) >> 32);
+        }
+    }
+
+    /**
+     * \brief Immutable map of N entries known up front, laid out with a minimal perfect hash (hash and displace):
+     * keys are split into buckets by hash, and each bucket stores the displacement that sends its keys to free slots,
+     * or the slot itself when it holds a single key. A lookup is one hash of the key, one read of the displacement and
+     * one key compare. Construction is constexpr, so a constexpr FrozenMap is built by the compiler and costs nothing
+     * at runtime. Keys need a constexpr Hash() member (StringView, HashedName) or an integral type
+     */
+    template<typename Key, typename Value, ::Size N>
+    class FrozenMap
+    {
+        static_assert(N > 0, "FrozenMap needs at least one entry");
+        static_assert(N < 0x7FFFFFFF, "FrozenMap slots are indexed with 32 bits");
+
+    public:
+        /**
+         * \brief A key and its value, as given to the constructor
+         */
+        struct Entry
+        {
+            Key key;
+            Value value;
+        };
+
+        /**
+         * \brief Number of displacement buckets, two keys per bucket on average
+         */
+        static constexpr ::Size BucketCount = (N + 1) / 2;
+
+        /**
+         * \brief Constructor from exactly N entries. Throws std::invalid_argument if the count is wrong, if a key is
+         * repeated or if two keys have the same hash, which is a compile error for a constexpr map
+         */
+        constexpr FrozenMap(std::initializer_list<Entry> entries) : keys{}, values{}, displacements{}
+        {
+            if(entries.size() != N) throw std::invalid_argument("FrozenMap: entry count doesn't match N");
+            Build(entries.begin());
+        }
+
+        constexpr FrozenMap(const Entry (&entries)[N]) : keys{}, values{}, displacements{}
+        {
+            Build(entries);
+        }
+
+        /**
+         * \brief Returns the number of entries
+         */
+        constexpr ::Size Size() const noexcept
+        {
+            return N;
+        }
+
+        /**
+         * \brief Returns the value of key, or nullptr if key isn't in the map
+         */
+        constexpr const Value* Find(const Key& key) const noexcept
+        {
+            const ::Size slot = SlotOf(key);
+            return keys[slot] == key ? &values[slot] : nullptr;
+        }
+
+        constexpr bool Contains(const Key& key) const noexcept
+        {
+            return Find(key) != nullptr;
+        }
+
+        /**
+         * \brief Returns the value of key. Throws std::out_of_range if key isn't in the map
+         */
+        constexpr const Value& At(const Key& key) const
+        {
+            const Value* pValue = Find(key);
+            if(pValue == nullptr) throw std::out_of_range("FrozenMap::At: key not found");
+            return *pValue;
+        }
+
+        constexpr const Value& operator[](const Key& key) const
+        {
+            return At(key);
+        }
+
+        /**
+         * \brief Returns the keys in slot order, Values() holds their values at the same positions
+         */
+        constexpr Span<const Key> Keys() const noexcept
+        {
+            return Span<const Key>(keys, N);
+        }
+
+        constexpr Span<const Value> Values() const noexcept
+        {
+            return Span<const Value>(values, N);
+        }
+
+        /**
+         * \brief Calls function(key, value) for every entry, in slot order
+         */
+        template<class Function>
+        constexpr void ForEach(Function function) const
+        {
+            for(::Size i = 0; i < N; i++) function(keys[i], values[i]);
+        }
+
+    private:
+        /**
+         * \brief Most displacements tried for one bucket before giving up
+         */
+        static constexpr UI32 MaxDisplacement = 1u << 20;
+
+        /**
+         * \brief Marks a bucket of one key, whose displacement is the slot of that key
+         */
+        static constexpr UI32 SlotFlag = 0x80000000u;
+
+        constexpr ::Size SlotOf(const Key& key) const noexcept
+        {
+            const UI32 hash = FrozenMapInternal::KeyHash(key);
+            const UI32 displacement = displacements[hash % BucketCount];
+            if(displacement & SlotFlag) return displacement & ~SlotFlag;
+            return FrozenMapInternal::Displace(hash, displacement, N);
+        }
+
+        /**
+         * \brief Places the entries, largest buckets first while the table is empty. Buckets of one key take the
+         * remaining free slots directly
+         */
+        constexpr void Build(const Entry* pEntries)
+        {
+            UI32 hashes[N] = {};
+            ::Size bucketSizes[BucketCount] = {};
+            ::Size largest = 0;
+            for(::Size i = 0; i < N; i++)
+            {
+                hashes[i] = FrozenMapInternal::KeyHash(pEntries[i].key);
+                const ::Size size = ++bucketSizes[hashes[i] % BucketCount];
+                if(size > largest) largest = size;
+            }
+
+            // Entry indices grouped by bucket, buckets ordered from largest to smallest
+            ::Size order[N] = {};
+            ::Size bucketStarts[BucketCount] = {};
+            ::Size bucketEnds[BucketCount] = {};
+            ::Size filled = 0;
+            for(::Size size = largest; size > 0; size--)
+            {
+                for(::Size bucket = 0; bucket < BucketCount; bucket++)
+                {
+                    if(bucketSizes[bucket] != size) continue;
+                    bucketStarts[bucket] = bucketEnds[bucket] = filled;
+                    filled += size;
+                }
+            }
+            for(::Size i = 0; i < N; i++) order[bucketEnds[hashes[i] % BucketCount]++] = i;
+
+            bool occupied[N] = {};
+            ::Size slots[N] = {};
+            ::Size nextFree = 0;
+            for(::Size position = 0; position < N;)
+            {
+                const ::Size bucket = hashes[order[position]] % BucketCount;
+                const ::Size size = bucketSizes[bucket];
+                const ::Size* pMembers = order + bucketStarts[bucket];
+
+                for(::Size i = 0; i < size; i++)
+                {
+                    for(::Size j = i + 1; j < size; j++)
+                    {
+                        if(hashes[pMembers[i]] != hashes[pMembers[j]]) continue;
+                        if(pEntries[pMembers[i]].key == pEntries[pMembers[j]].key)
+                            throw std::invalid_argument("FrozenMap: duplicate key");
+                        throw std::invalid_argument("FrozenMap: two keys have the same hash");
+                    }
+                }
+
+                if(size == 1)
+                {
+                    while(occupied[nextFree]) nextFree++;
+                    slots[pMembers[0]] = nextFree;
+                    occupied[nextFree] = true;
+                    displacements[bucket] = static_cast<UI32>(nextFree) | SlotFlag;
+                }
+                else displacements[bucket] = Displacement(hashes, pMembers, size, occupied, slots);
+                position += size;
+            }
+
+            for(::Size i = 0; i < N; i++)
+            {
+                keys[slots[i]] = pEntries[i].key;
+                values[slots[i]] = pEntries[i].value;
+            }
+        }
+
+        /**
+         * \brief Finds the first displacement that sends every member of a bucket to a distinct free slot, and claims
+         * those slots
+         */
+        static constexpr UI32 Displacement(const UI32* pHashes, const ::Size* pMembers, ::Size size, bool* pOccupied,
+                                           ::Size* pSlots)
+        {
+            for(UI32 displacement = 0; displacement < MaxDisplacement; displacement++)
+            {
+                bool fits = true;
+                for(::Size i = 0; i < size && fits; i++)
+                {
+                    const ::Size slot = FrozenMapInternal::Displace(pHashes[pMembers[i]], displacement, N);
+                    fits = !pOccupied[slot];
+                    for(::Size j = 0; j < i && fits; j++) fits = pSlots[pMembers[j]] != slot;
+                    pSlots[pMembers[i]] = slot;
+                }
+                if(!fits) continue;
+
+                for(::Size i = 0; i < size; i++) pOccupied[pSlots[pMembers[i]]] = true;
+                return displacement;
+            }
+            throw std::invalid_argument("FrozenMap: no displacement places a bucket");
+        }
+
+        Key keys[N];
+        Value values[N];
+        UI32 displacements[BucketCount];
+    };
+
+    /**
+     * \brief Builds a FrozenMap, deducing N from the number of entries:
+     * constexpr auto opcodes = MakeFrozenMap<StringView, int>({{"add", 0}, {"sub", 1}});
+     */
+    template<typename Key, typename Value, ::Size N>
+    constexpr FrozenMap<Key, Value, N> MakeFrozenMap(const typename FrozenMap<Key, Value, N>::Entry (&entries)[N])
+    {
+        return FrozenMap<Key, Value, N>(entries);
+    }
+}
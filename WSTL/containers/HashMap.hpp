@@ -2,16 +2,11 @@
 
 #include "WSTL/utility/Hash.hpp"
 
+#include "WSTL/containers/NodeHandle.hpp"
 #include "WSTL/containers/Vector.hpp"
 
 namespace WSTL
 {
-    template <typename T, typename = void>
-    struct HasCustomHash : FalseType {};
-
-    template <typename T>
-    struct HasCustomHash<T, std::void_t<decltype(std::declval<T>().Hash())>> : TrueType {};
-    
     template <typename Key, typename Value>
     class HashMap
     {
@@ -71,6 +66,8 @@ namespace WSTL
         };
 
     public:
+        using NodeType = NodeHandle<Node<Key, Value>>;
+
         /**
          * @brief Default Constructor
          */
@@ -81,14 +78,21 @@ namespace WSTL
          * @brief Copy Constructor
          */
         HashMap(const Self& other)
-            : pBuckets(other.pBuckets), nElements(other.nElements), loadFactor(other.loadFactor) {}
+            : pBuckets(other.pBuckets.Size()), nElements(0), loadFactor(other.loadFactor)
+        {
+            CopyNodes(other);
+        }
 
         /**
          * @brief Move Constructor
          */
         HashMap(Self&& other) noexcept
             : pBuckets(std::move(other.pBuckets)), nElements(std::move(other.nElements)),
-              loadFactor(std::move(other.loadFactor)) {}
+              loadFactor(std::move(other.loadFactor))
+        {
+            other.pBuckets = Vector<Node<Key, Value>*>(DEFAULT_CAPACITY);
+            other.nElements = 0;
+        }
 
         /**
          * @brief Destructor
@@ -105,10 +109,10 @@ namespace WSTL
         {
             if (this == &other) return *this;
 
-            this->~HashMap();
-            pBuckets = other.pBuckets;
-            nElements = other.nElements;
+            Clear();
+            pBuckets = Vector<Node<Key, Value>*>(other.pBuckets.Size());
             loadFactor = other.loadFactor;
+            CopyNodes(other);
 
             return *this;
         }
@@ -120,11 +124,14 @@ namespace WSTL
         {
             if (this == &other) return *this;
 
-            this->~HashMap();
+            Clear();
             pBuckets = std::move(other.pBuckets);
             nElements = std::move(other.nElements);
             loadFactor = std::move(other.loadFactor);
 
+            other.pBuckets = Vector<Node<Key, Value>*>(DEFAULT_CAPACITY);
+            other.nElements = 0;
+
             return *this;
         }
 
@@ -220,41 +227,18 @@ namespace WSTL
         }
 
         /**
-         * @brief Inserts a new key-value pair into the HashMap
+         * @brief Inserts a new key-value pair into the HashMap, or replaces the value if the key exists
          */
         void Insert(const Key& key, const Value& value)
         {
-            auto index = GetIndex(key);
-            
-            auto pNode = pBuckets[index];
-            if (pNode == nullptr)
+            auto pNode = FindNode(key);
+            if (pNode != nullptr)
             {
-                pBuckets[index] = new Node(key, value);
+                pNode->value = value;
                 return;
             }
 
-            auto found = false;
-
-            while (pNode)
-            {
-                if (pNode->key == key)
-                {
-                    pNode->value = value;
-                    found = true;
-                }
-                pNode = pNode->pNext;
-            }
-
-            if (found) return;
-            
-            while (pNode->pNext)
-            {
-                pNode = pNode->pNext;
-            }
-            pNode->pNext = new Node(key, value);
-
-            nElements++;
-            VerifyVectorSize();
+            LinkNode(new Node<Key, Value>(key, value));
         }
 
         /**
@@ -262,38 +246,49 @@ namespace WSTL
          */
         void Insert(const Key& key, Value&& value)
         {
-            auto index = GetIndex(key);
-            
-            auto pNode = pBuckets[index];
-            
-            if (pNode == nullptr)
+            auto pNode = FindNode(key);
+            if (pNode != nullptr)
             {
-                pBuckets[index] = new Node(key, std::move(value));
+                pNode->value = std::move(value);
                 return;
             }
 
-            auto found = false;
+            LinkNode(new Node<Key, Value>(Key(key), std::move(value)));
+        }
 
-            while (pNode)
+        /**
+         * @brief Links the node of an extracted entry into the HashMap without allocating or copying. Returns false
+         * and leaves the node in the handle if the handle is empty or the key already exists
+         */
+        bool Insert(NodeType&& node)
+        {
+            if (node.IsEmpty() || FindNode(node.Key()) != nullptr) return false;
+
+            LinkNode(node.Release());
+            return true;
+        }
+
+        /**
+         * @brief Unlinks the entry with the given key and returns it in a handle, which is empty if the key
+         * doesn't exist
+         */
+        NodeType Extract(const Key& key)
+        {
+            auto ppLink = &pBuckets[GetIndex(key)];
+            while (*ppLink != nullptr)
             {
+                auto pNode = *ppLink;
                 if (pNode->key == key)
                 {
-                    pNode->value = value;
-                    found = true;
+                    *ppLink = pNode->pNext;
+                    pNode->pNext = nullptr;
+                    nElements--;
+                    return NodeType(pNode);
                 }
-                pNode = pNode->pNext;
+                ppLink = &pNode->pNext;
             }
 
-            if (found) return;
-            
-            while (pNode->pNext)
-            {
-                pNode = pNode->pNext;
-            }
-            pNode->pNext = new Node(key, std::move(value));
-            
-            nElements++;
-            VerifyVectorSize();
+            return NodeType();
         }
 
         /**
@@ -317,34 +312,7 @@ namespace WSTL
          */
         void Delete(const Key& key)
         {
-            auto hash = Hash(&key, sizeof(Key));
-            auto index = hash % pBuckets.Size();
-
-            auto pNode = pBuckets[index];
-
-            if (pNode == nullptr) return;
-
-            if (pNode->key == key)
-            {
-                pBuckets[index] = pNode->pNext;
-                delete pNode;
-                nElements--;
-            }
-            else
-            {
-                while (pNode->pNext)
-                {
-                    if (pNode->pNext->key == key)
-                    {
-                        auto p = pNode->pNext;
-                        pNode->pNext = pNode->pNext->pNext;
-                        delete p;
-                        nElements--;
-                        break;
-                    }
-                    pNode = pNode->pNext;
-                }
-            }
+            Extract(key);
         }
 
         /**
@@ -365,6 +333,16 @@ namespace WSTL
 
         void Clear()
         {
+            for (::Size i = 0; i < pBuckets.Size(); i++)
+            {
+                auto pNode = pBuckets[i];
+                while (pNode)
+                {
+                    auto pNext = pNode->pNext;
+                    delete pNode;
+                    pNode = pNext;
+                }
+            }
             pBuckets.Clear();
 
             pBuckets = Vector<Node<Key, Value>*>(DEFAULT_CAPACITY);
@@ -377,6 +355,24 @@ namespace WSTL
             Insert(key, Value(std::forward<Args>(args)...));
         }
 
+        /**
+         * @brief Returns a pointer to the value associated with the given key, or nullptr if there is none
+         */
+        Value* Find(const Key& key)
+        {
+            auto pNode = FindNode(key);
+            return pNode ? &pNode->value : nullptr;
+        }
+
+        /**
+         * @brief Returns a pointer to the value, as const, associated with the given key, or nullptr if there is none
+         */
+        const Value* Find(const Key& key) const
+        {
+            auto pNode = FindNode(key);
+            return pNode ? &pNode->value : nullptr;
+        }
+
         bool Contains(const Key& key)
         {
             auto index = GetIndex(key);
@@ -398,63 +394,87 @@ namespace WSTL
             return Contains(key);
         }
 
-        Vector<const Key> GetKeys() const
+        /**
+         * @brief Returns a copy of the keys, in bucket order. ForEach reads them without allocating
+         */
+        Vector<Key> GetKeys() const
         {
-            Vector<const Key> keys;
+            Vector<Key> keys;
+            keys.SetCapacity(nElements);
+            ForEach([&keys](const Key& key, const Value&) { keys.PushBack(key); });
+            return keys;
+        }
 
-            for (auto i = 0; i < pBuckets.Size(); i++)
+        /**
+         * @brief Returns a copy of the values, in bucket order. ForEach reads them without allocating
+         */
+        Vector<Value> GetValues() const
+        {
+            Vector<Value> values;
+            values.SetCapacity(nElements);
+            ForEach([&values](const Key&, const Value& value) { values.PushBack(value); });
+            return values;
+        }
+
+        /**
+         * @brief Calls function(key, value) for every entry, in bucket order
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            for (::Size i = 0; i < pBuckets.Size(); i++)
             {
-                auto pNode = pBuckets[i];
-                while (pNode)
-                {
-                    keys.PushBack(pNode->key);
-                    pNode = pNode->pNext;
-                }
+                for (auto pNode = pBuckets[i]; pNode; pNode = pNode->pNext)
+                    function(static_cast<const Key&>(pNode->key), pNode->value);
             }
-
-            return keys;
         }
 
-        Vector<const Value> GetValues() const
+        template<class Function>
+        void ForEach(Function function) const
         {
-            Vector<const Value> values;
-
-            for (auto i = 0; i < pBuckets.Size(); i++)
+            for (::Size i = 0; i < pBuckets.Size(); i++)
             {
-                auto pNode = pBuckets[i];
-                while (pNode)
-                {
-                    values.PushBack(pNode->value);
-                    pNode = pNode->pNext;
-                }
+                for (auto pNode = pBuckets[i]; pNode; pNode = pNode->pNext)
+                    function(static_cast<const Key&>(pNode->key), static_cast<const Value&>(pNode->value));
             }
-            
-            return values;
         }
 
     private:
 
-        template<typename T>
-        static inline ::Size Hash(const T& key)
+        ::Size GetIndex(const Key& key) const
+        {
+            return HashKey(key) % pBuckets.Size();
+        }
+
+        Node<Key, Value>* FindNode(const Key& key) const
         {
-            if constexpr (HasCustomHash<Key>::value)
-            {
-                return key.Hash();
-            }
-            else
-            {
-                return WSTL::Hash(&key, sizeof(T));
-            }
+            auto pNode = pBuckets[GetIndex(key)];
+            while (pNode && !(pNode->key == key)) pNode = pNode->pNext;
+            return pNode;
         }
 
-        static inline ::Size Hash(const std::string& str)
+        /**
+         * @brief Puts a detached node at the front of its bucket
+         */
+        void LinkNode(Node<Key, Value>* pNode)
         {
-            return WSTL::Hash(str.data(), static_cast<::Size>(str.size()));
+            auto index = GetIndex(pNode->key);
+            pNode->pNext = pBuckets[index];
+            pBuckets[index] = pNode;
+
+            nElements++;
+            VerifyVectorSize();
         }
 
-        ::Size GetIndex(const Key& key) const
+        void CopyNodes(const Self& other)
         {
-            return Hash(key) % pBuckets.Size();
+            for (::Size i = 0; i < other.pBuckets.Size(); i++)
+            {
+                for (auto pNode = other.pBuckets[i]; pNode; pNode = pNode->pNext)
+                {
+                    LinkNode(new Node<Key, Value>(pNode->key, pNode->value));
+                }
+            }
         }
         
         void VerifyVectorSize()
@@ -473,7 +493,7 @@ namespace WSTL
                     auto pNext = pNode->pNext;
                     pNode->pNext = nullptr;
 
-                    auto newIndex = Hash(pNode->key) % newCapacity;
+                    auto newIndex = HashKey(pNode->key) % newCapacity;
 
                     if (newBuckets[newIndex] == nullptr)
                     {
@@ -0,0 +1,492 @@
+#pragma once
+
+#include "stdexcept"
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/BitSet.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+namespace WSTL
+{
+    namespace HierarchicalInternal
+    {
+        struct NoLevel
+        {
+        };
+
+        /**
+         * @brief A BitSet plus a summary of its words: bit i of the parent level is Set when word i is not zero.
+         * Levels nest until a single word is left, so a search touches one word per level
+         */
+        template <::Size BitAmount>
+        class Level
+        {
+        public:
+            typedef typename BitSet<BitAmount>::ArrayType Word;
+
+            static constexpr ::Size WordBits = CHAR_BIT * sizeof(Word);
+            static constexpr ::Size Words = BitAmount == 0 ? 1 : (BitAmount + WordBits - 1) / WordBits;
+            static constexpr bool HasParent = Words > 1;
+
+            typedef ConditionalT<HasParent, Level<Words>, NoLevel> Parent;
+
+            [[nodiscard]]
+            constexpr bool Subscript(const ::Size pos) const
+            {
+                return bits.Subscript(pos);
+            }
+
+            [[nodiscard]]
+            constexpr Word GetWord(const ::Size index) const
+            {
+                return bits.GetWord(index);
+            }
+
+            /**
+             * @brief Sets the bit and updates the summary when its word becomes zero or stops being zero
+             */
+            constexpr void SetUnchecked(const ::Size pos, const bool val) noexcept
+            {
+                const ::Size index = pos / WordBits;
+                const bool wasEmpty = bits.GetWord(index) == 0;
+
+                bits[pos] = val;
+
+                if constexpr (HasParent)
+                {
+                    const bool isEmpty = bits.GetWord(index) == 0;
+                    if (wasEmpty != isEmpty) parent.SetUnchecked(index, !isEmpty);
+                }
+            }
+
+            /**
+             * @brief Returns the first Set (1) bit at or after pos, or BitAmount if there is none
+             */
+            [[nodiscard]]
+            constexpr ::Size FindFrom(const ::Size pos) const noexcept
+            {
+                if (pos >= BitAmount) return BitAmount;
+
+                ::Size index = pos / WordBits;
+                const Word word = bits.GetWord(index) & (~Word{0} << (pos % WordBits));
+                if (word != 0) return index * WordBits + CountTrailingZeros(word);
+
+                if constexpr (HasParent)
+                {
+                    index = parent.FindFrom(index + 1);
+                    if (index >= Words) return BitAmount;
+                    return index * WordBits + CountTrailingZeros(bits.GetWord(index));
+                }
+                else
+                {
+                    return BitAmount;
+                }
+            }
+
+            /**
+             * @brief Returns the index of the first non-zero word at or after index, or Words if there is none
+             */
+            [[nodiscard]]
+            constexpr ::Size FindWordFrom(const ::Size index) const noexcept
+            {
+                if (index >= Words) return Words;
+                if (bits.GetWord(index) != 0) return index;
+
+                if constexpr (HasParent) return parent.FindFrom(index + 1);
+                else return Words;
+            }
+
+            /**
+             * @brief Returns the last Set (1) bit, or BitAmount if there is none
+             */
+            [[nodiscard]]
+            constexpr ::Size FindLast() const noexcept
+            {
+                ::Size index = 0;
+                if constexpr (HasParent)
+                {
+                    index = parent.FindLast();
+                    if (index >= Words) return BitAmount;
+                }
+                else if (bits.GetWord(0) == 0)
+                {
+                    return BitAmount;
+                }
+
+                const Word word = bits.GetWord(index);
+                return index * WordBits + WordBits - 1 - CountLeadingZeros(word);
+            }
+
+            /**
+             * @brief Sets or clears every bit
+             */
+            constexpr void Fill(const bool val) noexcept
+            {
+                if (val) bits.Set();
+                else bits.Reset();
+
+                if constexpr (HasParent) parent.Fill(val && BitAmount != 0);
+            }
+
+            /**
+             * @brief Recomputes every summary from the words of this level
+             */
+            constexpr void Rebuild() noexcept
+            {
+                if constexpr (HasParent)
+                {
+                    parent.Fill(false);
+                    for (::Size i = 0; i < Words; i++)
+                    {
+                        if (bits.GetWord(i) != 0) parent.SetUnchecked(i, true);
+                    }
+                }
+            }
+
+            [[nodiscard]]
+            constexpr const BitSet<BitAmount>& Bits() const noexcept
+            {
+                return bits;
+            }
+
+            [[nodiscard]]
+            constexpr BitSet<BitAmount>& Bits() noexcept
+            {
+                return bits;
+            }
+
+        private:
+            BitSet<BitAmount> bits;
+            Parent parent;
+        };
+    }
+
+    /**
+     * @brief Fixed size set of bits with summary levels on top, for searches and iteration that skip empty and
+     * full regions. One level is kept over the Set (1) bits and one over the words that still have a Reset (0) bit,
+     * so FindFirstSet and FindFirstClear both cost O(log64 n) words instead of a scan of the whole set
+     */
+    template <::Size BitAmount>
+    class HierarchicalBitSet
+    {
+        static_assert(BitAmount > 0, "HierarchicalBitSet needs at least one bit");
+
+        typedef HierarchicalInternal::Level<BitAmount> Occupied;
+        typedef typename Occupied::Word Word;
+
+        static constexpr ::Size WordBits = Occupied::WordBits;
+        static constexpr ::Size Words = Occupied::Words;
+
+        typedef HierarchicalInternal::Level<Words> Vacant;
+
+    public:
+        /**
+         * @brief Default Constructor, every bit is Reset (0)
+         */
+        constexpr HierarchicalBitSet() noexcept
+        {
+            vacant.Fill(true);
+        }
+
+        /**
+         * @brief Constructor from a BitSet
+         */
+        constexpr explicit HierarchicalBitSet(const BitSet<BitAmount>& bitSet) noexcept
+        {
+            occupied.Bits() = bitSet;
+            occupied.Rebuild();
+            for (::Size i = 0; i < Words; i++) UpdateVacant(i);
+        }
+
+        /**
+         * @brief Returns the value of the bit at the specified position. Throws std::out_of_range if pos is out of range
+         */
+        [[nodiscard]]
+        constexpr bool Test(const ::Size pos) const
+        {
+            Validate(pos);
+            return occupied.Subscript(pos);
+        }
+
+        [[nodiscard]]
+        constexpr bool operator[](const ::Size pos) const
+        {
+            return occupied.Subscript(pos);
+        }
+
+        /**
+         * @brief Sets every bit
+         */
+        constexpr HierarchicalBitSet& Set() noexcept
+        {
+            occupied.Fill(true);
+            vacant.Fill(false);
+            return *this;
+        }
+
+        /**
+         * @brief Sets the bit at the specified position to val. Throws std::out_of_range if pos is out of range
+         */
+        constexpr HierarchicalBitSet& Set(const ::Size pos, const bool val = true)
+        {
+            Validate(pos);
+            occupied.SetUnchecked(pos, val);
+            UpdateVacant(pos / WordBits);
+            return *this;
+        }
+
+        /**
+         * @brief Resets every bit
+         */
+        constexpr HierarchicalBitSet& Reset() noexcept
+        {
+            occupied.Fill(false);
+            vacant.Fill(true);
+            return *this;
+        }
+
+        /**
+         * @brief Resets the bit at the specified position. Throws std::out_of_range if pos is out of range
+         */
+        constexpr HierarchicalBitSet& Reset(const ::Size pos)
+        {
+            return Set(pos, false);
+        }
+
+        /**
+         * @brief Sets the first Reset (0) bit and returns its position, or Size() if every bit is Set
+         */
+        constexpr ::Size Acquire() noexcept
+        {
+            const ::Size pos = FindFirstClear();
+            if (pos == BitAmount) return BitAmount;
+
+            occupied.SetUnchecked(pos, true);
+            UpdateVacant(pos / WordBits);
+            return pos;
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindFirstSet() const noexcept
+        {
+            return occupied.FindFrom(0);
+        }
+
+        /**
+         * @brief Returns the position of the first Set (1) bit after pos, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindNextSet(const ::Size pos) const noexcept
+        {
+            return occupied.FindFrom(pos + 1);
+        }
+
+        /**
+         * @brief Returns the position of the last Set (1) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindLastSet() const noexcept
+        {
+            return occupied.FindLast();
+        }
+
+        /**
+         * @brief Returns the position of the first Reset (0) bit, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindFirstClear() const noexcept
+        {
+            return FindClearFrom(0);
+        }
+
+        /**
+         * @brief Returns the position of the first Reset (0) bit after pos, or Size() if there is none
+         */
+        [[nodiscard]]
+        constexpr ::Size FindNextClear(const ::Size pos) const noexcept
+        {
+            return FindClearFrom(pos + 1);
+        }
+
+        /**
+         * @brief Calls function with the position of every Set (1) bit in increasing order, skipping empty words
+         * through the summary
+         */
+        template <class Function>
+        constexpr void ForEachSetBit(Function&& function) const
+        {
+            for (::Size i = occupied.FindWordFrom(0); i < Words; i = occupied.FindWordFrom(i + 1))
+            {
+                for (Word word = occupied.GetWord(i); word != 0; word &= word - 1)
+                {
+                    function(i * WordBits + CountTrailingZeros(word));
+                }
+            }
+        }
+
+        /**
+         * @brief Iterates the positions of the Set (1) bits
+         */
+        class SetBitIterator
+        {
+        public:
+            constexpr SetBitIterator(const HierarchicalBitSet* pBitSet, const ::Size pos) noexcept
+                : pBitSet(pBitSet), pos(pos)
+            {
+            }
+
+            constexpr ::Size operator*() const noexcept
+            {
+                return pos;
+            }
+
+            constexpr SetBitIterator& operator++() noexcept
+            {
+                pos = pBitSet->FindNextSet(pos);
+                return *this;
+            }
+
+            constexpr bool operator!=(const SetBitIterator& other) const noexcept
+            {
+                return pos != other.pos;
+            }
+
+        private:
+            const HierarchicalBitSet* pBitSet;
+            ::Size pos;
+        };
+
+        struct SetBitRange
+        {
+            const HierarchicalBitSet* pBitSet;
+
+            constexpr SetBitIterator begin() const noexcept
+            {
+                return SetBitIterator(pBitSet, pBitSet->FindFirstSet());
+            }
+
+            constexpr SetBitIterator end() const noexcept
+            {
+                return SetBitIterator(pBitSet, BitAmount);
+            }
+        };
+
+        /**
+         * @brief Returns a range over the positions of the Set (1) bits, for (auto pos : bitSet.SetBits())
+         */
+        [[nodiscard]]
+        constexpr SetBitRange SetBits() const noexcept
+        {
+            return SetBitRange{this};
+        }
+
+        /**
+         * @brief Checks if any bit is Set (1), O(1)
+         */
+        [[nodiscard]]
+        constexpr bool Any() const noexcept
+        {
+            return occupied.FindWordFrom(0) < Words;
+        }
+
+        /**
+         * @brief Checks if no bit is Set (1), O(1)
+         */
+        [[nodiscard]]
+        constexpr bool None() const noexcept
+        {
+            return !Any();
+        }
+
+        /**
+         * @brief Checks if every bit is Set (1), O(1)
+         */
+        [[nodiscard]]
+        constexpr bool All() const noexcept
+        {
+            return vacant.FindWordFrom(0) >= Vacant::Words;
+        }
+
+        /**
+         * @brief Returns the number of Set (1) bits
+         */
+        [[nodiscard]]
+        constexpr ::Size Count() const noexcept
+        {
+            return occupied.Bits().Count();
+        }
+
+        /**
+         * @brief Returns the underlying BitSet
+         */
+        [[nodiscard]]
+        constexpr const BitSet<BitAmount>& Bits() const noexcept
+        {
+            return occupied.Bits();
+        }
+
+        /**
+         * @brief Returns the size of the HierarchicalBitSet
+         */
+        [[nodiscard]]
+        static constexpr ::Size Size() noexcept
+        {
+            return BitAmount;
+        }
+
+        /**
+         * @brief Validates the index. Throws std::out_of_range if index is out of range
+         */
+        static constexpr void Validate(const ::Size pos)
+        {
+            if (pos >= BitAmount)
+                throw std::out_of_range("HierarchicalBitSet<BitAmount>::Validate: Index out of range");
+        }
+
+        [[nodiscard]]
+        constexpr bool operator==(const HierarchicalBitSet& other) const noexcept
+        {
+            return occupied.Bits() == other.occupied.Bits();
+        }
+
+    private:
+        /**
+         * @brief Mask of the valid bits of a word, only the last one can be partial
+         */
+        static constexpr Word ValidBits(const ::Size index) noexcept
+        {
+            constexpr ::Size tail = BitAmount % WordBits;
+            return index == Words - 1 && tail != 0 ? (Word{1} << tail) - 1 : ~Word{0};
+        }
+
+        /**
+         * @brief Keeps the vacant summary in sync after word index of the bits changed
+         */
+        constexpr void UpdateVacant(const ::Size index) noexcept
+        {
+            const bool hasClear = (~occupied.GetWord(index) & ValidBits(index)) != 0;
+            if (vacant.Subscript(index) != hasClear) vacant.SetUnchecked(index, hasClear);
+        }
+
+        constexpr ::Size FindClearFrom(const ::Size pos) const noexcept
+        {
+            if (pos >= BitAmount) return BitAmount;
+
+            ::Size index = pos / WordBits;
+            Word word = ~occupied.GetWord(index) & ValidBits(index) & (~Word{0} << (pos % WordBits));
+            if (word == 0)
+            {
+                index = vacant.FindFrom(index + 1);
+                if (index >= Words) return BitAmount;
+                word = ~occupied.GetWord(index) & ValidBits(index);
+            }
+            return index * WordBits + CountTrailingZeros(word);
+        }
+
+        Occupied occupied;
+        Vacant vacant;
+    };
+}
@@ -401,6 +401,49 @@ namespace WSTL
             }
         }
 
+        /**
+         * \brief Moves every element of other in front of the element at index, or to the back if index is Size().
+         * The nodes are relinked, nothing is allocated or copied
+         */
+        void Splice(::Size index, Self& other)
+        {
+            Splice(index, other, 0, other.size);
+        }
+
+        /**
+         * \brief Moves count elements of other, starting at otherIndex, in front of the element at index, or to the
+         * back if index is Size(). The nodes are relinked, nothing is allocated or copied
+         */
+        void Splice(::Size index, Self& other, ::Size otherIndex, ::Size count = 1)
+        {
+            if(this == &other) throw std::invalid_argument("Cannot splice a list into itself");
+            if(index > size) throw std::out_of_range("Index out of range");
+            if(otherIndex > other.size || count > other.size - otherIndex) throw std::out_of_range("Index out of range");
+            if(count == 0) return;
+
+            Node* pFirst = other.NodeAt(otherIndex);
+            Node* pLast = pFirst;
+            for(::Size i = 1; i < count; i++) pLast = pLast->pNext;
+
+            // Unlink [pFirst, pLast] from other
+            if(pFirst->pPrev != nullptr) pFirst->pPrev->pNext = pLast->pNext;
+            else other.pHead = pLast->pNext;
+            if(pLast->pNext != nullptr) pLast->pNext->pPrev = pFirst->pPrev;
+            else other.pTail = pFirst->pPrev;
+            other.size -= count;
+
+            // Link it in front of the node at index
+            Node* pNext = index == size ? nullptr : NodeAt(index);
+            Node* pPrev = pNext != nullptr ? pNext->pPrev : pTail;
+            pFirst->pPrev = pPrev;
+            pLast->pNext = pNext;
+            if(pPrev != nullptr) pPrev->pNext = pFirst;
+            else pHead = pFirst;
+            if(pNext != nullptr) pNext->pPrev = pLast;
+            else pTail = pLast;
+            size += count;
+        }
+
         /**
          * \brief Gets the front value
          */
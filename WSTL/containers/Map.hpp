@@ -1,5 +1,9 @@
 ﻿#pragma once
+#include <stdexcept>
+#include <utility>
 
+#include "WSTL/containers/NodeHandle.hpp"
+#include "WSTL/containers/Span.hpp"
 #include "WSTL/containers/Vector.hpp"
 #include "WSTL/containers/trees/RBTree.hpp"
 
@@ -11,6 +15,9 @@ namespace WSTL
         using Self = Map<Key, Value>;
         
     public:
+        using Node = RBTNode<Key, Value>;
+        using NodeType = NodeHandle<Node>;
+
         /**
          * \brief Default constructor
          */
@@ -53,8 +60,7 @@ namespace WSTL
         Self& operator=(Self&& other) noexcept
         {
             if(this == &other) return *this;
-            tree = other.tree;
-            other.tree = RBTree<Key, Value>();
+            tree = std::move(other.tree);
             return *this;
         }
             
@@ -148,6 +154,26 @@ namespace WSTL
             Delete(key);
         }
 
+        /**
+         * \brief Unlinks the entry with the given key and returns it in a handle, which is empty if the key
+         * doesn't exist
+         */
+        NodeType Extract(const Key& key)
+        {
+            return NodeType(tree.Extract(key));
+        }
+
+        /**
+         * \brief Links the node of an extracted entry into the container without allocating or copying. Returns
+         * false and leaves the node in the handle if the handle is empty or the key already exists
+         */
+        bool Insert(NodeType&& node)
+        {
+            if(node.IsEmpty() || !tree.InsertNode(node.pNode)) return false;
+            node.Release();
+            return true;
+        }
+
         /**
          * \brief Removes all entries from the container
          */
@@ -168,11 +194,11 @@ namespace WSTL
         /**
          * \brief Returns whether the container contains the given key
          */
-        bool Contains(const Key& key)
+        bool Contains(const Key& key) const
         {
             return tree.Search(key) != nullptr;
         }
-        bool ContainsKey(const Key& key)
+        bool ContainsKey(const Key& key) const
         {
             return Contains(key);
         }
@@ -227,7 +253,162 @@ namespace WSTL
             return tree.GetValues();
         }
 
+        /**
+         * \brief Calls function(key, value) for every entry in ascending order, without copying the keys or values
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            tree.ForEach(function);
+        }
+
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            tree.ForEach([&function](const Key& key, const Value& value) { function(key, value); });
+        }
+
+        /**
+         * \brief Returns the node with the first key not less than the given key, or nullptr
+         */
+        Node* LowerBound(const Key& key)
+        {
+            return tree.LowerBound(key);
+        }
+        const Node* LowerBound(const Key& key) const
+        {
+            return tree.LowerBound(key);
+        }
+
+        /**
+         * \brief Returns the node with the first key greater than the given key, or nullptr
+         */
+        Node* UpperBound(const Key& key)
+        {
+            return tree.UpperBound(key);
+        }
+        const Node* UpperBound(const Key& key) const
+        {
+            return tree.UpperBound(key);
+        }
+
+        /**
+         * \brief Returns the [first, second) nodes with the given key, first == second if it doesn't exist
+         */
+        Pair<Node*, Node*> EqualRange(const Key& key)
+        {
+            return tree.EqualRange(key);
+        }
+
+        /**
+         * \brief Returns the node that follows the given one in key order, or nullptr
+         */
+        static Node* Next(const Node* pNode)
+        {
+            return RBTree<Key, Value>::Next(pNode);
+        }
+
+        /**
+         * \brief Calls function(key, value) for every entry with lower <= key < upper in ascending order
+         */
+        template<class Function>
+        void ForEachInRange(const Key& lower, const Key& upper, Function function)
+        {
+            tree.ForEachInRange(lower, upper, function);
+        }
+
+        template<class Function>
+        void ForEachInRange(const Key& lower, const Key& upper, Function function) const
+        {
+            tree.ForEachInRange(lower, upper, [&function](const Key& key, const Value& value) { function(key, value); });
+        }
+
+        /**
+         * \brief Removes every entry with lower <= key < upper, returns how many were removed
+         */
+        ::Size EraseRange(const Key& lower, const Key& upper)
+        {
+            return tree.EraseRange(lower, upper);
+        }
+
+        /**
+         * \brief Builds a map from entries sorted by strictly increasing key in O(n), without rebalancing.
+         * Iterator must be a forward iterator over Pair<Key, Value>. Throws std::invalid_argument if the keys
+         * are not strictly increasing
+         */
+        template<class Iterator, typename = decltype(*std::declval<Iterator&>())>
+        static Self FromSorted(Iterator first, Iterator last)
+        {
+            ::Size count = 0;
+            Iterator previous = first;
+            for(Iterator it = first; it != last; ++it, count++)
+            {
+                if(count != 0 && !(previous->first < (*it).first))
+                    throw std::invalid_argument("Map::FromSorted: keys are not strictly increasing");
+                previous = it;
+            }
+
+            Self map;
+            map.tree.AssignSorted(count, [&first]
+            {
+                auto pNode = new Node((*first).first, (*first).second);
+                ++first;
+                return pNode;
+            });
+            return map;
+        }
+
+        /**
+         * \brief Builds a map from strictly increasing keys and their values in O(n). Throws std::invalid_argument
+         * if the sizes differ or the keys are not strictly increasing
+         */
+        static Self FromSorted(Span<const Key> keys, Span<const Value> values)
+        {
+            if(keys.Size() != values.Size())
+                throw std::invalid_argument("Map::FromSorted: keys and values have different sizes");
+            for(::Size i = 1; i < keys.Size(); i++)
+            {
+                if(!(keys[i - 1] < keys[i]))
+                    throw std::invalid_argument("Map::FromSorted: keys are not strictly increasing");
+            }
+
+            Self map;
+            map.tree.AssignSorted(keys.Data(), values.Data(), keys.Size());
+            return map;
+        }
+
+        /**
+         * \brief Moves the entries of other whose keys aren't in this map over in O(n + m), by relinking nodes.
+         * Entries whose keys are already present stay in other
+         */
+        void Merge(Self& other)
+        {
+            tree.Merge(other.tree);
+        }
+
+        /**
+         * \brief Moves the entries with keys not less than key into the returned map, in O(log n)
+         */
+        Self Split(const Key& key)
+        {
+            Self right;
+            right.tree = tree.Split(key);
+            return right;
+        }
+
+        /**
+         * \brief Moves every entry of other into this map in O(log n + log m). Throws std::invalid_argument if
+         * the keys of other are not all greater than the keys of this map
+         */
+        void Join(Self& other)
+        {
+            tree.Join(other.tree);
+        }
+
     private:
+        template<typename K, typename V>
+        friend class FlatMap;
+
         RBTree<Key, Value> tree;
     };
 }
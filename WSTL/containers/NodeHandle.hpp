@@ -0,0 +1,120 @@
+#pragma once
+#include <utility>
+
+#include "WSTL/memory/Memory.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Owns a node taken out of a node based container with Extract. The key and value can be changed while
+     * the node is detached, and Insert(NodeHandle&&) links it into another container of the same type without
+     * allocating or copying. A handle that is never inserted deletes its node
+     */
+    template<typename Node>
+    class NodeHandle
+    {
+        typedef NodeHandle<Node> Self;
+
+    public:
+        /**
+         * \brief Default constructor, creates an empty handle
+         */
+        NodeHandle() = default;
+
+        NodeHandle(const Self& other) = delete;
+        Self& operator=(const Self& other) = delete;
+
+        /**
+         * \brief Move constructor
+         */
+        NodeHandle(Self&& other) noexcept : pNode(other.pNode)
+        {
+            other.pNode = nullptr;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Free(&pNode);
+            pNode = other.pNode;
+            other.pNode = nullptr;
+            return *this;
+        }
+
+        /**
+         * \brief Destructor, deletes the node if it wasn't inserted anywhere
+         */
+        ~NodeHandle()
+        {
+            Free(&pNode);
+        }
+
+        /**
+         * \brief Returns whether the handle holds no node
+         */
+        bool IsEmpty() const noexcept
+        {
+            return pNode == nullptr;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return pNode != nullptr;
+        }
+
+        /**
+         * \brief Returns the key of the node, the handle must not be empty
+         */
+        auto& Key() noexcept
+        {
+            return pNode->key;
+        }
+
+        const auto& Key() const noexcept
+        {
+            return pNode->key;
+        }
+
+        /**
+         * \brief Returns the value of the node, the handle must not be empty
+         */
+        auto& Value() noexcept
+        {
+            return pNode->value;
+        }
+
+        const auto& Value() const noexcept
+        {
+            return pNode->value;
+        }
+
+    private:
+        template<typename K, typename V>
+        friend class Map;
+
+        template<typename V>
+        friend class Set;
+
+        template<typename K, typename V>
+        friend class HashMap;
+
+        explicit NodeHandle(Node* pNode) noexcept : pNode(pNode)
+        {
+        }
+
+        /**
+         * \brief Gives the node back to a container
+         */
+        Node* Release() noexcept
+        {
+            Node* pReleased = pNode;
+            pNode = nullptr;
+            return pReleased;
+        }
+
+        Node* pNode = nullptr;
+    };
+}
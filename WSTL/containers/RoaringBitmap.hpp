@@ -0,0 +1,1403 @@
+#pragma once
+#include <cstring>
+#include <stdexcept>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/BitKernels.hpp"
+
+namespace WSTL
+{
+    namespace RoaringInternal
+    {
+        enum class ContainerType : UI16
+        {
+            Array = 1,
+            Bitmap = 2,
+            Run = 3
+        };
+
+        constexpr UI32 ArrayMaxCardinality = 4096;
+
+        /**
+         * \brief Bitmaps shrinking through Remove only turn back into arrays below this, so a chunk hovering around
+         * 4096 values doesn't convert on every call. RunOptimize compacts the ones left in between
+         */
+        constexpr UI32 ArrayShrinkCardinality = ArrayMaxCardinality / 4 * 3;
+        constexpr UI32 BitmapWords = 1024;
+        constexpr UI32 BitmapBytes = BitmapWords * sizeof(UI64);
+
+        /**
+         * \brief Read-only view of one 64K chunk, shared by owned containers and serialized ones.
+         * Arrays are sorted values, runs are (start, length - 1) pairs sorted by start, bitmaps are 1024 words
+         */
+        struct ContainerView
+        {
+            ContainerType type;
+            UI32 cardinality;
+            UI32 count;
+            const UI16* pValues;
+            const UI64* pWords;
+
+            bool Contains(UI16 value) const noexcept
+            {
+                if(type == ContainerType::Bitmap) return (pWords[value >> 6] >> (value & 63) & 1) != 0;
+
+                if(type == ContainerType::Array)
+                {
+                    UI32 low = 0, high = count;
+                    while(low < high)
+                    {
+                        const UI32 middle = (low + high) / 2;
+                        if(pValues[middle] < value) low = middle + 1;
+                        else high = middle;
+                    }
+                    return low < count && pValues[low] == value;
+                }
+
+                // Last run starting at or before value
+                UI32 low = 0, high = count;
+                while(low < high)
+                {
+                    const UI32 middle = (low + high) / 2;
+                    if(pValues[middle * 2] <= value) low = middle + 1;
+                    else high = middle;
+                }
+                return low != 0 && value - pValues[(low - 1) * 2] <= pValues[(low - 1) * 2 + 1];
+            }
+
+            template<class Function>
+            void ForEach(UI32 high, Function& function) const
+            {
+                if(type == ContainerType::Array)
+                {
+                    for(UI32 i = 0; i < count; i++) function(high | pValues[i]);
+                }
+                else if(type == ContainerType::Bitmap)
+                {
+                    for(UI32 i = 0; i < BitmapWords; i++)
+                    {
+                        for(UI64 word = pWords[i]; word != 0; word &= word - 1)
+                        {
+                            function(high | (i * 64 + static_cast<UI32>(CountTrailingZeros(word))));
+                        }
+                    }
+                }
+                else
+                {
+                    for(UI32 i = 0; i < count; i++)
+                    {
+                        const UI32 start = pValues[i * 2];
+                        const UI32 end = start + pValues[i * 2 + 1];
+                        for(UI32 value = start; value <= end; value++) function(high | value);
+                    }
+                }
+            }
+
+            UI16 Minimum() const noexcept
+            {
+                if(type != ContainerType::Bitmap) return pValues[0];
+
+                UI32 i = 0;
+                while(pWords[i] == 0) i++;
+                return static_cast<UI16>(i * 64 + CountTrailingZeros(pWords[i]));
+            }
+
+            UI16 Maximum() const noexcept
+            {
+                if(type == ContainerType::Array) return pValues[count - 1];
+                if(type == ContainerType::Run) return static_cast<UI16>(pValues[count * 2 - 2] + pValues[count * 2 - 1]);
+
+                UI32 i = BitmapWords - 1;
+                while(pWords[i] == 0) i--;
+                return static_cast<UI16>(i * 64 + 63 - CountLeadingZeros(pWords[i]));
+            }
+
+            /**
+             * \brief Number of runs of consecutive values
+             */
+            UI32 RunCount() const noexcept
+            {
+                if(type == ContainerType::Run) return count;
+
+                UI32 runs = 0;
+                if(type == ContainerType::Array)
+                {
+                    for(UI32 i = 0; i < count; i++) runs += i == 0 || pValues[i] != pValues[i - 1] + 1;
+                    return runs;
+                }
+
+                // A run starts at every set bit whose lower neighbour is clear
+                UI64 carry = 0;
+                for(UI32 i = 0; i < BitmapWords; i++)
+                {
+                    runs += PopCount(pWords[i] & ~((pWords[i] << 1) | carry));
+                    carry = pWords[i] >> 63;
+                }
+                return runs;
+            }
+
+            /**
+             * \brief Bytes the payload takes in memory and in the serialized format
+             */
+            Size PayloadBytes() const noexcept
+            {
+                if(type == ContainerType::Bitmap) return BitmapBytes;
+                return static_cast<Size>(count) * sizeof(UI16) * (type == ContainerType::Run ? 2 : 1);
+            }
+        };
+
+        /**
+         * \brief Owned chunk. Arrays hold up to 4096 values, anything larger is a bitmap; runs only appear through
+         * RunOptimize, and Add and Remove work on them in place
+         */
+        struct Container
+        {
+            ContainerType type = ContainerType::Array;
+            UI32 cardinality = 0;
+            UI32 count = 0;
+            UI32 capacity = 0;
+            UI16* pValues = nullptr;
+            UI64* pWords = nullptr;
+
+            Container() = default;
+
+            Container(const Container& other) = delete;
+            Container& operator=(const Container& other) = delete;
+
+            ~Container()
+            {
+                Allocator::Deallocate(&pValues);
+                Allocator::Deallocate(&pWords);
+            }
+
+            static Container* FromView(const ContainerView& view)
+            {
+                auto pContainer = new Container();
+                pContainer->type = view.type;
+                pContainer->cardinality = view.cardinality;
+
+                if(view.type == ContainerType::Bitmap)
+                {
+                    pContainer->AllocateWords();
+                    std::memcpy(pContainer->pWords, view.pWords, BitmapBytes);
+                }
+                else
+                {
+                    const UI32 slots = view.type == ContainerType::Run ? view.count * 2 : view.count;
+                    pContainer->Reserve(slots);
+                    std::memcpy(pContainer->pValues, view.pValues, slots * sizeof(UI16));
+                    pContainer->count = view.count;
+                }
+                return pContainer;
+            }
+
+            ContainerView View() const noexcept
+            {
+                return {type, cardinality, count, pValues, pWords};
+            }
+
+            void Reserve(UI32 slots)
+            {
+                if(slots <= capacity) return;
+
+                UI32 newCapacity = capacity * 2 > slots ? capacity * 2 : slots;
+                if(newCapacity < 4) newCapacity = 4;
+
+                UI16* pNewValues = Allocator::Allocate<UI16>(newCapacity * sizeof(UI16));
+                const UI32 used = type == ContainerType::Run ? count * 2 : count;
+                if(used != 0) std::memcpy(pNewValues, pValues, used * sizeof(UI16));
+
+                Allocator::Deallocate(&pValues);
+                pValues = pNewValues;
+                capacity = newCapacity;
+            }
+
+            void AllocateWords()
+            {
+                pWords = Allocator::AllocateAligned<UI64>(BitmapBytes, SystemCacheLineSize);
+                std::memset(pWords, 0, BitmapBytes);
+            }
+
+            void ReleaseValues()
+            {
+                Allocator::Deallocate(&pValues);
+                capacity = 0;
+                count = 0;
+            }
+
+            bool Add(UI16 value)
+            {
+                if(type == ContainerType::Run) return AddToRuns(value);
+
+                if(type == ContainerType::Bitmap)
+                {
+                    UI64& word = pWords[value >> 6];
+                    const UI64 bit = UI64{1} << (value & 63);
+                    if((word & bit) != 0) return false;
+
+                    word |= bit;
+                    cardinality++;
+                    return true;
+                }
+
+                const UI32 position = LowerBound(value);
+                if(position < count && pValues[position] == value) return false;
+
+                if(cardinality == ArrayMaxCardinality)
+                {
+                    ToBitmap();
+                    return Add(value);
+                }
+
+                // Appending in order is the common case when building from sorted input
+                Reserve(count + 1);
+                if(position != count)
+                {
+                    std::memmove(pValues + position + 1, pValues + position, (count - position) * sizeof(UI16));
+                }
+                pValues[position] = value;
+                count++;
+                cardinality++;
+                return true;
+            }
+
+            bool Remove(UI16 value)
+            {
+                if(type == ContainerType::Run) return RemoveFromRuns(value);
+
+                if(type == ContainerType::Bitmap)
+                {
+                    UI64& word = pWords[value >> 6];
+                    const UI64 bit = UI64{1} << (value & 63);
+                    if((word & bit) == 0) return false;
+
+                    word &= ~bit;
+                    cardinality--;
+                    if(cardinality < ArrayShrinkCardinality) ToArray();
+                    return true;
+                }
+
+                const UI32 position = LowerBound(value);
+                if(position == count || pValues[position] != value) return false;
+
+                std::memmove(pValues + position, pValues + position + 1, (count - position - 1) * sizeof(UI16));
+                count--;
+                cardinality--;
+                return true;
+            }
+
+            /**
+             * \brief Extends the run next to value, or joins the two runs around it. Expands only when a new run makes
+             * the runs larger than the array or bitmap they stand for
+             */
+            bool AddToRuns(UI16 value)
+            {
+                // Runs starting at or before value
+                UI32 low = 0, high = count;
+                while(low < high)
+                {
+                    const UI32 middle = (low + high) / 2;
+                    if(pValues[middle * 2] <= value) low = middle + 1;
+                    else high = middle;
+                }
+
+                const bool hasPrevious = low != 0;
+                const UI32 previousEnd = hasPrevious ? pValues[low * 2 - 2] + pValues[low * 2 - 1] : 0;
+                if(hasPrevious && value <= previousEnd) return false;
+
+                const bool joinsPrevious = hasPrevious && value == previousEnd + 1;
+                const bool joinsNext = low < count && pValues[low * 2] == static_cast<UI32>(value) + 1;
+                if(!joinsPrevious && !joinsNext) Reserve(count * 2 + 2);
+
+                cardinality++;
+                if(joinsPrevious && joinsNext)
+                {
+                    pValues[low * 2 - 1] = static_cast<UI16>(pValues[low * 2 - 1] + pValues[low * 2 + 1] + 2);
+                    std::memmove(pValues + low * 2, pValues + low * 2 + 2, (count - low - 1) * 2 * sizeof(UI16));
+                    count--;
+                }
+                else if(joinsPrevious)
+                {
+                    pValues[low * 2 - 1]++;
+                }
+                else if(joinsNext)
+                {
+                    pValues[low * 2]--;
+                    pValues[low * 2 + 1]++;
+                }
+                else
+                {
+                    std::memmove(pValues + low * 2 + 2, pValues + low * 2, (count - low) * 2 * sizeof(UI16));
+                    pValues[low * 2] = value;
+                    pValues[low * 2 + 1] = 0;
+                    count++;
+
+                    const Size expandedBytes = cardinality > ArrayMaxCardinality ? BitmapBytes : cardinality * sizeof(UI16);
+                    if(static_cast<Size>(count) * 2 * sizeof(UI16) > expandedBytes) Expand();
+                }
+                return true;
+            }
+
+            /**
+             * \brief Trims the run holding value, or splits it in two. Expands only when the extra run makes the runs
+             * larger than the array or bitmap they stand for
+             */
+            bool RemoveFromRuns(UI16 value)
+            {
+                // Last run starting at or before value
+                UI32 low = 0, high = count;
+                while(low < high)
+                {
+                    const UI32 middle = (low + high) / 2;
+                    if(pValues[middle * 2] <= value) low = middle + 1;
+                    else high = middle;
+                }
+                if(low == 0) return false;
+
+                const UI32 run = low - 1;
+                const UI32 start = pValues[run * 2];
+                const UI32 end = start + pValues[run * 2 + 1];
+                if(value > end) return false;
+
+                cardinality--;
+                if(start == end)
+                {
+                    std::memmove(pValues + run * 2, pValues + run * 2 + 2, (count - run - 1) * 2 * sizeof(UI16));
+                    count--;
+                }
+                else if(value == start)
+                {
+                    pValues[run * 2]++;
+                    pValues[run * 2 + 1]--;
+                }
+                else if(value == end)
+                {
+                    pValues[run * 2 + 1]--;
+                }
+                else
+                {
+                    Reserve(count * 2 + 2);
+                    std::memmove(pValues + run * 2 + 2, pValues + run * 2, (count - run) * 2 * sizeof(UI16));
+                    pValues[run * 2 + 1] = static_cast<UI16>(value - start - 1);
+                    pValues[run * 2 + 2] = static_cast<UI16>(value + 1);
+                    pValues[run * 2 + 3] = static_cast<UI16>(end - value - 1);
+                    count++;
+
+                    const Size expandedBytes = cardinality > ArrayMaxCardinality ? BitmapBytes : cardinality * sizeof(UI16);
+                    if(static_cast<Size>(count) * 2 * sizeof(UI16) > expandedBytes) Expand();
+                }
+                return true;
+            }
+
+            UI32 LowerBound(UI16 value) const noexcept
+            {
+                if(count != 0 && pValues[count - 1] < value) return count;
+
+                UI32 low = 0, high = count;
+                while(low < high)
+                {
+                    const UI32 middle = (low + high) / 2;
+                    if(pValues[middle] < value) low = middle + 1;
+                    else high = middle;
+                }
+                return low;
+            }
+
+            void ToBitmap()
+            {
+                const ContainerView view = View();
+                UI64* pNewWords = Allocator::AllocateAligned<UI64>(BitmapBytes, SystemCacheLineSize);
+                std::memset(pNewWords, 0, BitmapBytes);
+
+                auto setBit = [pNewWords](UI32 value) { pNewWords[value >> 6] |= UI64{1} << (value & 63); };
+                view.ForEach(0, setBit);
+
+                ReleaseValues();
+                pWords = pNewWords;
+                type = ContainerType::Bitmap;
+            }
+
+            void ToArray()
+            {
+                const ContainerView view = View();
+                UI16* pNewValues = Allocator::Allocate<UI16>((cardinality == 0 ? 1 : cardinality) * sizeof(UI16));
+
+                UI32 written = 0;
+                auto append = [pNewValues, &written](UI32 value) { pNewValues[written++] = static_cast<UI16>(value); };
+                view.ForEach(0, append);
+
+                Allocator::Deallocate(&pWords);
+                Allocator::Deallocate(&pValues);
+                pValues = pNewValues;
+                capacity = cardinality == 0 ? 1 : cardinality;
+                count = cardinality;
+                type = ContainerType::Array;
+            }
+
+            void ToRuns()
+            {
+                const ContainerView view = View();
+                const UI32 runs = view.RunCount();
+                UI16* pNewValues = Allocator::Allocate<UI16>(runs * 2 * sizeof(UI16));
+
+                UI32 written = 0;
+                UI32 previous = 0;
+                auto extend = [pNewValues, &written, &previous](UI32 value)
+                {
+                    if(written != 0 && value == previous + 1) pNewValues[written * 2 - 1]++;
+                    else
+                    {
+                        pNewValues[written * 2] = static_cast<UI16>(value);
+                        pNewValues[written * 2 + 1] = 0;
+                        written++;
+                    }
+                    previous = value;
+                };
+                view.ForEach(0, extend);
+
+                Allocator::Deallocate(&pWords);
+                Allocator::Deallocate(&pValues);
+                pValues = pNewValues;
+                capacity = runs * 2;
+                count = runs;
+                type = ContainerType::Run;
+            }
+
+            /**
+             * \brief Turns a run container back into an array or a bitmap
+             */
+            void Expand()
+            {
+                if(cardinality > ArrayMaxCardinality) ToBitmap();
+                else ToArray();
+            }
+
+            /**
+             * \brief Picks the representation that fits the cardinality after a bulk operation
+             */
+            void Normalize()
+            {
+                if(type == ContainerType::Bitmap && cardinality <= ArrayMaxCardinality) ToArray();
+                else if(type == ContainerType::Array && cardinality > ArrayMaxCardinality) ToBitmap();
+            }
+
+            /**
+             * \brief Turns a bitmap that Remove left with 4096 values or fewer into an array, then switches to runs
+             * when they take less memory. Returns if the representation changed
+             */
+            bool RunOptimize()
+            {
+                if(type == ContainerType::Run) return false;
+
+                const bool shrunk = type == ContainerType::Bitmap && cardinality <= ArrayMaxCardinality;
+                if(shrunk) ToArray();
+
+                const Size runBytes = static_cast<Size>(View().RunCount()) * 2 * sizeof(UI16);
+                if(runBytes >= View().PayloadBytes()) return shrunk;
+
+                ToRuns();
+                return true;
+            }
+        };
+
+        /**
+         * \brief Expands run views into `scratch`, so the set operations only deal with arrays and bitmaps
+         */
+        inline ContainerView Expanded(const ContainerView& view, Container*& pScratch)
+        {
+            if(view.type != ContainerType::Run) return view;
+
+            pScratch = Container::FromView(view);
+            pScratch->Expand();
+            return pScratch->View();
+        }
+
+        inline void SetBit(UI64* pWords, UI32 value) noexcept
+        {
+            pWords[value >> 6] |= UI64{1} << (value & 63);
+        }
+
+        inline bool TestBit(const UI64* pWords, UI32 value) noexcept
+        {
+            return (pWords[value >> 6] >> (value & 63) & 1) != 0;
+        }
+
+        /**
+         * \brief Number of values in both containers, without building the intersection
+         */
+        inline UI32 AndCardinality(const ContainerView& first, const ContainerView& second)
+        {
+            Container* pFirstScratch = nullptr;
+            Container* pSecondScratch = nullptr;
+            const ContainerView a = Expanded(first, pFirstScratch);
+            const ContainerView b = Expanded(second, pSecondScratch);
+
+            UI32 result = 0;
+            if(a.type == ContainerType::Bitmap && b.type == ContainerType::Bitmap)
+            {
+                for(UI32 i = 0; i < BitmapWords; i++) result += PopCount(a.pWords[i] & b.pWords[i]);
+            }
+            else if(a.type == ContainerType::Bitmap || b.type == ContainerType::Bitmap)
+            {
+                const ContainerView& array = a.type == ContainerType::Array ? a : b;
+                const ContainerView& bitmap = a.type == ContainerType::Bitmap ? a : b;
+                for(UI32 i = 0; i < array.count; i++) result += TestBit(bitmap.pWords, array.pValues[i]);
+            }
+            else
+            {
+                UI32 i = 0, j = 0;
+                while(i < a.count && j < b.count)
+                {
+                    const UI16 x = a.pValues[i], y = b.pValues[j];
+                    result += x == y;
+                    i += x <= y;
+                    j += y <= x;
+                }
+            }
+
+            delete pFirstScratch;
+            delete pSecondScratch;
+            return result;
+        }
+
+        inline Container* Or(const ContainerView& first, const ContainerView& second)
+        {
+            Container* pFirstScratch = nullptr;
+            Container* pSecondScratch = nullptr;
+            const ContainerView a = Expanded(first, pFirstScratch);
+            const ContainerView b = Expanded(second, pSecondScratch);
+
+            auto pResult = new Container();
+            if(a.type == ContainerType::Array && b.type == ContainerType::Array &&
+               a.cardinality + b.cardinality <= ArrayMaxCardinality)
+            {
+                pResult->Reserve(a.count + b.count);
+                UI32 i = 0, j = 0, written = 0;
+                while(i < a.count && j < b.count)
+                {
+                    const UI16 x = a.pValues[i], y = b.pValues[j];
+                    pResult->pValues[written++] = x <= y ? x : y;
+                    i += x <= y;
+                    j += y <= x;
+                }
+                while(i < a.count) pResult->pValues[written++] = a.pValues[i++];
+                while(j < b.count) pResult->pValues[written++] = b.pValues[j++];
+
+                pResult->count = written;
+                pResult->cardinality = written;
+            }
+            else
+            {
+                pResult->type = ContainerType::Bitmap;
+                pResult->AllocateWords();
+
+                if(a.type == ContainerType::Bitmap && b.type == ContainerType::Bitmap)
+                {
+                    BitKernels::Or(pResult->pWords, a.pWords, b.pWords, BitmapWords);
+                }
+                else
+                {
+                    for(const ContainerView* pView : {&a, &b})
+                    {
+                        if(pView->type == ContainerType::Bitmap)
+                        {
+                            BitKernels::Or(pResult->pWords, pResult->pWords, pView->pWords, BitmapWords);
+                        }
+                        else
+                        {
+                            for(UI32 i = 0; i < pView->count; i++) SetBit(pResult->pWords, pView->pValues[i]);
+                        }
+                    }
+                }
+
+                pResult->cardinality = static_cast<UI32>(BitKernels::Count(pResult->pWords, BitmapWords));
+                pResult->Normalize();
+            }
+
+            delete pFirstScratch;
+            delete pSecondScratch;
+            return pResult;
+        }
+
+        inline Container* And(const ContainerView& first, const ContainerView& second)
+        {
+            Container* pFirstScratch = nullptr;
+            Container* pSecondScratch = nullptr;
+            const ContainerView a = Expanded(first, pFirstScratch);
+            const ContainerView b = Expanded(second, pSecondScratch);
+
+            auto pResult = new Container();
+            if(a.type == ContainerType::Bitmap && b.type == ContainerType::Bitmap)
+            {
+                const UI32 cardinality = AndCardinality(a, b);
+                if(cardinality > ArrayMaxCardinality)
+                {
+                    pResult->type = ContainerType::Bitmap;
+                    pResult->AllocateWords();
+                    BitKernels::And(pResult->pWords, a.pWords, b.pWords, BitmapWords);
+                }
+                else
+                {
+                    pResult->Reserve(cardinality);
+                    UI32 written = 0;
+                    for(UI32 i = 0; i < BitmapWords; i++)
+                    {
+                        for(UI64 word = a.pWords[i] & b.pWords[i]; word != 0; word &= word - 1)
+                        {
+                            pResult->pValues[written++] = static_cast<UI16>(i * 64 + CountTrailingZeros(word));
+                        }
+                    }
+                    pResult->count = cardinality;
+                }
+                pResult->cardinality = cardinality;
+            }
+            else if(a.type == ContainerType::Bitmap || b.type == ContainerType::Bitmap)
+            {
+                const ContainerView& array = a.type == ContainerType::Array ? a : b;
+                const ContainerView& bitmap = a.type == ContainerType::Bitmap ? a : b;
+
+                pResult->Reserve(array.count);
+                UI32 written = 0;
+                for(UI32 i = 0; i < array.count; i++)
+                {
+                    // Branchless filter: always write, only advance on a hit
+                    pResult->pValues[written] = array.pValues[i];
+                    written += TestBit(bitmap.pWords, array.pValues[i]);
+                }
+                pResult->count = written;
+                pResult->cardinality = written;
+            }
+            else
+            {
+                pResult->Reserve(a.count < b.count ? a.count : b.count);
+                UI32 i = 0, j = 0, written = 0;
+                while(i < a.count && j < b.count)
+                {
+                    const UI16 x = a.pValues[i], y = b.pValues[j];
+                    if(x == y) pResult->pValues[written++] = x;
+                    i += x <= y;
+                    j += y <= x;
+                }
+                pResult->count = written;
+                pResult->cardinality = written;
+            }
+
+            delete pFirstScratch;
+            delete pSecondScratch;
+            return pResult;
+        }
+
+        inline Container* AndNot(const ContainerView& first, const ContainerView& second)
+        {
+            Container* pFirstScratch = nullptr;
+            Container* pSecondScratch = nullptr;
+            const ContainerView a = Expanded(first, pFirstScratch);
+            const ContainerView b = Expanded(second, pSecondScratch);
+
+            auto pResult = new Container();
+            if(a.type == ContainerType::Bitmap)
+            {
+                pResult->type = ContainerType::Bitmap;
+                pResult->AllocateWords();
+                if(b.type == ContainerType::Bitmap)
+                {
+                    BitKernels::AndNot(pResult->pWords, a.pWords, b.pWords, BitmapWords);
+                }
+                else
+                {
+                    std::memcpy(pResult->pWords, a.pWords, BitmapBytes);
+                    for(UI32 i = 0; i < b.count; i++)
+                    {
+                        pResult->pWords[b.pValues[i] >> 6] &= ~(UI64{1} << (b.pValues[i] & 63));
+                    }
+                }
+                pResult->cardinality = static_cast<UI32>(BitKernels::Count(pResult->pWords, BitmapWords));
+                pResult->Normalize();
+            }
+            else if(b.type == ContainerType::Bitmap)
+            {
+                pResult->Reserve(a.count);
+                UI32 written = 0;
+                for(UI32 i = 0; i < a.count; i++)
+                {
+                    pResult->pValues[written] = a.pValues[i];
+                    written += !TestBit(b.pWords, a.pValues[i]);
+                }
+                pResult->count = written;
+                pResult->cardinality = written;
+            }
+            else
+            {
+                pResult->Reserve(a.count);
+                UI32 i = 0, j = 0, written = 0;
+                while(i < a.count)
+                {
+                    while(j < b.count && b.pValues[j] < a.pValues[i]) j++;
+                    if(j == b.count || b.pValues[j] != a.pValues[i]) pResult->pValues[written++] = a.pValues[i];
+                    i++;
+                }
+                pResult->count = written;
+                pResult->cardinality = written;
+            }
+
+            delete pFirstScratch;
+            delete pSecondScratch;
+            return pResult;
+        }
+
+        /**
+         * \brief Serialized layout, little endian, meant to be used in place (e.g. from a mapped file):
+         * a Header, one Directory entry per container sorted by key, then the payloads, each starting at an offset
+         * that is a multiple of 8 so bitmaps can be read as words
+         */
+        struct SerializedHeader
+        {
+            UI32 magic;
+            UI32 containerCount;
+        };
+
+        struct SerializedDirectory
+        {
+            UI16 key;
+            UI16 type;
+            UI32 cardinality;
+            UI32 count;
+            UI32 offset;
+        };
+
+        constexpr UI32 SerializedMagic = 0x31425257; // "WRB1"
+
+        constexpr Size AlignPayload(Size bytes) noexcept
+        {
+            return (bytes + 7) & ~Size{7};
+        }
+    }
+
+    /**
+     * \brief Read-only RoaringBitmap over serialized bytes. Nothing is parsed or copied: the directory and the
+     * containers are read straight from the buffer, which has to be 8-byte aligned and outlive the view
+     */
+    class FrozenRoaringBitmap
+    {
+    public:
+        /**
+         * \brief Checks the header and that every container lies inside the buffer, throws std::invalid_argument
+         */
+        FrozenRoaringBitmap(const void* pData, Size size)
+        {
+            using namespace RoaringInternal;
+
+            if(reinterpret_cast<uintptr_t>(pData) % 8 != 0)
+                throw std::invalid_argument("FrozenRoaringBitmap: buffer has to be 8-byte aligned");
+            if(size < sizeof(SerializedHeader))
+                throw std::invalid_argument("FrozenRoaringBitmap: buffer too small");
+
+            pBytes = static_cast<const Byte*>(pData);
+            const auto pHeader = reinterpret_cast<const SerializedHeader*>(pBytes);
+            if(pHeader->magic != SerializedMagic)
+                throw std::invalid_argument("FrozenRoaringBitmap: not a serialized RoaringBitmap");
+
+            containerCount = pHeader->containerCount;
+            if(size < sizeof(SerializedHeader) + static_cast<Size>(containerCount) * sizeof(SerializedDirectory))
+                throw std::invalid_argument("FrozenRoaringBitmap: truncated directory");
+
+            pDirectory = reinterpret_cast<const SerializedDirectory*>(pBytes + sizeof(SerializedHeader));
+            for(UI32 i = 0; i < containerCount; i++)
+            {
+                const ContainerView view = View(i);
+                const SerializedDirectory& entry = pDirectory[i];
+                if(entry.type < 1 || entry.type > 3 || entry.offset % 8 != 0 ||
+                   static_cast<Size>(entry.offset) + view.PayloadBytes() > size ||
+                   (i != 0 && pDirectory[i - 1].key >= entry.key))
+                    throw std::invalid_argument("FrozenRoaringBitmap: corrupted container");
+            }
+        }
+
+        /**
+         * \brief Returns if the value is in the bitmap
+         */
+        bool Contains(UI32 value) const noexcept
+        {
+            const UI16 key = static_cast<UI16>(value >> 16);
+            UI32 low = 0, high = containerCount;
+            while(low < high)
+            {
+                const UI32 middle = (low + high) / 2;
+                if(pDirectory[middle].key < key) low = middle + 1;
+                else high = middle;
+            }
+            return low < containerCount && pDirectory[low].key == key &&
+                   View(low).Contains(static_cast<UI16>(value));
+        }
+
+        /**
+         * \brief Returns the number of values, read from the directory
+         */
+        UI64 Cardinality() const noexcept
+        {
+            UI64 result = 0;
+            for(UI32 i = 0; i < containerCount; i++) result += pDirectory[i].cardinality;
+            return result;
+        }
+
+        /**
+         * \brief Returns if the bitmap has no values
+         */
+        bool IsEmpty() const noexcept
+        {
+            return containerCount == 0;
+        }
+
+        /**
+         * \brief Calls function with every value in increasing order
+         */
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(UI32 i = 0; i < containerCount; i++)
+            {
+                View(i).ForEach(static_cast<UI32>(pDirectory[i].key) << 16, function);
+            }
+        }
+
+        /**
+         * \brief Returns the number of 64K chunks
+         */
+        UI32 ContainerCount() const noexcept
+        {
+            return containerCount;
+        }
+
+        UI16 Key(UI32 index) const noexcept
+        {
+            return pDirectory[index].key;
+        }
+
+        RoaringInternal::ContainerView View(UI32 index) const noexcept
+        {
+            using namespace RoaringInternal;
+
+            const SerializedDirectory& entry = pDirectory[index];
+            const Byte* pPayload = pBytes + entry.offset;
+            return {static_cast<ContainerType>(entry.type), entry.cardinality, entry.count,
+                    reinterpret_cast<const UI16*>(pPayload), reinterpret_cast<const UI64*>(pPayload)};
+        }
+
+    private:
+        const Byte* pBytes;
+        const RoaringInternal::SerializedDirectory* pDirectory;
+        UI32 containerCount;
+    };
+
+    /**
+     * \brief Compressed set of 32-bit integers. Values are split by their high 16 bits into chunks, each stored as a
+     * sorted array (up to 4096 values), a 1024-word bitmap, or runs of consecutive values (after RunOptimize).
+     * Set operations between two bitmap chunks go through the SIMD BitKernels, chunks involving arrays use scalar
+     * merges and branchless filters. Every chunk keeps its cardinality
+     */
+    class RoaringBitmap
+    {
+        typedef RoaringInternal::Container Container;
+        typedef RoaringInternal::ContainerView ContainerView;
+
+        struct Entry
+        {
+            UI16 key;
+            Container* pContainer;
+        };
+
+    public:
+        /**
+         * \brief Default constructor
+         */
+        RoaringBitmap() = default;
+
+        /**
+         * \brief Constructor with an initializer list of values
+         */
+        RoaringBitmap(std::initializer_list<UI32> init)
+        {
+            for(const UI32 value : init) Add(value);
+        }
+
+        /**
+         * \brief Copies the containers out of a serialized bitmap
+         */
+        explicit RoaringBitmap(const FrozenRoaringBitmap& frozen)
+        {
+            for(UI32 i = 0; i < frozen.ContainerCount(); i++)
+            {
+                entries.PushBack({frozen.Key(i), Container::FromView(frozen.View(i))});
+            }
+        }
+
+        /**
+         * \brief Copy constructor
+         */
+        RoaringBitmap(const RoaringBitmap& other)
+        {
+            for(const Entry& entry : other.entries)
+            {
+                entries.PushBack({entry.key, Container::FromView(entry.pContainer->View())});
+            }
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        RoaringBitmap(RoaringBitmap&& other) noexcept : entries(std::move(other.entries))
+        {
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~RoaringBitmap()
+        {
+            Clear();
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        RoaringBitmap& operator=(const RoaringBitmap& other)
+        {
+            if(this == &other) return *this;
+
+            RoaringBitmap copy(other);
+            entries.Swap(copy.entries);
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        RoaringBitmap& operator=(RoaringBitmap&& other) noexcept
+        {
+            if(this == &other) return *this;
+
+            Clear();
+            entries.Swap(other.entries);
+            return *this;
+        }
+
+        /**
+         * \brief Adds a value, returns if it was not there yet
+         */
+        bool Add(UI32 value)
+        {
+            const UI16 key = static_cast<UI16>(value >> 16);
+            bool found = false;
+            const Size index = FindKey(key, found);
+
+            if(!found)
+            {
+                const Entry entry = {key, new Container()};
+                if(index == entries.Size()) entries.PushBack(entry);
+                else entries.Insert(index, entry);
+            }
+            return entries[index].pContainer->Add(static_cast<UI16>(value));
+        }
+
+        /**
+         * \brief Adds count values, sorted input only looks up each chunk once
+         */
+        void AddMany(const UI32* pValues, Size count)
+        {
+            Container* pLast = nullptr;
+            UI16 lastKey = 0;
+            for(Size i = 0; i < count; i++)
+            {
+                const UI16 key = static_cast<UI16>(pValues[i] >> 16);
+                if(pLast == nullptr || key != lastKey)
+                {
+                    Add(pValues[i]);
+                    bool found = false;
+                    pLast = entries[FindKey(key, found)].pContainer;
+                    lastKey = key;
+                }
+                else
+                {
+                    pLast->Add(static_cast<UI16>(pValues[i]));
+                }
+            }
+        }
+
+        /**
+         * \brief Removes a value, returns if it was there
+         */
+        bool Remove(UI32 value)
+        {
+            bool found = false;
+            const Size index = FindKey(static_cast<UI16>(value >> 16), found);
+            if(!found) return false;
+
+            Container* pContainer = entries[index].pContainer;
+            if(!pContainer->Remove(static_cast<UI16>(value))) return false;
+
+            if(pContainer->cardinality == 0)
+            {
+                delete pContainer;
+                entries.Erase(index);
+            }
+            return true;
+        }
+
+        /**
+         * \brief Returns if the value is in the bitmap
+         */
+        bool Contains(UI32 value) const noexcept
+        {
+            bool found = false;
+            const Size index = FindKey(static_cast<UI16>(value >> 16), found);
+            return found && entries[index].pContainer->View().Contains(static_cast<UI16>(value));
+        }
+
+        /**
+         * \brief Returns the number of values, O(number of chunks)
+         */
+        UI64 Cardinality() const noexcept
+        {
+            UI64 result = 0;
+            for(const Entry& entry : entries) result += entry.pContainer->cardinality;
+            return result;
+        }
+
+        /**
+         * \brief Returns if the bitmap has no values
+         */
+        bool IsEmpty() const noexcept
+        {
+            return entries.IsEmpty();
+        }
+
+        /**
+         * \brief Removes every value
+         */
+        void Clear()
+        {
+            for(const Entry& entry : entries) delete entry.pContainer;
+            entries.Clear();
+        }
+
+        /**
+         * \brief Returns the smallest value. Throws std::out_of_range if the bitmap is empty
+         */
+        UI32 Minimum() const
+        {
+            if(entries.IsEmpty()) throw std::out_of_range("RoaringBitmap::Minimum: bitmap is empty");
+            return static_cast<UI32>(entries[0].key) << 16 | entries[0].pContainer->View().Minimum();
+        }
+
+        /**
+         * \brief Returns the largest value. Throws std::out_of_range if the bitmap is empty
+         */
+        UI32 Maximum() const
+        {
+            if(entries.IsEmpty()) throw std::out_of_range("RoaringBitmap::Maximum: bitmap is empty");
+            const Entry& last = entries[entries.Size() - 1];
+            return static_cast<UI32>(last.key) << 16 | last.pContainer->View().Maximum();
+        }
+
+        /**
+         * \brief Calls function with every value in increasing order
+         */
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(const Entry& entry : entries)
+            {
+                entry.pContainer->View().ForEach(static_cast<UI32>(entry.key) << 16, function);
+            }
+        }
+
+        /**
+         * \brief Returns every value in increasing order
+         */
+        Vector<UI32> ToVector() const
+        {
+            Vector<UI32> values;
+            values.SetCapacity(static_cast<Size>(Cardinality()));
+            ForEach([&values](UI32 value) { values.PushBack(value); });
+            return values;
+        }
+
+        /**
+         * \brief Converts chunks to runs of consecutive values wherever that is smaller, and bitmaps shrunk to 4096
+         * values or fewer back to arrays. Returns if any changed
+         */
+        bool RunOptimize()
+        {
+            bool changed = false;
+            for(const Entry& entry : entries) changed |= entry.pContainer->RunOptimize();
+            return changed;
+        }
+
+        /**
+         * \brief Returns the amount of heap memory used by the containers
+         */
+        Size MemoryUsage() const noexcept
+        {
+            Size bytes = entries.Capacity() * sizeof(Entry);
+            for(const Entry& entry : entries)
+            {
+                const Container& container = *entry.pContainer;
+                bytes += sizeof(Container);
+                bytes += container.type == RoaringInternal::ContainerType::Bitmap
+                    ? RoaringInternal::BitmapBytes : container.capacity * sizeof(UI16);
+            }
+            return bytes;
+        }
+
+        /**
+         * \brief Union. The merged entries are complete before they replace the current ones, so a throwing
+         * allocation leaves the bitmap unchanged
+         */
+        RoaringBitmap& operator|=(const RoaringBitmap& other)
+        {
+            Vector<Entry> merged;
+            merged.SetCapacity(entries.Size() + other.entries.Size());
+            Vector<Container*> created;
+            created.SetCapacity(other.entries.Size());
+            Vector<Container*> replaced;
+            replaced.SetCapacity(other.entries.Size());
+
+            try
+            {
+                Size i = 0, j = 0;
+                while(i < entries.Size() || j < other.entries.Size())
+                {
+                    if(j == other.entries.Size() || (i < entries.Size() && entries[i].key < other.entries[j].key))
+                    {
+                        merged.PushBack(entries[i++]);
+                    }
+                    else if(i == entries.Size() || other.entries[j].key < entries[i].key)
+                    {
+                        const Entry& entry = other.entries[j++];
+                        created.PushBack(Container::FromView(entry.pContainer->View()));
+                        merged.PushBack({entry.key, created.Back()});
+                    }
+                    else
+                    {
+                        const Container* pOld = entries[i].pContainer;
+                        created.PushBack(RoaringInternal::Or(pOld->View(), other.entries[j].pContainer->View()));
+                        replaced.PushBack(entries[i].pContainer);
+                        merged.PushBack({entries[i].key, created.Back()});
+                        i++;
+                        j++;
+                    }
+                }
+            }
+            catch(...)
+            {
+                for(Container* pContainer : created) delete pContainer;
+                throw;
+            }
+
+            entries.Swap(merged);
+            for(Container* pContainer : replaced) delete pContainer;
+            return *this;
+        }
+
+        /**
+         * \brief Intersection
+         */
+        RoaringBitmap& operator&=(const RoaringBitmap& other)
+        {
+            RoaringBitmap result = *this & other;
+            entries.Swap(result.entries);
+            return *this;
+        }
+
+        /**
+         * \brief Difference, removes every value that is in other. Like the union, the old containers are only
+         * deleted once the new entries have replaced them
+         */
+        RoaringBitmap& operator-=(const RoaringBitmap& other)
+        {
+            Vector<Entry> kept;
+            kept.SetCapacity(entries.Size());
+            Vector<Container*> created;
+            created.SetCapacity(entries.Size());
+            Vector<Container*> replaced;
+            replaced.SetCapacity(entries.Size());
+
+            try
+            {
+                Size j = 0;
+                for(Size i = 0; i < entries.Size(); i++)
+                {
+                    while(j < other.entries.Size() && other.entries[j].key < entries[i].key) j++;
+
+                    if(j == other.entries.Size() || other.entries[j].key != entries[i].key)
+                    {
+                        kept.PushBack(entries[i]);
+                        continue;
+                    }
+
+                    created.PushBack(RoaringInternal::AndNot(entries[i].pContainer->View(),
+                                                             other.entries[j].pContainer->View()));
+                    replaced.PushBack(entries[i].pContainer);
+                    if(created.Back()->cardinality != 0) kept.PushBack({entries[i].key, created.Back()});
+                }
+            }
+            catch(...)
+            {
+                for(Container* pContainer : created) delete pContainer;
+                throw;
+            }
+
+            entries.Swap(kept);
+            for(Container* pContainer : replaced) delete pContainer;
+            for(Container* pContainer : created)
+            {
+                if(pContainer->cardinality == 0) delete pContainer;
+            }
+            return *this;
+        }
+
+        RoaringBitmap operator|(const RoaringBitmap& other) const
+        {
+            RoaringBitmap result(*this);
+            result |= other;
+            return result;
+        }
+
+        RoaringBitmap operator&(const RoaringBitmap& other) const
+        {
+            RoaringBitmap result;
+            Size i = 0, j = 0;
+            while(i < entries.Size() && j < other.entries.Size())
+            {
+                if(entries[i].key < other.entries[j].key) i++;
+                else if(other.entries[j].key < entries[i].key) j++;
+                else
+                {
+                    Container* pNew = RoaringInternal::And(entries[i].pContainer->View(), other.entries[j].pContainer->View());
+                    if(pNew->cardinality == 0) delete pNew;
+                    else result.entries.PushBack({entries[i].key, pNew});
+                    i++;
+                    j++;
+                }
+            }
+            return result;
+        }
+
+        RoaringBitmap operator-(const RoaringBitmap& other) const
+        {
+            RoaringBitmap result(*this);
+            result -= other;
+            return result;
+        }
+
+        /**
+         * \brief Returns the size of the intersection without building it
+         */
+        static UI64 AndCardinality(const RoaringBitmap& a, const RoaringBitmap& b)
+        {
+            UI64 result = 0;
+            Size i = 0, j = 0;
+            while(i < a.entries.Size() && j < b.entries.Size())
+            {
+                if(a.entries[i].key < b.entries[j].key) i++;
+                else if(b.entries[j].key < a.entries[i].key) j++;
+                else result += RoaringInternal::AndCardinality(a.entries[i++].pContainer->View(), b.entries[j++].pContainer->View());
+            }
+            return result;
+        }
+
+        bool operator==(const RoaringBitmap& other) const
+        {
+            if(entries.Size() != other.entries.Size()) return false;
+
+            for(Size i = 0; i < entries.Size(); i++)
+            {
+                const Entry& a = entries[i];
+                const Entry& b = other.entries[i];
+                if(a.key != b.key || a.pContainer->cardinality != b.pContainer->cardinality) return false;
+                if(RoaringInternal::AndCardinality(a.pContainer->View(), b.pContainer->View()) != a.pContainer->cardinality) return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const RoaringBitmap& other) const
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * \brief Returns the number of bytes Serialize writes
+         */
+        Size SerializedSize() const noexcept
+        {
+            Size bytes = sizeof(RoaringInternal::SerializedHeader) + entries.Size() * sizeof(RoaringInternal::SerializedDirectory);
+            for(const Entry& entry : entries)
+            {
+                bytes = RoaringInternal::AlignPayload(bytes) + entry.pContainer->View().PayloadBytes();
+            }
+            return RoaringInternal::AlignPayload(bytes);
+        }
+
+        /**
+         * \brief Writes the bitmap into pBuffer, which needs SerializedSize() bytes. The result can be used in place
+         * through FrozenRoaringBitmap, or copied back with RoaringBitmap(FrozenRoaringBitmap)
+         */
+        void Serialize(void* pBuffer) const
+        {
+            using namespace RoaringInternal;
+
+            auto pBytes = static_cast<Byte*>(pBuffer);
+            const SerializedHeader header = {SerializedMagic, static_cast<UI32>(entries.Size())};
+            std::memcpy(pBytes, &header, sizeof(header));
+
+            Size offset = sizeof(SerializedHeader) + entries.Size() * sizeof(SerializedDirectory);
+            for(Size i = 0; i < entries.Size(); i++)
+            {
+                const ContainerView view = entries[i].pContainer->View();
+                const Size aligned = AlignPayload(offset);
+                std::memset(pBytes + offset, 0, aligned - offset);
+                offset = aligned;
+
+                const SerializedDirectory directory = {entries[i].key, static_cast<UI16>(view.type), view.cardinality,
+                                                       view.count, static_cast<UI32>(offset)};
+                std::memcpy(pBytes + sizeof(SerializedHeader) + i * sizeof(SerializedDirectory), &directory, sizeof(directory));
+
+                const void* pPayload = view.type == ContainerType::Bitmap
+                    ? static_cast<const void*>(view.pWords) : static_cast<const void*>(view.pValues);
+                std::memcpy(pBytes + offset, pPayload, view.PayloadBytes());
+                offset += view.PayloadBytes();
+            }
+            std::memset(pBytes + offset, 0, AlignPayload(offset) - offset);
+        }
+
+    private:
+        /**
+         * \brief Index of the chunk with the key, or where it would be inserted
+         */
+        Size FindKey(UI16 key, bool& found) const noexcept
+        {
+            Size low = 0, high = entries.Size();
+
+            // Values usually arrive in increasing order, check the last chunk first
+            if(high != 0 && entries[high - 1].key < key)
+            {
+                found = false;
+                return high;
+            }
+
+            while(low < high)
+            {
+                const Size middle = (low + high) / 2;
+                if(entries[middle].key < key) low = middle + 1;
+                else high = middle;
+            }
+            found = low < entries.Size() && entries[low].key == key;
+            return low;
+        }
+
+        Vector<Entry> entries;
+    };
+}
@@ -381,6 +381,46 @@ namespace WSTL
             }
         }
 
+        /**
+         * \brief Moves every element of other in front of the element at index, or to the back if index is Size().
+         * The nodes are relinked, nothing is allocated or copied
+         */
+        void Splice(::Size index, Self& other)
+        {
+            Splice(index, other, 0, other.size);
+        }
+
+        /**
+         * \brief Moves count elements of other, starting at otherIndex, in front of the element at index, or to the
+         * back if index is Size(). The nodes are relinked, nothing is allocated or copied
+         */
+        void Splice(::Size index, Self& other, ::Size otherIndex, ::Size count = 1)
+        {
+            if(this == &other) throw std::invalid_argument("Cannot splice a list into itself.");
+            if(index > size) throw std::out_of_range("Index out of range.");
+            if(otherIndex > other.size || count > other.size - otherIndex) throw std::out_of_range("Index out of range.");
+            if(count == 0) return;
+
+            // Unlink [pFirst, pLast] from other, which needs the node before pFirst
+            Node* pBefore = otherIndex == 0 ? nullptr : other.NodeAt(otherIndex - 1);
+            Node* pFirst = pBefore != nullptr ? pBefore->pNext : other.pHead;
+            Node* pLast = pFirst;
+            for(::Size i = 1; i < count; ++i) pLast = pLast->pNext;
+
+            if(pBefore != nullptr) pBefore->pNext = pLast->pNext;
+            else other.pHead = pLast->pNext;
+            if(pLast == other.pTail) other.pTail = pBefore;
+            other.size -= count;
+
+            // Link it after the node at index - 1
+            Node* pPrev = index == 0 ? nullptr : NodeAt(index - 1);
+            pLast->pNext = pPrev != nullptr ? pPrev->pNext : pHead;
+            if(pPrev != nullptr) pPrev->pNext = pFirst;
+            else pHead = pFirst;
+            if(pLast->pNext == nullptr) pTail = pLast;
+            size += count;
+        }
+
         /**
          * \brief Returns the value at the front
          */
@@ -1,5 +1,8 @@
 ﻿#pragma once
+#include <stdexcept>
 
+#include "WSTL/containers/NodeHandle.hpp"
+#include "WSTL/containers/Span.hpp"
 #include "WSTL/containers/trees/RBTree.hpp"
 
 namespace WSTL
@@ -10,6 +13,9 @@ namespace WSTL
         typedef Set<Value> Self;
 
     public:
+        typedef RBTNode<Value, RBTKeyOnly> Node;
+        typedef NodeHandle<Node> NodeType;
+
         /**
          * \brief Default constructor
          */
@@ -52,8 +58,7 @@ namespace WSTL
         Self& operator=(Self&& other) noexcept
         {
             if(this == &other) return *this;
-            tree = other.tree;
-            other.tree = RBTree<Value, bool>();
+            tree = std::move(other.tree);
             return *this;
         }
 
@@ -114,7 +119,9 @@ namespace WSTL
         [[nodiscard]]
         const Value& At(::Size index) const
         {
-            return (*this)[index];
+            auto pNode = tree.LeftToRight(index);
+            if(pNode == nullptr) throw std::out_of_range("Index out of range");
+            return pNode->key;
         }
 
         /**
@@ -122,7 +129,7 @@ namespace WSTL
          */
         void Insert(const Value& value)
         {
-            tree.Insert(value, true);
+            tree.Insert(value);
         }
 
         /**
@@ -130,7 +137,26 @@ namespace WSTL
          */
         void Insert(Value&& value)
         {
-            tree.Insert(std::move(value), true);
+            tree.Insert(std::move(value));
+        }
+
+        /**
+         * \brief Links the node of an extracted value into the set without allocating or copying. Returns false and
+         * leaves the node in the handle if the handle is empty or the value is already in the set
+         */
+        bool Insert(NodeType&& node)
+        {
+            if(node.IsEmpty() || !tree.InsertNode(node.pNode)) return false;
+            node.Release();
+            return true;
+        }
+
+        /**
+         * \brief Unlinks the given value and returns it in a handle, which is empty if it isn't in the set
+         */
+        NodeType Extract(const Value& value)
+        {
+            return NodeType(tree.Extract(value));
         }
 
         /**
@@ -177,16 +203,26 @@ namespace WSTL
          * \brief Checks if set contains specified value
          */
         [[nodiscard]]
-        bool Contains(const Value& value)
+        bool Contains(const Value& value) const
         {
             return tree.Search(value) != nullptr;
         }
 
+        /**
+         * \brief Returns a pointer to the stored value equal to the given one, or nullptr if it isn't in the set
+         */
+        [[nodiscard]]
+        const Value* Find(const Value& value) const
+        {
+            const Node* pNode = tree.Search(value);
+            return pNode == nullptr ? nullptr : &pNode->key;
+        }
+
         /**
          * \brief Returns the minimum value in the set
          */
         [[nodiscard]]
-        const Value& Min()
+        const Value& Min() const
         {
             return tree.Min()->key;
         }
@@ -195,7 +231,7 @@ namespace WSTL
          * \brief Returns the maximum value in the set
          */
         [[nodiscard]]
-        const Value& Max()
+        const Value& Max() const
         {
             return  tree.Max()->key;
         }
@@ -204,18 +240,210 @@ namespace WSTL
          * \brief Returns a Vector containing all values in the set in ascending order
          */
         [[nodiscard]]
-        Vector<Value> ToVector()
+        Vector<Value> ToVector() const
+        {
+            return tree.GetKeys();
+        }
+
+        /**
+         * \brief Returns a Vector containing all values in the set in ascending order
+         */
+        [[nodiscard]]
+        Vector<Value> GetKeys() const
+        {
+            return tree.GetKeys();
+        }
+
+        /**
+         * \brief Calls function(value) for every value in ascending order, without building a Vector
+         */
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            tree.ForEach([&function](const Value& value, RBTKeyOnly) { function(value); });
+        }
+        
+        /**
+         * \brief Returns the node of the first value not less than the given value, or nullptr
+         */
+        [[nodiscard]]
+        const Node* LowerBound(const Value& value) const
+        {
+            return tree.LowerBound(value);
+        }
+
+        /**
+         * \brief Returns the node of the first value greater than the given value, or nullptr
+         */
+        [[nodiscard]]
+        const Node* UpperBound(const Value& value) const
+        {
+            return tree.UpperBound(value);
+        }
+
+        /**
+         * \brief Returns the [first, second) nodes equal to the given value, first == second if it isn't in the set
+         */
+        [[nodiscard]]
+        Pair<const Node*, const Node*> EqualRange(const Value& value) const
+        {
+            const auto range = tree.EqualRange(value);
+            return Pair<const Node*, const Node*>(range.first, range.second);
+        }
+
+        /**
+         * \brief Returns the node that follows the given one in ascending order, or nullptr
+         */
+        [[nodiscard]]
+        static const Node* Next(const Node* pNode)
+        {
+            return RBTree<Value, RBTKeyOnly>::Next(pNode);
+        }
+
+        /**
+         * \brief Calls function(value) for every value with lower <= value < upper in ascending order
+         */
+        template<class Function>
+        void ForEachInRange(const Value& lower, const Value& upper, Function function) const
+        {
+            tree.ForEachInRange(lower, upper, [&function](const Value& value, RBTKeyOnly) { function(value); });
+        }
+
+        /**
+         * \brief Deletes every value with lower <= value < upper, returns how many were deleted
+         */
+        ::Size EraseRange(const Value& lower, const Value& upper)
+        {
+            return tree.EraseRange(lower, upper);
+        }
+
+        /**
+         * \brief Builds a set from strictly increasing values in O(n), without rebalancing. Iterator must be a
+         * forward iterator. Throws std::invalid_argument if the values are not strictly increasing
+         */
+        template<class Iterator>
+        static Self FromSorted(Iterator first, Iterator last)
         {
-            ::Size size = Size();
-            Vector<Value> vec(size);
-            for(::Size i = 0; i < size; i++)
+            ::Size count = 0;
+            Iterator previous = first;
+            for(Iterator it = first; it != last; ++it, count++)
             {
-                vec[i] = At(i);
+                if(count != 0 && !(*previous < *it))
+                    throw std::invalid_argument("Set::FromSorted: values are not strictly increasing");
+                previous = it;
             }
-            return vec;
+
+            Self set;
+            set.tree.AssignSorted(count, [&first]
+            {
+                auto pNode = new Node(*first);
+                ++first;
+                return pNode;
+            });
+            return set;
         }
-        
+
+        /**
+         * \brief Builds a set from strictly increasing values in O(n), e.g. a Vector
+         */
+        static Self FromSorted(Span<const Value> values)
+        {
+            return FromSorted(values.begin(), values.end());
+        }
+
+        /**
+         * \brief Returns the values in this set or in other, by a linear merge in O(n + m)
+         */
+        [[nodiscard]]
+        Self Union(const Self& other) const
+        {
+            return Combine(other, true, true, true);
+        }
+
+        /**
+         * \brief Returns the values in both this set and other, by a linear merge in O(n + m)
+         */
+        [[nodiscard]]
+        Self Intersection(const Self& other) const
+        {
+            return Combine(other, false, true, false);
+        }
+
+        /**
+         * \brief Returns the values in this set that aren't in other, by a linear merge in O(n + m)
+         */
+        [[nodiscard]]
+        Self Difference(const Self& other) const
+        {
+            return Combine(other, true, false, false);
+        }
+
+        /**
+         * \brief Moves the values of other that aren't in this set over in O(n + m), by relinking nodes.
+         * Values already present stay in other
+         */
+        void Merge(Self& other)
+        {
+            tree.Merge(other.tree);
+        }
+
+        /**
+         * \brief Moves the values not less than value into the returned set, in O(log n)
+         */
+        Self Split(const Value& value)
+        {
+            Self right;
+            right.tree = tree.Split(value);
+            return right;
+        }
+
+        /**
+         * \brief Moves every value of other into this set in O(log n + log m). Throws std::invalid_argument if
+         * the values of other are not all greater than the values of this set
+         */
+        void Join(Self& other)
+        {
+            tree.Join(other.tree);
+        }
+
     private:
-        RBTree<Value, bool> tree;
+        /**
+         * \brief Walks both sets in order and keeps the values only in this set, in both, or only in other
+         */
+        Self Combine(const Self& other, bool keepMine, bool keepBoth, bool keepTheirs) const
+        {
+            Vector<const Node*> nodes;
+            const Node* pMine = tree.Min();
+            const Node* pTheirs = other.tree.Min();
+            while(pMine != nullptr || pTheirs != nullptr)
+            {
+                if(pTheirs == nullptr || (pMine != nullptr && pMine->key < pTheirs->key))
+                {
+                    if(keepMine) nodes.PushBack(pMine);
+                    pMine = Next(pMine);
+                }
+                else if(pMine == nullptr || pTheirs->key < pMine->key)
+                {
+                    if(keepTheirs) nodes.PushBack(pTheirs);
+                    pTheirs = Next(pTheirs);
+                }
+                else
+                {
+                    if(keepBoth) nodes.PushBack(pMine);
+                    pMine = Next(pMine);
+                    pTheirs = Next(pTheirs);
+                }
+            }
+
+            Self set;
+            ::Size index = 0;
+            set.tree.AssignSorted(nodes.Size(), [&nodes, &index] { return new Node(nodes[index++]->key); });
+            return set;
+        }
+
+        template<typename K>
+        friend class FlatSet;
+
+        RBTree<Value, RBTKeyOnly> tree;
     };
 }
@@ -0,0 +1,378 @@
+#pragma once
+#include <stdexcept>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/DenseArray.hpp"
+#include "WSTL/containers/Vector.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief 64-bit handle to an element of a SlotMap: the slot it lives in and the generation of that slot when it
+     * was inserted. A default constructed handle never refers to anything
+     */
+    struct SlotHandle
+    {
+        UI32 index = 0xFFFFFFFFu;
+        UI32 generation = 0;
+
+        /**
+         * \brief Returns the handle packed into 64 bits, generation in the high half
+         */
+        UI64 ToBits() const noexcept
+        {
+            return static_cast<UI64>(generation) << 32 | index;
+        }
+
+        /**
+         * \brief Returns the handle packed by ToBits
+         */
+        static SlotHandle FromBits(UI64 bits) noexcept
+        {
+            SlotHandle handle;
+            handle.index = static_cast<UI32>(bits);
+            handle.generation = static_cast<UI32>(bits >> 32);
+            return handle;
+        }
+
+        bool operator==(const SlotHandle& other) const noexcept
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const SlotHandle& other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * \brief Stores elements densely in one array, for linear iteration, and hands out handles that stay valid until
+     * their element is erased. Handles go through a slot array that holds each element's dense position and a
+     * generation counter. Erasing bumps the generation, so a stale handle is detected instead of reaching whatever
+     * reused the slot. Insert, Erase and lookups are O(1). Erasing moves the last element into the hole, so pointers
+     * into the dense array are invalidated by Erase and by growth, while handles are not
+     */
+    template<typename T>
+    class SlotMap
+    {
+        typedef SlotMap<T> Self;
+
+        /**
+         * \brief An occupied slot stores the dense position of its element, a free one the next free slot
+         */
+        struct Slot
+        {
+            UI32 index;
+            UI32 generation;
+        };
+
+        static constexpr UI32 NoSlot = 0xFFFFFFFFu;
+
+    public:
+        /**
+         * \brief Default constructor
+         */
+        SlotMap() = default;
+
+        /**
+         * \brief Copy constructor, handles of other stay valid in the copy
+         */
+        SlotMap(const Self& other) = default;
+
+        /**
+         * \brief Move constructor
+         */
+        SlotMap(Self&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            Self copy(other);
+            Swap(copy);
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Self moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * \brief Swaps the contents with other
+         */
+        void Swap(Self& other) noexcept
+        {
+            slots.Swap(other.slots);
+            denseToSlot.Swap(other.denseToSlot);
+            values.Swap(other.values);
+            std::swap(freeHead, other.freeHead);
+        }
+
+        /**
+         * \brief Returns the number of elements
+         */
+        ::Size Size() const noexcept
+        {
+            return values.Size();
+        }
+
+        /**
+         * \brief Returns whether there are no elements
+         */
+        bool IsEmpty() const noexcept
+        {
+            return values.IsEmpty();
+        }
+
+        /**
+         * \brief Returns the number of elements that fit before the dense array grows
+         */
+        ::Size Capacity() const noexcept
+        {
+            return values.Capacity();
+        }
+
+        /**
+         * \brief Makes room for amount elements
+         */
+        void Reserve(::Size amount)
+        {
+            values.Reserve(amount);
+            if(amount > denseToSlot.Capacity()) denseToSlot.SetCapacity(amount);
+        }
+
+        /**
+         * \brief Inserts a copy of value and returns its handle
+         */
+        SlotHandle Insert(const T& value)
+        {
+            return Emplace(value);
+        }
+
+        /**
+         * \brief Inserts value by moving it and returns its handle
+         */
+        SlotHandle Insert(T&& value)
+        {
+            return Emplace(std::move(value));
+        }
+
+        /**
+         * \brief Constructs an element in place and returns its handle
+         */
+        template<class... Args>
+        SlotHandle Emplace(Args&&... args)
+        {
+            if(values.Size() >= NoSlot) throw std::length_error("SlotMap: too many elements");
+
+            UI32 slotIndex = freeHead;
+            const bool newSlot = slotIndex == NoSlot;
+            if(newSlot)
+            {
+                slotIndex = static_cast<UI32>(slots.Size());
+                slots.PushBack(Slot{ 0, 1 });
+            }
+
+            // The value goes in last, so if anything throws the slot and the dense entry are all there is to undo
+            try
+            {
+                denseToSlot.PushBack(slotIndex);
+                values.EmplaceBack(std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                if(denseToSlot.Size() > values.Size()) denseToSlot.PopBack();
+                if(newSlot) slots.PopBack();
+                throw;
+            }
+            if(!newSlot) freeHead = slots[slotIndex].index;
+
+            Slot& slot = slots[slotIndex];
+            slot.index = static_cast<UI32>(values.Size() - 1);
+
+            SlotHandle handle;
+            handle.index = slotIndex;
+            handle.generation = slot.generation;
+            return handle;
+        }
+
+        /**
+         * \brief Erases the element of the handle, returns false if the handle is stale
+         */
+        bool Erase(SlotHandle handle)
+        {
+            if(!Contains(handle)) return false;
+
+            Slot& slot = slots[handle.index];
+            const UI32 dense = slot.index;
+            const UI32 last = static_cast<UI32>(values.Size() - 1);
+            if(dense != last)
+            {
+                denseToSlot[dense] = denseToSlot[last];
+                slots[denseToSlot[dense]].index = dense;
+            }
+            values.EraseSwap(dense);
+            denseToSlot.PopBack();
+
+            Release(slot, handle.index);
+            return true;
+        }
+
+        bool Remove(SlotHandle handle)
+        {
+            return Erase(handle);
+        }
+
+        /**
+         * \brief Erases every element. All handles handed out so far become stale
+         */
+        void Clear()
+        {
+            for(::Size i = 0; i < values.Size(); i++) Release(slots[denseToSlot[i]], denseToSlot[i]);
+            values.Clear();
+            denseToSlot.Clear();
+        }
+
+        /**
+         * \brief Returns whether the handle refers to an element. A free slot holds a free list link instead of a
+         * dense position, so the slot also has to be the owner of the dense position it points at
+         */
+        bool Contains(SlotHandle handle) const noexcept
+        {
+            if(handle.index >= slots.Size()) return false;
+
+            const Slot& slot = slots.Data()[handle.index];
+            return slot.generation == handle.generation && slot.index < values.Size() &&
+                denseToSlot.Data()[slot.index] == handle.index;
+        }
+
+        /**
+         * \brief Returns a pointer to the element of the handle, or nullptr if the handle is stale
+         */
+        T* Find(SlotHandle handle) noexcept
+        {
+            return Contains(handle) ? values.Data() + slots.Data()[handle.index].index : nullptr;
+        }
+
+        const T* Find(SlotHandle handle) const noexcept
+        {
+            return Contains(handle) ? values.Data() + slots.Data()[handle.index].index : nullptr;
+        }
+
+        /**
+         * \brief Returns the element of the handle. Throws std::out_of_range if the handle is stale
+         */
+        T& At(SlotHandle handle)
+        {
+            T* pValue = Find(handle);
+            if(pValue == nullptr) throw std::out_of_range("SlotMap: stale handle");
+            return *pValue;
+        }
+
+        const T& At(SlotHandle handle) const
+        {
+            const T* pValue = Find(handle);
+            if(pValue == nullptr) throw std::out_of_range("SlotMap: stale handle");
+            return *pValue;
+        }
+
+        T& operator[](SlotHandle handle)
+        {
+            return At(handle);
+        }
+
+        const T& operator[](SlotHandle handle) const
+        {
+            return At(handle);
+        }
+
+        /**
+         * \brief Returns the handle of the element at the given dense position
+         */
+        SlotHandle HandleAt(::Size denseIndex) const
+        {
+            SlotHandle handle;
+            handle.index = denseToSlot[denseIndex];
+            handle.generation = slots[handle.index].generation;
+            return handle;
+        }
+
+        /**
+         * \brief Calls function(handle, element) for every element in dense order
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            for(::Size i = 0; i < values.Size(); i++) function(HandleAt(i), values[i]);
+        }
+
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(::Size i = 0; i < values.Size(); i++) function(HandleAt(i), values[i]);
+        }
+
+        /**
+         * \brief Returns the dense array
+         */
+        T* Data() noexcept
+        {
+            return values.Data();
+        }
+
+        const T* Data() const noexcept
+        {
+            return values.Data();
+        }
+
+        T* begin() noexcept
+        {
+            return values.begin();
+        }
+
+        const T* begin() const noexcept
+        {
+            return values.begin();
+        }
+
+        T* end() noexcept
+        {
+            return values.end();
+        }
+
+        const T* end() const noexcept
+        {
+            return values.end();
+        }
+
+    private:
+        /**
+         * \brief Bumps the generation of a slot, skipping 0 so a default handle never matches, and frees it
+         */
+        void Release(Slot& slot, UI32 slotIndex)
+        {
+            slot.generation = slot.generation + 1 == 0 ? 1 : slot.generation + 1;
+            slot.index = freeHead;
+            freeHead = slotIndex;
+        }
+
+        Vector<Slot> slots;
+        Vector<UI32> denseToSlot;
+        DenseArray<T> values;
+        UI32 freeHead = NoSlot;
+    };
+}
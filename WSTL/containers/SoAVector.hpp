@@ -0,0 +1,518 @@
+#pragma once
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Span.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Vector of records stored as a structure of arrays: every field lives in its own contiguous array, each
+     * starting on a cache line, so a pass that reads one or two fields only loads those. All arrays share a single
+     * aligned allocation and grow together
+     */
+    template<typename... Fields>
+    class SoAVector
+    {
+        static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+        typedef SoAVector<Fields...> Self;
+
+    public:
+        /**
+         * \brief Number of fields per record
+         */
+        static constexpr ::Size FieldCount = sizeof...(Fields);
+
+        /**
+         * \brief Alignment of the start of every field array
+         */
+        static constexpr ::Size Alignment = SystemCacheLineSize;
+
+        /**
+         * \brief Type of the field at Index
+         */
+        template<::Size Index>
+        using FieldType = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+        /**
+         * \brief A whole record, as taken by PushBack
+         */
+        typedef std::tuple<Fields...> ValueType;
+
+        /**
+         * \brief Default constructor
+         */
+        SoAVector() = default;
+
+        /**
+         * \brief Copy constructor
+         */
+        SoAVector(const Self& other)
+        {
+            // Copied record by record so count always covers what is built, and a throwing copy can be undone
+            Reserve(other.count);
+            try
+            {
+                for(::Size i = 0; i < other.count; i++)
+                {
+                    CopyBack(other, i, std::make_index_sequence<FieldCount>{});
+                    count++;
+                }
+            }
+            catch(...)
+            {
+                Clear();
+                Allocator::Deallocate(&pBlock);
+                throw;
+            }
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        SoAVector(Self&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~SoAVector()
+        {
+            Clear();
+            Allocator::Deallocate(&pBlock);
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            Self copy(other);
+            Swap(copy);
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Self moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * \brief Swaps the contents with other
+         */
+        void Swap(Self& other) noexcept
+        {
+            std::swap(arrays, other.arrays);
+            std::swap(pBlock, other.pBlock);
+            std::swap(count, other.count);
+            std::swap(capacity, other.capacity);
+        }
+
+        /**
+         * \brief Returns the number of records
+         */
+        ::Size Size() const noexcept
+        {
+            return count;
+        }
+
+        /**
+         * \brief Returns the number of records that fit before the arrays grow
+         */
+        ::Size Capacity() const noexcept
+        {
+            return capacity;
+        }
+
+        /**
+         * \brief Returns whether there are no records
+         */
+        bool IsEmpty() const noexcept
+        {
+            return count == 0;
+        }
+
+        /**
+         * \brief Makes room for amount records in every field array
+         */
+        void Reserve(::Size amount)
+        {
+            if(amount <= capacity) return;
+
+            ::Size offsets[FieldCount];
+            const ::Size bytes = Layout(amount, offsets);
+            Byte* pNewBlock = Allocator::AllocateAligned<Byte>(bytes, Alignment);
+
+            // Every field is moved before the old arrays are touched, so a throw leaves them all as they were
+            ::Size movedFields = 0;
+            ::Size moved = 0;
+            try
+            {
+                ForEachField([&](auto field)
+                {
+                    constexpr ::Size I = decltype(field)::value;
+                    using F = FieldType<I>;
+                    F* pNew = reinterpret_cast<F*>(pNewBlock + offsets[I]);
+                    for(moved = 0; moved < count; moved++) new(pNew + moved) F(std::move_if_noexcept(Data<I>()[moved]));
+                    movedFields++;
+                });
+            }
+            catch(...)
+            {
+                ForEachField([&](auto field)
+                {
+                    constexpr ::Size I = decltype(field)::value;
+                    using F = FieldType<I>;
+                    F* pNew = reinterpret_cast<F*>(pNewBlock + offsets[I]);
+                    if(I < movedFields) Allocator::Destruct(pNew, count);
+                    else if(I == movedFields) Allocator::Destruct(pNew, moved);
+                });
+                Allocator::Deallocate(&pNewBlock);
+                throw;
+            }
+
+            ForEachField([&](auto field)
+            {
+                constexpr ::Size I = decltype(field)::value;
+                using F = FieldType<I>;
+                Allocator::Destruct(std::get<I>(arrays), count);
+                std::get<I>(arrays) = reinterpret_cast<F*>(pNewBlock + offsets[I]);
+            });
+
+            Allocator::Deallocate(&pBlock);
+            pBlock = pNewBlock;
+            capacity = amount;
+        }
+
+        /**
+         * \brief Appends a record given as one value per field
+         */
+        void PushBack(const ValueType& value)
+        {
+            std::apply([this](const Fields&... fields) { EmplaceBack(fields...); }, value);
+        }
+
+        void PushBack(ValueType&& value)
+        {
+            std::apply([this](Fields&... fields) { EmplaceBack(std::move(fields)...); }, value);
+        }
+
+        /**
+         * \brief Appends a record, constructing every field from the matching argument
+         */
+        template<class... Args>
+        void EmplaceBack(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == FieldCount, "SoAVector::EmplaceBack takes one argument per field");
+
+            if(count == capacity)
+            {
+                ValueType value(std::forward<Args>(args)...);
+                Reserve(capacity == 0 ? 8 : capacity * 2);
+                std::apply([this](Fields&... fields) { ConstructBack(std::move(fields)...); }, value);
+            }
+            else ConstructBack(std::forward<Args>(args)...);
+            count++;
+        }
+
+        /**
+         * \brief Removes the last record
+         */
+        void PopBack()
+        {
+            if(count == 0) throw std::out_of_range("SoAVector::PopBack: vector is empty");
+
+            count--;
+            ForEachField([&](auto field)
+            {
+                constexpr ::Size I = decltype(field)::value;
+                Allocator::Destruct(Data<I>() + count);
+            });
+        }
+
+        /**
+         * \brief Removes the record at index by moving the last record into its place, O(1) but not order
+         * preserving. Throws std::out_of_range if index is out of range
+         */
+        void EraseSwap(::Size index)
+        {
+            CheckIndex(index);
+
+            const ::Size last = count - 1;
+            if(index != last)
+            {
+                ForEachField([&](auto field)
+                {
+                    constexpr ::Size I = decltype(field)::value;
+                    Data<I>()[index] = std::move(Data<I>()[last]);
+                });
+            }
+            PopBack();
+        }
+
+        /**
+         * \brief Resizes to count records, new records are value initialized. If one throws, the records added so
+         * far are removed again
+         */
+        void Resize(::Size newCount)
+        {
+            while(count > newCount) PopBack();
+            if(newCount <= count) return;
+
+            Reserve(newCount);
+            const ::Size oldCount = count;
+            try
+            {
+                for(; count < newCount; count++) ValueInitializeBack(std::make_index_sequence<FieldCount>{});
+            }
+            catch(...)
+            {
+                while(count > oldCount) PopBack();
+                throw;
+            }
+        }
+
+        /**
+         * \brief Removes every record, the capacity is kept
+         */
+        void Clear()
+        {
+            ForEachField([&](auto field)
+            {
+                constexpr ::Size I = decltype(field)::value;
+                Allocator::Destruct(Data<I>(), count);
+            });
+            count = 0;
+        }
+
+        /**
+         * \brief Returns the array of the field at Index, aligned to Alignment
+         */
+        template<::Size Index>
+        FieldType<Index>* Data() noexcept
+        {
+            return std::get<Index>(arrays);
+        }
+
+        template<::Size Index>
+        const FieldType<Index>* Data() const noexcept
+        {
+            return std::get<Index>(arrays);
+        }
+
+        /**
+         * \brief Returns a view of the array of the field at Index, for loops over a single field
+         */
+        template<::Size Index>
+        Span<FieldType<Index>> Field()
+        {
+            return Span<FieldType<Index>>(Data<Index>(), count);
+        }
+
+        template<::Size Index>
+        Span<const FieldType<Index>> Field() const
+        {
+            return Span<const FieldType<Index>>(Data<Index>(), count);
+        }
+
+        /**
+         * \brief Returns one field of the record at index
+         */
+        template<::Size Index>
+        FieldType<Index>& Get(::Size index)
+        {
+            CheckIndex(index);
+            return Data<Index>()[index];
+        }
+
+        template<::Size Index>
+        const FieldType<Index>& Get(::Size index) const
+        {
+            CheckIndex(index);
+            return Data<Index>()[index];
+        }
+
+        /**
+         * \brief Returns references to every field of the record at index. Throws std::out_of_range if index is out
+         * of range
+         */
+        std::tuple<Fields&...> At(::Size index)
+        {
+            CheckIndex(index);
+            return Record(index, std::make_index_sequence<FieldCount>{});
+        }
+
+        std::tuple<const Fields&...> At(::Size index) const
+        {
+            CheckIndex(index);
+            return Record(index, std::make_index_sequence<FieldCount>{});
+        }
+
+        std::tuple<Fields&...> operator[](::Size index)
+        {
+            return At(index);
+        }
+
+        std::tuple<const Fields&...> operator[](::Size index) const
+        {
+            return At(index);
+        }
+
+        /**
+         * \brief Calls function with the fields Indices... of every record, or every field if none are given. Only
+         * the arrays of the chosen fields are read
+         */
+        template<::Size... Indices, class Function>
+        void ForEach(Function function)
+        {
+            if constexpr(sizeof...(Indices) == 0) ForEachIn(function, std::make_index_sequence<FieldCount>{});
+            else ForEachIn(function, std::index_sequence<Indices...>{});
+        }
+
+        template<::Size... Indices, class Function>
+        void ForEach(Function function) const
+        {
+            if constexpr(sizeof...(Indices) == 0) ForEachIn(function, std::make_index_sequence<FieldCount>{});
+            else ForEachIn(function, std::index_sequence<Indices...>{});
+        }
+
+    private:
+        /**
+         * \brief Calls function with std::integral_constant<::Size, I> for every field index
+         */
+        template<class Function>
+        static void ForEachField(Function function)
+        {
+            ForEachFieldIn(function, std::make_index_sequence<FieldCount>{});
+        }
+
+        template<class Function, ::Size... Is>
+        static void ForEachFieldIn(Function& function, std::index_sequence<Is...>)
+        {
+            (function(std::integral_constant<::Size, Is>{}), ...);
+        }
+
+        /**
+         * \brief Computes where every field array starts in a block for amount records, returns the block size
+         */
+        static ::Size Layout(::Size amount, ::Size* pOffsets)
+        {
+            ::Size bytes = 0;
+            ForEachField([&](auto field)
+            {
+                constexpr ::Size I = decltype(field)::value;
+                constexpr ::Size align = alignof(FieldType<I>) > Alignment ? alignof(FieldType<I>) : Alignment;
+                bytes = (bytes + align - 1) / align * align;
+                pOffsets[I] = bytes;
+                bytes += amount * sizeof(FieldType<I>);
+            });
+            return bytes;
+        }
+
+        template<class... Args>
+        void ConstructBack(Args&&... args)
+        {
+            ConstructBackIn(std::make_index_sequence<FieldCount>{}, std::forward<Args>(args)...);
+        }
+
+        /**
+         * \brief Constructs the fields of the next record in order. If one throws, the ones already built are
+         * destroyed so the record is left unconstructed
+         */
+        template<::Size... Is, class... Args>
+        void ConstructBackIn(std::index_sequence<Is...>, Args&&... args)
+        {
+            ::Size constructed = 0;
+            try
+            {
+                ((new(Data<Is>() + count) FieldType<Is>(std::forward<Args>(args)), constructed++), ...);
+            }
+            catch(...)
+            {
+                DestroyBackFields(constructed);
+                throw;
+            }
+        }
+
+        template<::Size... Is>
+        void ValueInitializeBack(std::index_sequence<Is...>)
+        {
+            ::Size constructed = 0;
+            try
+            {
+                ((new(Data<Is>() + count) FieldType<Is>(), constructed++), ...);
+            }
+            catch(...)
+            {
+                DestroyBackFields(constructed);
+                throw;
+            }
+        }
+
+        /**
+         * \brief Destroys the first fields of the partially constructed record at count
+         */
+        void DestroyBackFields(::Size fields)
+        {
+            ForEachField([&](auto field)
+            {
+                constexpr ::Size I = decltype(field)::value;
+                if(I < fields) Allocator::Destruct(Data<I>() + count);
+            });
+        }
+
+        template<::Size... Is>
+        void CopyBack(const Self& other, ::Size index, std::index_sequence<Is...>)
+        {
+            ConstructBack(other.Data<Is>()[index]...);
+        }
+
+        template<::Size... Is>
+        std::tuple<Fields&...> Record(::Size index, std::index_sequence<Is...>)
+        {
+            return std::tuple<Fields&...>(Data<Is>()[index]...);
+        }
+
+        template<::Size... Is>
+        std::tuple<const Fields&...> Record(::Size index, std::index_sequence<Is...>) const
+        {
+            return std::tuple<const Fields&...>(Data<Is>()[index]...);
+        }
+
+        template<class Function, ::Size... Is>
+        void ForEachIn(Function& function, std::index_sequence<Is...>)
+        {
+            for(::Size i = 0; i < count; i++) function(Data<Is>()[i]...);
+        }
+
+        template<class Function, ::Size... Is>
+        void ForEachIn(Function& function, std::index_sequence<Is...>) const
+        {
+            for(::Size i = 0; i < count; i++) function(Data<Is>()[i]...);
+        }
+
+        void CheckIndex(::Size index) const
+        {
+            if(index >= count) throw std::out_of_range("SoAVector: index out of range");
+        }
+
+        std::tuple<Fields*...> arrays{};
+        Byte* pBlock = nullptr;
+        ::Size count = 0;
+        ::Size capacity = 0;
+    };
+}
@@ -0,0 +1,295 @@
+#pragma once
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+
+namespace WSTL
+{
+    template<typename T, ::Size ArraySize>
+    class Array;
+
+    /**
+     * \brief Extent of a Span whose size is only known at runtime
+     */
+    inline constexpr ::Size DynamicExtent = static_cast<::Size>(-1);
+
+    namespace SpanInternal
+    {
+        /**
+         * \brief Size of a Span, stored only when the extent is dynamic. Span derives from it so the empty static
+         * version takes no space
+         */
+        template<::Size Extent>
+        struct Storage
+        {
+            constexpr Storage(::Size) noexcept
+            {
+            }
+
+            static constexpr ::Size Get() noexcept
+            {
+                return Extent;
+            }
+        };
+
+        template<>
+        struct Storage<DynamicExtent>
+        {
+            constexpr Storage(::Size count) noexcept : count(count)
+            {
+            }
+
+            constexpr ::Size Get() const noexcept
+            {
+                return count;
+            }
+
+            ::Size count;
+        };
+
+        template<typename Container, typename T, typename = void>
+        struct IsContiguous : std::false_type {};
+
+        /**
+         * \brief Containers with Data() and Size() whose elements can be viewed as T, like Vector and FixedVector
+         */
+        template<typename Container, typename T>
+        struct IsContiguous<Container, T, std::void_t<decltype(std::declval<Container&>().Data()),
+                                                      decltype(std::declval<Container&>().Size())>>
+            : std::bool_constant<std::is_convertible_v<
+                  std::remove_pointer_t<decltype(std::declval<Container&>().Data())>(*)[], T(*)[]>> {};
+    }
+
+    /**
+     * \brief Non-owning view of count contiguous elements, to pass and return container contents without copying.
+     * With a static Extent the size is part of the type and isn't stored. Vector, Array, FixedVector and other
+     * containers with Data() and Size() convert to a Span implicitly
+     */
+    template<typename T, ::Size Extent = DynamicExtent>
+    class Span : private SpanInternal::Storage<Extent>
+    {
+        typedef SpanInternal::Storage<Extent> Storage;
+
+    public:
+        typedef T ElementType;
+        typedef std::remove_cv_t<T> ValueType;
+
+        /**
+         * \brief Default constructor, an empty view. Only exists for dynamic or zero extents
+         */
+        template<::Size E = Extent, typename = std::enable_if_t<E == DynamicExtent || E == 0>>
+        constexpr Span() noexcept : Storage(0), pData(nullptr)
+        {
+        }
+
+        /**
+         * \brief Constructor from a pointer and a count. Throws std::invalid_argument if count doesn't match a
+         * static extent
+         */
+        constexpr Span(T* pData, ::Size count) : Storage(count), pData(pData)
+        {
+            if(Extent != DynamicExtent && count != Extent)
+                throw std::invalid_argument("Span: count doesn't match the extent");
+        }
+
+        /**
+         * \brief Constructor from a [first, last) pointer range
+         */
+        constexpr Span(T* pFirst, T* pLast) : Span(pFirst, static_cast<::Size>(pLast - pFirst))
+        {
+        }
+
+        /**
+         * \brief Constructor from a built-in array
+         */
+        template<::Size N, typename = std::enable_if_t<Extent == DynamicExtent || Extent == N>>
+        constexpr Span(T (&array)[N]) noexcept : Storage(N), pData(array)
+        {
+        }
+
+        /**
+         * \brief Constructor from an Array, keeps its size in the type when the extent is static
+         */
+        template<typename U, ::Size N, typename = std::enable_if_t<(Extent == DynamicExtent || Extent == N) &&
+                                                                    std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr Span(Array<U, N>& array) noexcept : Storage(N), pData(array.Data())
+        {
+        }
+
+        template<typename U, ::Size N, typename = std::enable_if_t<(Extent == DynamicExtent || Extent == N) &&
+                                                                    std::is_convertible_v<const U(*)[], T(*)[]>>>
+        constexpr Span(const Array<U, N>& array) noexcept : Storage(N), pData(array.Data())
+        {
+        }
+
+        /**
+         * \brief Constructor from any container with Data() and Size(), like Vector or FixedVector. Throws
+         * std::invalid_argument if its size doesn't match a static extent
+         */
+        template<typename Container, typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<Container>, Span> &&
+                                                                 SpanInternal::IsContiguous<Container, T>::value>>
+        constexpr Span(Container& container) : Span(container.Data(), static_cast<::Size>(container.Size()))
+        {
+        }
+
+        /**
+         * \brief Constructor from a const container, only for spans of const elements. Also binds temporaries, e.g.
+         * Set<int>::FromSorted(MakeVector()), the view is then only valid until the end of the full expression
+         */
+        template<typename Container, typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<Container>, Span> &&
+                                                                 SpanInternal::IsContiguous<const Container, T>::value>>
+        constexpr Span(const Container& container) : Span(container.Data(), static_cast<::Size>(container.Size()))
+        {
+        }
+
+        /**
+         * \brief Conversion from a span of a compatible type, e.g. Span<T> to Span<const T>
+         */
+        template<typename U, ::Size E,
+                 typename = std::enable_if_t<(Extent == DynamicExtent || E == DynamicExtent || Extent == E) &&
+                                             std::is_convertible_v<U(*)[], T(*)[]>>>
+        constexpr Span(const Span<U, E>& other) : Span(other.Data(), other.Size())
+        {
+        }
+
+        constexpr Span(const Span& other) noexcept = default;
+        constexpr Span& operator=(const Span& other) noexcept = default;
+
+        /**
+         * \brief Returns the number of elements
+         */
+        constexpr ::Size Size() const noexcept
+        {
+            return Storage::Get();
+        }
+
+        /**
+         * \brief Returns the number of bytes viewed
+         */
+        constexpr ::Size SizeBytes() const noexcept
+        {
+            return Size() * sizeof(T);
+        }
+
+        /**
+         * \brief Returns whether the span views no elements
+         */
+        constexpr bool IsEmpty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        /**
+         * \brief Returns the first viewed element
+         */
+        constexpr T* Data() const noexcept
+        {
+            return pData;
+        }
+
+        constexpr T& operator[](::Size index) const
+        {
+#if defined(_DEBUG)
+            CheckIndexOutOfRange(index);
+#endif
+            return pData[index];
+        }
+
+        /**
+         * \brief Returns element at specified index. Throws std::out_of_range if index is out of range
+         */
+        constexpr T& At(::Size index) const
+        {
+            CheckIndexOutOfRange(index);
+            return pData[index];
+        }
+
+        constexpr T& Front() const
+        {
+            return At(0);
+        }
+
+        constexpr T& Back() const
+        {
+            return At(Size() - 1);
+        }
+
+        constexpr T* begin() const noexcept
+        {
+            return pData;
+        }
+
+        constexpr T* end() const noexcept
+        {
+            return pData + Size();
+        }
+
+        /**
+         * \brief Returns a view of the first count elements. Throws std::out_of_range if count is too large
+         */
+        constexpr Span<T> First(::Size count) const
+        {
+            if(count > Size()) throw std::out_of_range("Span::First: count out of range");
+            return Span<T>(pData, count);
+        }
+
+        template<::Size Count>
+        constexpr Span<T, Count> First() const
+        {
+            if(Count > Size()) throw std::out_of_range("Span::First: count out of range");
+            return Span<T, Count>(pData, Count);
+        }
+
+        /**
+         * \brief Returns a view of the last count elements. Throws std::out_of_range if count is too large
+         */
+        constexpr Span<T> Last(::Size count) const
+        {
+            if(count > Size()) throw std::out_of_range("Span::Last: count out of range");
+            return Span<T>(pData + Size() - count, count);
+        }
+
+        /**
+         * \brief Returns a view of count elements starting at offset, or every element after offset if count is
+         * DynamicExtent. Throws std::out_of_range if the range doesn't fit
+         */
+        constexpr Span<T> Subspan(::Size offset, ::Size count = DynamicExtent) const
+        {
+            if(offset > Size()) throw std::out_of_range("Span::Subspan: offset out of range");
+            if(count == DynamicExtent) count = Size() - offset;
+            if(count > Size() - offset) throw std::out_of_range("Span::Subspan: count out of range");
+            return Span<T>(pData + offset, count);
+        }
+
+    private:
+        constexpr void CheckIndexOutOfRange(::Size index) const
+        {
+            if(index >= Size()) throw std::out_of_range("Index out of range");
+        }
+
+        T* pData;
+    };
+
+    template<typename T, ::Size N>
+    Span(T (&)[N]) -> Span<T, N>;
+
+    template<typename T, ::Size N>
+    Span(Array<T, N>&) -> Span<T, N>;
+
+    template<typename T, ::Size N>
+    Span(const Array<T, N>&) -> Span<const T, N>;
+
+    template<typename Container>
+    Span(Container&) -> Span<std::remove_pointer_t<decltype(std::declval<Container&>().Data())>>;
+
+    /**
+     * \brief Returns a read-only view of the bytes of a span
+     */
+    template<typename T, ::Size Extent>
+    Span<const Byte> AsBytes(Span<T, Extent> span) noexcept
+    {
+        return Span<const Byte>(reinterpret_cast<const Byte*>(span.Data()), span.SizeBytes());
+    }
+}
@@ -0,0 +1,491 @@
+#pragma once
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/DenseArray.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Maps 32-bit entity ids to values stored in a packed dense array, for component data that is iterated
+     * far more often than it is looked up. The sparse side is split in pages that are only allocated once an id in
+     * their range is used, so large sparse ids cost one page instead of an array as large as the biggest id.
+     * Add, Remove and lookups are O(1), removing moves the last element into the hole
+     */
+    template<typename T>
+    class SparseSet
+    {
+        typedef SparseSet<T> Self;
+
+    public:
+        /**
+         * \brief Dense position of an id that isn't in the set, and the one id that can't be stored
+         */
+        static constexpr UI32 NoIndex = 0xFFFFFFFFu;
+
+        /**
+         * \brief Number of ids covered by one sparse page
+         */
+        static constexpr ::Size PageSize = 4096;
+
+        /**
+         * \brief Default constructor
+         */
+        SparseSet() = default;
+
+        /**
+         * \brief Copy constructor
+         */
+        SparseSet(const Self& other) : entities(other.entities), values(other.values)
+        {
+            pages.Resize(other.pages.Size());
+            for(::Size i = 0; i < other.pages.Size(); i++)
+            {
+                if(other.pages[i] == nullptr) continue;
+                pages[i] = AllocatePage();
+                for(::Size j = 0; j < PageSize; j++) pages[i][j] = other.pages[i][j];
+            }
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        SparseSet(Self&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~SparseSet()
+        {
+            for(::Size i = 0; i < pages.Size(); i++) Allocator::Deallocate(&pages[i]);
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            Self copy(other);
+            Swap(copy);
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Self moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * \brief Swaps the contents with other
+         */
+        void Swap(Self& other) noexcept
+        {
+            pages.Swap(other.pages);
+            entities.Swap(other.entities);
+            values.Swap(other.values);
+        }
+
+        /**
+         * \brief Returns the number of elements
+         */
+        ::Size Size() const noexcept
+        {
+            return values.Size();
+        }
+
+        /**
+         * \brief Returns whether there are no elements
+         */
+        bool IsEmpty() const noexcept
+        {
+            return values.IsEmpty();
+        }
+
+        /**
+         * \brief Makes room for amount elements in the dense array
+         */
+        void Reserve(::Size amount)
+        {
+            values.Reserve(amount);
+            if(amount > entities.Capacity()) entities.SetCapacity(amount);
+        }
+
+        /**
+         * \brief Constructs the value of an id in place. Throws std::invalid_argument if the id is already in the
+         * set or is NoIndex
+         */
+        template<class... Args>
+        T& Emplace(UI32 entity, Args&&... args)
+        {
+            if(entity == NoIndex) throw std::invalid_argument("SparseSet: invalid entity");
+            if(Contains(entity)) throw std::invalid_argument("SparseSet: entity already present");
+
+            UI32& sparse = SparseSlot(entity);
+
+            // The value goes in last, so a throwing constructor only leaves the entity entry to undo
+            entities.PushBack(entity);
+            try
+            {
+                values.EmplaceBack(std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                entities.PopBack();
+                throw;
+            }
+
+            sparse = static_cast<UI32>(values.Size() - 1);
+            return values[values.Size() - 1];
+        }
+
+        /**
+         * \brief Adds a copy of value for an id. Throws std::invalid_argument if the id is already in the set
+         */
+        T& Insert(UI32 entity, const T& value)
+        {
+            return Emplace(entity, value);
+        }
+
+        /**
+         * \brief Adds value for an id by moving it. Throws std::invalid_argument if the id is already in the set
+         */
+        T& Insert(UI32 entity, T&& value)
+        {
+            return Emplace(entity, std::move(value));
+        }
+
+        /**
+         * \brief Removes an id, returns false if it wasn't in the set
+         */
+        bool Remove(UI32 entity)
+        {
+            const UI32 index = IndexOf(entity);
+            if(index == NoIndex) return false;
+
+            const ::Size last = values.Size() - 1;
+            if(index != last)
+            {
+                entities[index] = entities[last];
+                SparseSlot(entities[index]) = index;
+            }
+            values.EraseSwap(index);
+            entities.PopBack();
+
+            SparseSlot(entity) = NoIndex;
+            return true;
+        }
+
+        bool Erase(UI32 entity)
+        {
+            return Remove(entity);
+        }
+
+        /**
+         * \brief Removes every element, the sparse pages are kept for reuse
+         */
+        void Clear()
+        {
+            for(::Size i = 0; i < values.Size(); i++) SparseSlot(entities[i]) = NoIndex;
+            values.Clear();
+            entities.Clear();
+        }
+
+        /**
+         * \brief Returns the dense position of an id, or NoIndex if it isn't in the set
+         */
+        UI32 IndexOf(UI32 entity) const noexcept
+        {
+            const ::Size page = entity / PageSize;
+            if(page >= pages.Size()) return NoIndex;
+
+            const UI32* pPage = pages.Data()[page];
+            return pPage == nullptr ? NoIndex : pPage[entity % PageSize];
+        }
+
+        /**
+         * \brief Returns whether the id is in the set
+         */
+        bool Contains(UI32 entity) const noexcept
+        {
+            return IndexOf(entity) != NoIndex;
+        }
+
+        /**
+         * \brief Returns a pointer to the value of an id, or nullptr if it isn't in the set
+         */
+        T* Find(UI32 entity) noexcept
+        {
+            const UI32 index = IndexOf(entity);
+            return index == NoIndex ? nullptr : values.Data() + index;
+        }
+
+        const T* Find(UI32 entity) const noexcept
+        {
+            const UI32 index = IndexOf(entity);
+            return index == NoIndex ? nullptr : values.Data() + index;
+        }
+
+        /**
+         * \brief Returns the value of an id. Throws std::out_of_range if it isn't in the set
+         */
+        T& At(UI32 entity)
+        {
+            T* pValue = Find(entity);
+            if(pValue == nullptr) throw std::out_of_range("SparseSet: entity not found");
+            return *pValue;
+        }
+
+        const T& At(UI32 entity) const
+        {
+            const T* pValue = Find(entity);
+            if(pValue == nullptr) throw std::out_of_range("SparseSet: entity not found");
+            return *pValue;
+        }
+
+        T& operator[](UI32 entity)
+        {
+            return At(entity);
+        }
+
+        const T& operator[](UI32 entity) const
+        {
+            return At(entity);
+        }
+
+        /**
+         * \brief Swaps two elements in the dense array, their ids keep pointing at them
+         */
+        void SwapPositions(::Size a, ::Size b)
+        {
+            if(a == b) return;
+
+            std::swap(values[a], values[b]);
+            std::swap(entities[a], entities[b]);
+            SparseSlot(entities[a]) = static_cast<UI32>(a);
+            SparseSlot(entities[b]) = static_cast<UI32>(b);
+        }
+
+        /**
+         * \brief Returns the ids in dense order, parallel to Data()
+         */
+        const UI32* Entities() const noexcept
+        {
+            return entities.Data();
+        }
+
+        /**
+         * \brief Returns the dense array of values
+         */
+        T* Data() noexcept
+        {
+            return values.Data();
+        }
+
+        const T* Data() const noexcept
+        {
+            return values.Data();
+        }
+
+        /**
+         * \brief Calls function(entity, value) for every element in dense order
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            for(::Size i = 0; i < values.Size(); i++) function(entities.Data()[i], values[i]);
+        }
+
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(::Size i = 0; i < values.Size(); i++) function(entities.Data()[i], values[i]);
+        }
+
+        T* begin() noexcept
+        {
+            return values.begin();
+        }
+
+        const T* begin() const noexcept
+        {
+            return values.begin();
+        }
+
+        T* end() noexcept
+        {
+            return values.end();
+        }
+
+        const T* end() const noexcept
+        {
+            return values.end();
+        }
+
+    private:
+        /**
+         * \brief Returns the sparse entry of an id, allocating its page if needed
+         */
+        UI32& SparseSlot(UI32 entity)
+        {
+            const ::Size page = entity / PageSize;
+            if(page >= pages.Size()) pages.Resize(page + 1);
+            if(pages[page] == nullptr) pages[page] = AllocatePage();
+            return pages[page][entity % PageSize];
+        }
+
+        static UI32* AllocatePage()
+        {
+            UI32* pPage = Allocator::AllocateAligned<UI32>(PageSize * sizeof(UI32), SystemCacheLineSize);
+            for(::Size i = 0; i < PageSize; i++) pPage[i] = NoIndex;
+            return pPage;
+        }
+
+        Vector<UI32*> pages;
+        Vector<UI32> entities;
+        DenseArray<T> values;
+    };
+
+    /**
+     * \brief Owns one SparseSet per component type and keeps the entities that have every component packed at the
+     * front of each set, in the same order. ForEach then walks the component arrays side by side without any
+     * lookups, like an archetype table. Components have to be added and removed through the group to keep the
+     * packing; the sets can be read directly with Get
+     */
+    template<typename... Components>
+    class SparseGroup
+    {
+        static_assert(sizeof...(Components) > 0, "SparseGroup needs at least one component");
+
+        typedef std::tuple_element_t<0, std::tuple<Components...>> First;
+
+    public:
+        /**
+         * \brief Returns the number of entities that have every component
+         */
+        ::Size Size() const noexcept
+        {
+            return groupSize;
+        }
+
+        /**
+         * \brief Returns the storage of one component
+         */
+        template<typename Component>
+        SparseSet<Component>& Get() noexcept
+        {
+            return std::get<SparseSet<Component>>(sets);
+        }
+
+        template<typename Component>
+        const SparseSet<Component>& Get() const noexcept
+        {
+            return std::get<SparseSet<Component>>(sets);
+        }
+
+        /**
+         * \brief Returns whether the entity has the component
+         */
+        template<typename Component>
+        bool Has(UI32 entity) const noexcept
+        {
+            return Get<Component>().Contains(entity);
+        }
+
+        /**
+         * \brief Returns whether the entity has every component
+         */
+        bool HasAll(UI32 entity) const noexcept
+        {
+            return (Get<Components>().Contains(entity) && ...);
+        }
+
+        /**
+         * \brief Constructs a component of the entity in place. Throws std::invalid_argument if the entity already
+         * has it
+         */
+        template<typename Component, class... Args>
+        Component& Emplace(UI32 entity, Args&&... args)
+        {
+            SparseSet<Component>& set = Get<Component>();
+            set.Emplace(entity, std::forward<Args>(args)...);
+            if(HasAll(entity)) Pack(entity);
+            return *set.Find(entity);
+        }
+
+        /**
+         * \brief Removes a component from the entity, returns false if it didn't have it
+         */
+        template<typename Component>
+        bool Remove(UI32 entity)
+        {
+            if(!Has<Component>(entity)) return false;
+            if(IsPacked(entity)) Unpack(entity);
+            return Get<Component>().Remove(entity);
+        }
+
+        /**
+         * \brief Removes every component of the entity
+         */
+        void RemoveAll(UI32 entity)
+        {
+            if(IsPacked(entity)) Unpack(entity);
+            (Get<Components>().Remove(entity), ...);
+        }
+
+        /**
+         * \brief Calls function(entity, components...) for every entity that has every component
+         */
+        template<class Function>
+        void ForEach(Function function)
+        {
+            const UI32* pEntities = Get<First>().Entities();
+            for(::Size i = 0; i < groupSize; i++) function(pEntities[i], Get<Components>().Data()[i]...);
+        }
+
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            const UI32* pEntities = Get<First>().Entities();
+            for(::Size i = 0; i < groupSize; i++)
+            {
+                function(pEntities[i], static_cast<const Components&>(Get<Components>().Data()[i])...);
+            }
+        }
+
+    private:
+        bool IsPacked(UI32 entity) const noexcept
+        {
+            return Get<First>().IndexOf(entity) < groupSize;
+        }
+
+        void Pack(UI32 entity)
+        {
+            (Get<Components>().SwapPositions(Get<Components>().IndexOf(entity), groupSize), ...);
+            groupSize++;
+        }
+
+        void Unpack(UI32 entity)
+        {
+            groupSize--;
+            (Get<Components>().SwapPositions(Get<Components>().IndexOf(entity), groupSize), ...);
+        }
+
+        std::tuple<SparseSet<Components>...> sets;
+        ::Size groupSize = 0;
+    };
+}
@@ -0,0 +1,336 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Set.hpp"
+#include "WSTL/containers/Span.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/Prefetch.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Immutable sorted index in Eytzinger (breadth-first) order: the children of slot k are 2k and 2k + 1, so
+     * the first levels of every search share a few cache lines and the next levels can be prefetched before they
+     * are needed. Searches return the rank of a key in the sorted input, to index arrays kept alongside it
+     */
+    template<typename Key>
+    class StaticIndex
+    {
+        static_assert(IsTrivialV<Key>, "StaticIndex stores trivially copyable keys");
+
+        typedef StaticIndex<Key> Self;
+
+    public:
+        /**
+         * \brief Levels between a node and the descendants prefetched while it is compared. The 16 descendants four
+         * levels down are contiguous, whatever the size of the keys
+         */
+        static constexpr ::Size PrefetchLevels = 4;
+
+        /**
+         * \brief Cache lines holding those descendants: one for 4-byte keys, two for 8-byte keys, four for 16-byte
+         * keys, plus one for key sizes that let them straddle a line boundary
+         */
+        static constexpr ::Size PrefetchLines = ((sizeof(Key) << PrefetchLevels) + SystemCacheLineSize - 1) / SystemCacheLineSize +
+            ((sizeof(Key) << PrefetchLevels) % SystemCacheLineSize != 0 ? 1 : 0);
+
+        /**
+         * \brief Number of searches BatchFind and BatchLowerBound run interleaved
+         */
+        static constexpr ::Size BatchSize = 16;
+
+        /**
+         * \brief Default constructor
+         */
+        StaticIndex() = default;
+
+        /**
+         * \brief Constructor from count sorted keys. Throws std::invalid_argument if they are not sorted
+         */
+        StaticIndex(const Key* pSorted, ::Size count)
+        {
+            Build(pSorted, count);
+        }
+
+        /**
+         * \brief Constructor from sorted keys, e.g. a Vector. Throws std::invalid_argument if they are not sorted
+         */
+        explicit StaticIndex(Span<const Key> sorted)
+        {
+            Build(sorted.Data(), sorted.Size());
+        }
+
+        /**
+         * \brief Constructor from the keys of a Set
+         */
+        explicit StaticIndex(const Set<Key>& set)
+        {
+            const Vector<Key> keys = set.GetKeys();
+            Build(keys.Data(), keys.Size());
+        }
+
+        /**
+         * \brief Copy constructor
+         */
+        StaticIndex(const Self& other)
+        {
+            *this = other;
+        }
+
+        /**
+         * \brief Move constructor
+         */
+        StaticIndex(Self&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~StaticIndex()
+        {
+            Release();
+        }
+
+        /**
+         * \brief Copy assignment operator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+
+            Release();
+            if(other.count == 0) return *this;
+
+            Allocate(other.count);
+            std::memcpy(pKeys, other.pKeys, (count + 1) * sizeof(Key));
+            std::memcpy(pRanks, other.pRanks, (count + 1) * sizeof(UI32));
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+
+            Release();
+            pKeys = other.pKeys;
+            pRanks = other.pRanks;
+            count = other.count;
+            depth = other.depth;
+            other.pKeys = nullptr;
+            other.pRanks = nullptr;
+            other.count = 0;
+            other.depth = 0;
+            return *this;
+        }
+
+        /**
+         * \brief Returns the number of keys
+         */
+        ::Size Size() const noexcept
+        {
+            return count;
+        }
+
+        /**
+         * \brief Returns whether the index is empty
+         */
+        bool IsEmpty() const noexcept
+        {
+            return count == 0;
+        }
+
+        /**
+         * \brief Returns the rank of the first key not less than key, or Size() if every key is less
+         */
+        ::Size LowerBound(const Key& key) const noexcept
+        {
+            return Rank(Descend(key));
+        }
+
+        /**
+         * \brief Returns the rank of the key, or Size() if it is not in the index
+         */
+        ::Size Find(const Key& key) const noexcept
+        {
+            const ::Size slot = Descend(key);
+            return slot != 0 && !(key < pKeys[slot]) ? pRanks[slot] : count;
+        }
+
+        /**
+         * \brief Returns whether the key is in the index
+         */
+        bool Contains(const Key& key) const noexcept
+        {
+            return Find(key) != count;
+        }
+
+        /**
+         * \brief Writes Find of every query to pResults. Queries are searched in groups that descend one level at a
+         * time together, so the cache misses of a group overlap instead of being paid one after another
+         */
+        void BatchFind(const Key* pQueries, ::Size queryCount, ::Size* pResults) const noexcept
+        {
+            ::Size slots[BatchSize];
+            for(::Size first = 0; first < queryCount; first += BatchSize)
+            {
+                const ::Size group = queryCount - first < BatchSize ? queryCount - first : BatchSize;
+                DescendGroup(pQueries + first, group, slots);
+
+                for(::Size i = 0; i < group; i++)
+                {
+                    const ::Size slot = slots[i];
+                    pResults[first + i] = slot != 0 && !(pQueries[first + i] < pKeys[slot]) ? pRanks[slot] : count;
+                }
+            }
+        }
+
+        /**
+         * \brief Writes LowerBound of every query to pResults, interleaved like BatchFind
+         */
+        void BatchLowerBound(const Key* pQueries, ::Size queryCount, ::Size* pResults) const noexcept
+        {
+            ::Size slots[BatchSize];
+            for(::Size first = 0; first < queryCount; first += BatchSize)
+            {
+                const ::Size group = queryCount - first < BatchSize ? queryCount - first : BatchSize;
+                DescendGroup(pQueries + first, group, slots);
+
+                for(::Size i = 0; i < group; i++) pResults[first + i] = Rank(slots[i]);
+            }
+        }
+
+        /**
+         * \brief Returns the key of the given rank. Throws std::out_of_range if rank is out of range
+         */
+        const Key& KeyAtRank(::Size rank) const
+        {
+            if(rank >= count) throw std::out_of_range("StaticIndex::KeyAtRank: rank out of range");
+
+            // Walks down like a search for the rank, the ranks array is already in Eytzinger order
+            ::Size slot = 1;
+            while(pRanks[slot] != rank) slot = 2 * slot + (pRanks[slot] < rank);
+            return pKeys[slot];
+        }
+
+    private:
+        /**
+         * \brief Branchless descent: ends past the leaves, and the slot of the lower bound is what is left after
+         * dropping the trailing right turns and the final left turn. 0 means every key is less than key
+         */
+        ::Size Descend(const Key& key) const noexcept
+        {
+            ::Size slot = 1;
+            while(slot <= count)
+            {
+                PrefetchDescendants(slot);
+                slot = 2 * slot + (pKeys[slot] < key);
+            }
+            return slot >> (CountTrailingZeros(static_cast<UI64>(~slot)) + 1);
+        }
+
+        void DescendGroup(const Key* pQueries, ::Size group, ::Size* pSlots) const noexcept
+        {
+            for(::Size i = 0; i < group; i++) pSlots[i] = 1;
+
+            // Slots that already left the tree compare against the unused slot 0 and stay where they are
+            for(::Size level = 0; level < depth; level++)
+            {
+                for(::Size i = 0; i < group; i++)
+                {
+                    const ::Size slot = pSlots[i];
+                    const bool inside = slot <= count;
+                    PrefetchDescendants(inside ? slot : 0);
+                    const ::Size next = 2 * slot + (pKeys[inside ? slot : 0] < pQueries[i]);
+                    pSlots[i] = inside ? next : slot;
+                }
+            }
+
+            for(::Size i = 0; i < group; i++)
+            {
+                pSlots[i] >>= CountTrailingZeros(static_cast<UI64>(~pSlots[i])) + 1;
+            }
+        }
+
+        /**
+         * \brief Prefetches the descendants of slot PrefetchLevels down. The address is computed as an integer since
+         * it usually lies past the end of the keys near the leaves, prefetching it is harmless
+         */
+        void PrefetchDescendants(::Size slot) const noexcept
+        {
+            const uintptr_t first = reinterpret_cast<uintptr_t>(pKeys) + (slot << PrefetchLevels) * sizeof(Key);
+            for(::Size line = 0; line < PrefetchLines; line++)
+            {
+                Prefetch(reinterpret_cast<const void*>(first + line * SystemCacheLineSize));
+            }
+        }
+
+        ::Size Rank(::Size slot) const noexcept
+        {
+            return slot == 0 ? count : pRanks[slot];
+        }
+
+        void Build(const Key* pSorted, ::Size keyCount)
+        {
+            for(::Size i = 1; i < keyCount; i++)
+            {
+                if(pSorted[i] < pSorted[i - 1]) throw std::invalid_argument("StaticIndex: keys are not sorted");
+            }
+            if(keyCount >= 0xFFFFFFFFull) throw std::length_error("StaticIndex: too many keys");
+
+            Release();
+            if(keyCount == 0) return;
+
+            Allocate(keyCount);
+            std::memset(static_cast<void*>(pKeys), 0, sizeof(Key));
+            pRanks[0] = 0;
+            Fill(pSorted, 0, 1);
+        }
+
+        /**
+         * \brief In-order walk of the implicit tree, which visits the slots in sorted order
+         */
+        ::Size Fill(const Key* pSorted, ::Size rank, ::Size slot) noexcept
+        {
+            if(slot > count) return rank;
+
+            rank = Fill(pSorted, rank, 2 * slot);
+            pKeys[slot] = pSorted[rank];
+            pRanks[slot] = static_cast<UI32>(rank);
+            return Fill(pSorted, rank + 1, 2 * slot + 1);
+        }
+
+        void Allocate(::Size keyCount)
+        {
+            count = keyCount;
+            pKeys = Allocator::AllocateAligned<Key>((count + 1) * sizeof(Key), SystemCacheLineSize);
+            pRanks = Allocator::Allocate<UI32>((count + 1) * sizeof(UI32));
+
+            depth = 0;
+            for(::Size remaining = count; remaining != 0; remaining /= 2) depth++;
+        }
+
+        void Release() noexcept
+        {
+            Allocator::Deallocate(&pKeys);
+            Allocator::Deallocate(&pRanks);
+            count = 0;
+            depth = 0;
+        }
+
+        Key* pKeys = nullptr;
+        UI32* pRanks = nullptr;
+        ::Size count = 0;
+        ::Size depth = 0;
+    };
+}
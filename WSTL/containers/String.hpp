@@ -0,0 +1,653 @@
+#pragma once
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/memory/Arena.hpp"
+#include "WSTL/utility/Hash.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Heap storage for String through Allocator. Stateless, so it takes no space in the string
+     */
+    struct HeapStringAllocator
+    {
+        static char* Allocate(Size bytes)
+        {
+            return Allocator::Allocate<char>(bytes);
+        }
+
+        static void Deallocate(char* pData) noexcept
+        {
+            Allocator::Deallocate(&pData);
+        }
+    };
+
+    /**
+     * \brief Storage for String from an Arena. Deallocating is a no-op, the characters live until the arena is
+     * reset. A default constructed one has no arena and falls back to Allocator
+     */
+    class ArenaStringAllocator
+    {
+    public:
+        ArenaStringAllocator() noexcept = default;
+
+        explicit ArenaStringAllocator(Arena& arena) noexcept : pArena(&arena)
+        {
+        }
+
+        char* Allocate(Size bytes) const
+        {
+            return pArena != nullptr ? pArena->Allocate<char>(bytes) : Allocator::Allocate<char>(bytes);
+        }
+
+        void Deallocate(char* pData) const noexcept
+        {
+            if(pArena == nullptr) Allocator::Deallocate(&pData);
+        }
+
+        Arena* GetArena() const noexcept
+        {
+            return pArena;
+        }
+
+    private:
+        Arena* pArena = nullptr;
+    };
+
+    namespace StringInternal
+    {
+        /**
+         * \brief Fills the heap fields of a string up to the size of its inline buffer, empty on 64-bit targets where
+         * three words already fill it
+         */
+        template<::Size Bytes>
+        struct Padding
+        {
+            Byte padding[Bytes];
+        };
+
+        template<>
+        struct Padding<0>
+        {
+        };
+    }
+
+    /**
+     * \brief Owning, null terminated string with 23 characters of inline storage, so short strings never allocate.
+     * Longer ones are stored through StringAllocator, which is HeapStringAllocator for String and an Arena for
+     * ArenaString. The hash is computed once and kept until the string changes, so a string used as a HashMap key
+     * many times is hashed once
+     */
+    template<class StringAllocator>
+    class BasicString : private StringAllocator
+    {
+        typedef BasicString<StringAllocator> Self;
+
+    public:
+        /**
+         * \brief Number of characters stored without allocating
+         */
+        static constexpr ::Size InlineCapacity = 23;
+
+        static constexpr ::Size NPos = StringView::NPos;
+
+        /**
+         * \brief Default constructor, an empty string
+         */
+        BasicString() noexcept
+        {
+            SetInlineSize(0);
+        }
+
+        explicit BasicString(const StringAllocator& allocator) noexcept : StringAllocator(allocator)
+        {
+            SetInlineSize(0);
+        }
+
+        /**
+         * \brief Constructor from a null terminated string
+         */
+        BasicString(const char* pString, const StringAllocator& allocator = StringAllocator())
+            : BasicString(StringView(pString), allocator)
+        {
+        }
+
+        /**
+         * \brief Constructor from count characters
+         */
+        BasicString(const char* pData, ::Size count, const StringAllocator& allocator = StringAllocator())
+            : BasicString(StringView(pData, count), allocator)
+        {
+        }
+
+        /**
+         * \brief Constructor from a view, copies its characters
+         */
+        explicit BasicString(StringView view, const StringAllocator& allocator = StringAllocator())
+            : StringAllocator(allocator)
+        {
+            SetInlineSize(0);
+            Append(view);
+        }
+
+        explicit BasicString(const std::string& string, const StringAllocator& allocator = StringAllocator())
+            : BasicString(StringView(string), allocator)
+        {
+        }
+
+        /**
+         * \brief Copy constructor, the copy uses the same allocator
+         */
+        BasicString(const Self& other) : BasicString(other.View(), other.GetAllocator())
+        {
+            cachedHash = other.cachedHash;
+            hashCached = other.hashCached;
+        }
+
+        /**
+         * \brief Move constructor, takes the buffer of other
+         */
+        BasicString(Self&& other) noexcept : StringAllocator(other.GetAllocator())
+        {
+            std::memcpy(static_cast<void*>(&heap), &other.heap, sizeof(heap));
+            cachedHash = other.cachedHash;
+            hashCached = other.hashCached;
+            onHeap = other.onHeap;
+            other.onHeap = false;
+            other.SetInlineSize(0);
+            other.hashCached = false;
+        }
+
+        /**
+         * \brief Destructor
+         */
+        ~BasicString()
+        {
+            if(!IsInline()) StringAllocator::Deallocate(heap.pData);
+        }
+
+        /**
+         * \brief Copy assignment operator, keeps this string's allocator
+         */
+        Self& operator=(const Self& other)
+        {
+            if(this == &other) return *this;
+            Assign(other.View());
+            cachedHash = other.cachedHash;
+            hashCached = other.hashCached;
+            return *this;
+        }
+
+        /**
+         * \brief Move assignment operator, takes the buffer and the allocator of other
+         */
+        Self& operator=(Self&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Self moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        Self& operator=(StringView view)
+        {
+            Assign(view);
+            return *this;
+        }
+
+        Self& operator=(const char* pString)
+        {
+            Assign(StringView(pString));
+            return *this;
+        }
+
+        /**
+         * \brief Swaps the contents and allocators with other
+         */
+        void Swap(Self& other) noexcept
+        {
+            std::swap(static_cast<StringAllocator&>(*this), static_cast<StringAllocator&>(other));
+
+            Byte temporary[sizeof(heap)];
+            std::memcpy(temporary, &heap, sizeof(heap));
+            std::memcpy(static_cast<void*>(&heap), &other.heap, sizeof(heap));
+            std::memcpy(static_cast<void*>(&other.heap), temporary, sizeof(heap));
+            std::swap(cachedHash, other.cachedHash);
+            std::swap(hashCached, other.hashCached);
+            std::swap(onHeap, other.onHeap);
+        }
+
+        const StringAllocator& GetAllocator() const noexcept
+        {
+            return *this;
+        }
+
+        /**
+         * \brief Returns the number of characters, without the terminator
+         */
+        ::Size Size() const noexcept
+        {
+            return IsInline() ? InlineCapacity - static_cast<::Size>(local[InlineCapacity]) : heap.size;
+        }
+
+        ::Size Length() const noexcept
+        {
+            return Size();
+        }
+
+        /**
+         * \brief Returns the number of characters that fit before the string allocates
+         */
+        ::Size Capacity() const noexcept
+        {
+            return IsInline() ? InlineCapacity : heap.capacity;
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        /**
+         * \brief Returns whether the characters are stored inline
+         */
+        bool IsInline() const noexcept
+        {
+            return !onHeap;
+        }
+
+        /**
+         * \brief Returns the characters, null terminated. Writing through them is allowed, so the cached hash is
+         * dropped; writes through a pointer or reference taken before a later Hash() call are not seen by that hash
+         */
+        char* Data() noexcept
+        {
+            hashCached = false;
+            return IsInline() ? local : heap.pData;
+        }
+
+        const char* Data() const noexcept
+        {
+            return IsInline() ? local : heap.pData;
+        }
+
+        const char* CStr() const noexcept
+        {
+            return Data();
+        }
+
+        /**
+         * \brief Returns a view of the characters, valid until the string changes
+         */
+        StringView View() const noexcept
+        {
+            return StringView(Data(), Size());
+        }
+
+        operator StringView() const noexcept
+        {
+            return View();
+        }
+
+        std::string ToStdString() const
+        {
+            return std::string(Data(), Size());
+        }
+
+        char& operator[](::Size index)
+        {
+#if defined(_DEBUG)
+            CheckIndexOutOfRange(index);
+#endif
+            return Data()[index];
+        }
+
+        const char& operator[](::Size index) const
+        {
+#if defined(_DEBUG)
+            CheckIndexOutOfRange(index);
+#endif
+            return Data()[index];
+        }
+
+        /**
+         * \brief Returns character at specified index. Throws std::out_of_range if index is out of range
+         */
+        char& At(::Size index)
+        {
+            CheckIndexOutOfRange(index);
+            return Data()[index];
+        }
+
+        const char& At(::Size index) const
+        {
+            CheckIndexOutOfRange(index);
+            return Data()[index];
+        }
+
+        char& Front()
+        {
+            return At(0);
+        }
+
+        const char& Front() const
+        {
+            return At(0);
+        }
+
+        char& Back()
+        {
+            return At(Size() - 1);
+        }
+
+        const char& Back() const
+        {
+            return At(Size() - 1);
+        }
+
+        char* begin() noexcept
+        {
+            return Data();
+        }
+
+        const char* begin() const noexcept
+        {
+            return Data();
+        }
+
+        char* end() noexcept
+        {
+            return Data() + Size();
+        }
+
+        const char* end() const noexcept
+        {
+            return Data() + Size();
+        }
+
+        /**
+         * \brief Makes room for count characters
+         */
+        void Reserve(::Size count)
+        {
+            if(count > Capacity()) Reallocate(count, StringView());
+        }
+
+        /**
+         * \brief Removes every character, the capacity is kept
+         */
+        void Clear() noexcept
+        {
+            SetSize(0);
+        }
+
+        /**
+         * \brief Replaces the characters with those of view, which may point into this string
+         */
+        void Assign(StringView view)
+        {
+            if(view.Size() > Capacity())
+            {
+                SetSize(0);
+                Reallocate(view.Size(), view);
+                return;
+            }
+
+            std::memmove(DataUnchecked(), view.Data(), view.Size());
+            SetSize(view.Size());
+        }
+
+        /**
+         * \brief Appends the characters of view, which may point into this string
+         */
+        Self& Append(StringView view)
+        {
+            const ::Size size = Size();
+            if(size + view.Size() > Capacity())
+            {
+                const ::Size doubled = Capacity() * 2;
+                Reallocate(size + view.Size() > doubled ? size + view.Size() : doubled, view);
+                return *this;
+            }
+
+            std::memmove(DataUnchecked() + size, view.Data(), view.Size());
+            SetSize(size + view.Size());
+            return *this;
+        }
+
+        Self& operator+=(StringView view)
+        {
+            return Append(view);
+        }
+
+        Self& operator+=(char character)
+        {
+            PushBack(character);
+            return *this;
+        }
+
+        void PushBack(char character)
+        {
+            Append(StringView(&character, 1));
+        }
+
+        /**
+         * \brief Removes the last character. Throws std::out_of_range if the string is empty
+         */
+        void PopBack()
+        {
+            if(IsEmpty()) throw std::out_of_range("String::PopBack: string is empty");
+            SetSize(Size() - 1);
+        }
+
+        /**
+         * \brief Resizes to count characters, new ones are set to character
+         */
+        void Resize(::Size count, char character = '\0')
+        {
+            const ::Size size = Size();
+            if(count > Capacity()) Reallocate(count, StringView());
+            if(count > size) std::memset(DataUnchecked() + size, character, count - size);
+            SetSize(count);
+        }
+
+        /**
+         * \brief Returns a copy of count characters starting at position, clamped to the end. Throws
+         * std::out_of_range if position is past the end
+         */
+        Self Substring(::Size position, ::Size count = NPos) const
+        {
+            return Self(View().Substring(position, count), GetAllocator());
+        }
+
+        ::Size Find(StringView text, ::Size position = 0) const noexcept
+        {
+            return View().Find(text, position);
+        }
+
+        ::Size Find(char character, ::Size position = 0) const noexcept
+        {
+            return View().Find(character, position);
+        }
+
+        bool Contains(StringView text) const noexcept
+        {
+            return View().Contains(text);
+        }
+
+        bool StartsWith(StringView prefix) const noexcept
+        {
+            return View().StartsWith(prefix);
+        }
+
+        bool EndsWith(StringView suffix) const noexcept
+        {
+            return View().EndsWith(suffix);
+        }
+
+        int Compare(StringView other) const noexcept
+        {
+            return View().Compare(other);
+        }
+
+        /**
+         * \brief Hashes the characters like StringView and HashKey(std::string) do. The hash is cached until the
+         * string is changed
+         */
+        ::Size Hash() const noexcept
+        {
+            if(!hashCached)
+            {
+                cachedHash = WSTL::Hash(Data(), static_cast<UI32>(Size()));
+                hashCached = true;
+            }
+            return cachedHash;
+        }
+
+        /**
+         * \brief Compares the characters. The cached hashes are not used as a shortcut, writes through a reference
+         * from operator[] or Data() can change the characters without dropping them
+         */
+        friend bool operator==(const Self& left, const Self& right) noexcept
+        {
+            return Equal(left, right.View());
+        }
+
+        friend bool operator==(const Self& left, StringView right) noexcept
+        {
+            return Equal(left, right);
+        }
+
+        friend bool operator==(const Self& left, const char* right) noexcept
+        {
+            return Equal(left, StringView(right));
+        }
+
+        friend bool operator!=(const Self& left, const Self& right) noexcept
+        {
+            return !(left == right);
+        }
+
+        friend bool operator!=(const Self& left, StringView right) noexcept
+        {
+            return !(left == right);
+        }
+
+        friend bool operator!=(const Self& left, const char* right) noexcept
+        {
+            return !(left == right);
+        }
+
+        friend bool operator<(const Self& left, const Self& right) noexcept
+        {
+            return left.View() < right.View();
+        }
+
+        friend Self operator+(const Self& left, StringView right)
+        {
+            Self result(left.GetAllocator());
+            result.Reserve(left.Size() + right.Size());
+            result.Append(left.View());
+            result.Append(right);
+            return result;
+        }
+
+    private:
+        /**
+         * \brief Fields of a string on the heap. Padded to the size of the inline buffer, so copying either one copies
+         * the whole storage whatever the word size
+         */
+        struct HeapStorage : StringInternal::Padding<InlineCapacity + 1 - sizeof(char*) - 2 * sizeof(::Size)>
+        {
+            char* pData;
+            ::Size size;
+            ::Size capacity;
+        };
+
+        static_assert(sizeof(HeapStorage) == InlineCapacity + 1, "HeapStorage has to overlay the inline buffer exactly");
+
+        static bool Equal(const Self& left, StringView right) noexcept
+        {
+            const ::Size size = left.Size();
+            return size == right.Size() && (size == 0 || std::memcmp(left.Data(), right.Data(), size) == 0);
+        }
+
+        char* DataUnchecked() noexcept
+        {
+            return IsInline() ? local : heap.pData;
+        }
+
+        void SetInlineSize(::Size size) noexcept
+        {
+            local[size] = '\0';
+            local[InlineCapacity] = static_cast<char>(InlineCapacity - size);
+        }
+
+        void SetSize(::Size size) noexcept
+        {
+            hashCached = false;
+            if(IsInline()) SetInlineSize(size);
+            else
+            {
+                heap.size = size;
+                heap.pData[size] = '\0';
+            }
+        }
+
+        /**
+         * \brief Moves to a heap buffer for capacity characters that holds the current characters followed by
+         * suffix. Suffix is copied before the old buffer is released, so it may point into it
+         */
+        void Reallocate(::Size capacity, StringView suffix)
+        {
+            const ::Size size = Size();
+            char* pNew = StringAllocator::Allocate(capacity + 1);
+            std::memcpy(pNew, Data(), size);
+            if(!suffix.IsEmpty()) std::memcpy(pNew + size, suffix.Data(), suffix.Size());
+            pNew[size + suffix.Size()] = '\0';
+
+            if(!IsInline()) StringAllocator::Deallocate(heap.pData);
+            heap.pData = pNew;
+            heap.size = size + suffix.Size();
+            heap.capacity = capacity;
+            onHeap = true;
+            hashCached = false;
+        }
+
+        void CheckIndexOutOfRange(::Size index) const
+        {
+            if(index >= Size()) throw std::out_of_range("Index out of range");
+        }
+
+        union
+        {
+            HeapStorage heap;
+            char local[InlineCapacity + 1];
+        };
+        mutable UI32 cachedHash = 0;
+        mutable bool hashCached = false;
+
+        /**
+         * \brief Whether the characters are on the heap, kept apart from the storage so no field has to give up bits
+         */
+        bool onHeap = false;
+    };
+
+    /**
+     * \brief String whose long contents are allocated with Allocator
+     */
+    typedef BasicString<HeapStringAllocator> String;
+
+    static_assert(sizeof(String) == 32, "String is 32 bytes on 32-bit and 64-bit targets");
+
+    /**
+     * \brief String whose long contents are allocated from an Arena given at construction
+     */
+    typedef BasicString<ArenaStringAllocator> ArenaString;
+}
@@ -0,0 +1,264 @@
+#pragma once
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/HashMap.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/memory/Allocator.hpp"
+#include "WSTL/memory/Arena.hpp"
+#include "WSTL/utility/Bit.hpp"
+#include "WSTL/utility/Hash.hpp"
+#include "WSTL/utility/Optional.hpp"
+
+namespace WSTL
+{
+    class StringPool;
+
+    /**
+     * \brief Handle to a string interned in a StringPool. Equal strings of one pool get equal handles, so comparing
+     * is a single integer compare, and the hash of the characters is carried along, so HashMap never reads them.
+     * The default value is the empty string, which every pool holds
+     */
+    class InternedString
+    {
+        friend class StringPool;
+
+    public:
+        constexpr InternedString() noexcept = default;
+
+        /**
+         * \brief Returns the index of the string in its pool
+         */
+        constexpr UI32 Handle() const noexcept
+        {
+            return handle;
+        }
+
+        /**
+         * \brief Returns the hash of the characters, computed once when the string was interned
+         */
+        constexpr ::Size Hash() const noexcept
+        {
+            return hash;
+        }
+
+        constexpr bool IsEmpty() const noexcept
+        {
+            return handle == 0;
+        }
+
+        constexpr bool operator==(InternedString other) const noexcept
+        {
+            return handle == other.handle;
+        }
+
+        constexpr bool operator!=(InternedString other) const noexcept
+        {
+            return handle != other.handle;
+        }
+
+        /**
+         * \brief Orders by handle, which is the order of interning and not the order of the characters
+         */
+        constexpr bool operator<(InternedString other) const noexcept
+        {
+            return handle < other.handle;
+        }
+
+    private:
+        constexpr InternedString(UI32 handle, UI32 hash) noexcept : handle(handle), hash(hash)
+        {
+        }
+
+        UI32 handle = 0;
+        UI32 hash = 0;
+    };
+
+    /**
+     * \brief Table of unique strings. Intern copies a string into an Arena once and returns the same InternedString
+     * for every equal string after that. Interning takes a lock, resolving a handle back to its characters doesn't:
+     * entries are stored in chunks that never move, so View and CStr can run concurrently with Intern
+     */
+    class StringPool
+    {
+        /**
+         * \brief Interned characters, null terminated
+         */
+        struct Entry
+        {
+            const char* pData;
+            UI32 length;
+            UI32 hash;
+        };
+
+        /**
+         * \brief Key of the lookup table, carries the hash so a string is hashed once per Intern
+         */
+        struct Key
+        {
+            StringView text;
+            UI32 hash;
+
+            ::Size Hash() const noexcept
+            {
+                return hash;
+            }
+
+            bool operator==(const Key& other) const noexcept
+            {
+                return hash == other.hash && text == other.text;
+            }
+        };
+
+    public:
+        /**
+         * \brief Entries in the first chunk, every following chunk is twice as large as the one before
+         */
+        static constexpr ::Size FirstChunkSize = 256;
+
+        /**
+         * \brief Constructor, the pool starts with the empty string at handle 0
+         */
+        StringPool()
+        {
+            InternLocked(StringView("", 0), static_cast<UI32>(WSTL::Hash("", 0)));
+        }
+
+        StringPool(const StringPool& other) = delete;
+        StringPool& operator=(const StringPool& other) = delete;
+
+        /**
+         * \brief Destructor, handles of this pool must not be resolved afterwards
+         */
+        ~StringPool()
+        {
+            for(std::atomic<Entry*>& chunk : chunks)
+            {
+                Entry* pChunk = chunk.load(std::memory_order_relaxed);
+                Allocator::Deallocate(&pChunk);
+            }
+        }
+
+        /**
+         * \brief Returns the handle of text, copying it into the pool if it isn't there yet. Thread-safe. Throws
+         * std::length_error if the text or the pool outgrow 32 bit sizes
+         */
+        InternedString Intern(StringView text)
+        {
+            if(text.Size() > 0xFFFFFFFFu) throw std::length_error("StringPool::Intern: string too long");
+
+            const UI32 hash = static_cast<UI32>(WSTL::Hash(text.Data(), static_cast<UI32>(text.Size())));
+            std::lock_guard<std::mutex> lock(mutex);
+            return InternLocked(text, hash);
+        }
+
+        /**
+         * \brief Returns the handle of text if it was interned, without adding it. Thread-safe
+         */
+        Optional<InternedString> Find(StringView text) const
+        {
+            const UI32 hash = static_cast<UI32>(WSTL::Hash(text.Data(), static_cast<UI32>(text.Size())));
+            std::lock_guard<std::mutex> lock(mutex);
+            const UI32* pHandle = index.Find(Key{text, hash});
+            if(pHandle == nullptr) return Optional<InternedString>();
+            return Optional<InternedString>(InternedString(*pHandle, hash));
+        }
+
+        /**
+         * \brief Returns the characters of an interned string, valid for the lifetime of the pool. Lock-free
+         */
+        StringView View(InternedString string) const
+        {
+            const Entry& entry = EntryAt(string.handle);
+            return StringView(entry.pData, entry.length);
+        }
+
+        /**
+         * \brief Returns the null terminated characters of an interned string. Lock-free
+         */
+        const char* CStr(InternedString string) const
+        {
+            return EntryAt(string.handle).pData;
+        }
+
+        /**
+         * \brief Returns the number of unique strings, including the empty string
+         */
+        ::Size Size() const noexcept
+        {
+            return count.load(std::memory_order_acquire);
+        }
+
+        /**
+         * \brief Returns the number of bytes of characters held, terminators included
+         */
+        ::Size BytesUsed() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return arena.BytesUsed();
+        }
+
+    private:
+        /**
+         * \brief Enough chunks to address every 32 bit handle
+         */
+        static constexpr ::Size ChunkCount = 25;
+
+        static ::Size ChunkOf(UI32 handle) noexcept
+        {
+            const UI32 position = handle / static_cast<UI32>(FirstChunkSize) + 1;
+            return static_cast<::Size>(31 - CountLeadingZeros(position));
+        }
+
+        static ::Size ChunkStart(::Size chunk) noexcept
+        {
+            return FirstChunkSize * ((::Size{1} << chunk) - 1);
+        }
+
+        /**
+         * \brief Throws std::out_of_range if the handle wasn't handed out by this pool
+         */
+        const Entry& EntryAt(UI32 handle) const
+        {
+            if(handle >= count.load(std::memory_order_acquire))
+                throw std::out_of_range("StringPool: handle out of range");
+
+            const ::Size chunk = ChunkOf(handle);
+            return chunks[chunk].load(std::memory_order_acquire)[handle - ChunkStart(chunk)];
+        }
+
+        InternedString InternLocked(StringView text, UI32 hash)
+        {
+            if(const UI32* pHandle = index.Find(Key{text, hash})) return InternedString(*pHandle, hash);
+
+            const ::Size handle = count.load(std::memory_order_relaxed);
+            if(handle > 0xFFFFFFFFu) throw std::length_error("StringPool::Intern: pool is full");
+
+            char* pData = arena.Allocate<char>(text.Size() + 1);
+            if(!text.IsEmpty()) std::memcpy(pData, text.Data(), text.Size());
+            pData[text.Size()] = '\0';
+
+            const ::Size chunk = ChunkOf(static_cast<UI32>(handle));
+            Entry* pChunk = chunks[chunk].load(std::memory_order_relaxed);
+            if(pChunk == nullptr)
+            {
+                pChunk = Allocator::Allocate<Entry>(sizeof(Entry) * (FirstChunkSize << chunk));
+                chunks[chunk].store(pChunk, std::memory_order_release);
+            }
+            pChunk[handle - ChunkStart(chunk)] = Entry{pData, static_cast<UI32>(text.Size()), hash};
+
+            index.Insert(Key{StringView(pData, text.Size()), hash}, static_cast<UI32>(handle));
+            count.store(handle + 1, std::memory_order_release);
+            return InternedString(static_cast<UI32>(handle), hash);
+        }
+
+        std::atomic<Entry*> chunks[ChunkCount] = {};
+        std::atomic<::Size> count = 0;
+        HashMap<Key, UI32> index;
+        Arena arena;
+        mutable std::mutex mutex;
+    };
+}
@@ -0,0 +1,274 @@
+#pragma once
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/utility/Hash.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Non-owning view of a character sequence, to pass strings around without copying them. Converts
+     * implicitly from string literals, std::string and std::string_view. Hashes its characters, so it can key a
+     * HashMap directly
+     */
+    class StringView
+    {
+    public:
+        /**
+         * \brief Returned by the Find functions when nothing matches
+         */
+        static constexpr ::Size NPos = static_cast<::Size>(-1);
+
+        /**
+         * \brief Default constructor, an empty view
+         */
+        constexpr StringView() noexcept = default;
+
+        /**
+         * \brief Constructor from a pointer and a length
+         */
+        constexpr StringView(const char* pData, ::Size length) noexcept : pData(pData), length(length)
+        {
+        }
+
+        /**
+         * \brief Constructor from a null terminated string
+         */
+        constexpr StringView(const char* pString) noexcept : pData(pString), length(CStringLength(pString))
+        {
+        }
+
+        /**
+         * \brief Constructor from a std::string, which has to outlive the view
+         */
+        StringView(const std::string& string) noexcept : pData(string.data()), length(string.size())
+        {
+        }
+
+        constexpr StringView(std::string_view view) noexcept : pData(view.data()), length(view.size())
+        {
+        }
+
+        constexpr operator std::string_view() const noexcept
+        {
+            return std::string_view(pData, length);
+        }
+
+        /**
+         * \brief Returns a std::string holding a copy of the characters
+         */
+        std::string ToString() const
+        {
+            return std::string(pData, length);
+        }
+
+        constexpr const char* Data() const noexcept
+        {
+            return pData;
+        }
+
+        constexpr ::Size Size() const noexcept
+        {
+            return length;
+        }
+
+        constexpr ::Size Length() const noexcept
+        {
+            return length;
+        }
+
+        constexpr bool IsEmpty() const noexcept
+        {
+            return length == 0;
+        }
+
+        constexpr const char& operator[](::Size index) const
+        {
+#if defined(_DEBUG)
+            CheckIndexOutOfRange(index);
+#endif
+            return pData[index];
+        }
+
+        /**
+         * \brief Returns character at specified index. Throws std::out_of_range if index is out of range
+         */
+        constexpr const char& At(::Size index) const
+        {
+            CheckIndexOutOfRange(index);
+            return pData[index];
+        }
+
+        constexpr const char& Front() const
+        {
+            return At(0);
+        }
+
+        constexpr const char& Back() const
+        {
+            return At(length - 1);
+        }
+
+        constexpr const char* begin() const noexcept
+        {
+            return pData;
+        }
+
+        constexpr const char* end() const noexcept
+        {
+            return pData + length;
+        }
+
+        /**
+         * \brief Returns the view of count characters starting at position, clamped to the end. Throws
+         * std::out_of_range if position is past the end
+         */
+        constexpr StringView Substring(::Size position, ::Size count = NPos) const
+        {
+            if(position > length) throw std::out_of_range("StringView::Substring: position out of range");
+            return StringView(pData + position, count < length - position ? count : length - position);
+        }
+
+        /**
+         * \brief Drops the first count characters
+         */
+        constexpr void RemovePrefix(::Size count) noexcept
+        {
+            pData += count;
+            length -= count;
+        }
+
+        /**
+         * \brief Drops the last count characters
+         */
+        constexpr void RemoveSuffix(::Size count) noexcept
+        {
+            length -= count;
+        }
+
+        /**
+         * \brief Returns negative, zero or positive as this view sorts before, equal to or after other
+         */
+        constexpr int Compare(StringView other) const noexcept
+        {
+            const ::Size common = length < other.length ? length : other.length;
+            for(::Size i = 0; i < common; i++)
+            {
+                const unsigned char mine = static_cast<unsigned char>(pData[i]);
+                const unsigned char theirs = static_cast<unsigned char>(other.pData[i]);
+                if(mine != theirs) return mine < theirs ? -1 : 1;
+            }
+            return length == other.length ? 0 : length < other.length ? -1 : 1;
+        }
+
+        constexpr bool StartsWith(StringView prefix) const noexcept
+        {
+            return length >= prefix.length && StringView(pData, prefix.length).Compare(prefix) == 0;
+        }
+
+        constexpr bool EndsWith(StringView suffix) const noexcept
+        {
+            return length >= suffix.length &&
+                   StringView(pData + length - suffix.length, suffix.length).Compare(suffix) == 0;
+        }
+
+        /**
+         * \brief Returns the position of the first occurrence of character at or after position, or NPos
+         */
+        constexpr ::Size Find(char character, ::Size position = 0) const noexcept
+        {
+            for(::Size i = position; i < length; i++)
+            {
+                if(pData[i] == character) return i;
+            }
+            return NPos;
+        }
+
+        /**
+         * \brief Returns the position of the first occurrence of text at or after position, or NPos
+         */
+        constexpr ::Size Find(StringView text, ::Size position = 0) const noexcept
+        {
+            if(text.length > length) return NPos;
+            for(::Size i = position; i <= length - text.length; i++)
+            {
+                if(StringView(pData + i, text.length).Compare(text) == 0) return i;
+            }
+            return NPos;
+        }
+
+        /**
+         * \brief Returns the position of the last occurrence of character, or NPos
+         */
+        constexpr ::Size FindLast(char character) const noexcept
+        {
+            for(::Size i = length; i > 0; i--)
+            {
+                if(pData[i - 1] == character) return i - 1;
+            }
+            return NPos;
+        }
+
+        constexpr bool Contains(StringView text) const noexcept
+        {
+            return Find(text) != NPos;
+        }
+
+        /**
+         * \brief Hashes the characters, the same hash HashKey gives the equal std::string. Usable in constant
+         * expressions
+         */
+        constexpr ::Size Hash() const noexcept
+        {
+            return WSTL::Hash(pData, static_cast<UI32>(length));
+        }
+
+        constexpr bool operator==(StringView other) const noexcept
+        {
+            return length == other.length && Compare(other) == 0;
+        }
+
+        constexpr bool operator!=(StringView other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        constexpr bool operator<(StringView other) const noexcept
+        {
+            return Compare(other) < 0;
+        }
+
+        constexpr bool operator>(StringView other) const noexcept
+        {
+            return Compare(other) > 0;
+        }
+
+        constexpr bool operator<=(StringView other) const noexcept
+        {
+            return Compare(other) <= 0;
+        }
+
+        constexpr bool operator>=(StringView other) const noexcept
+        {
+            return Compare(other) >= 0;
+        }
+
+    private:
+        static constexpr ::Size CStringLength(const char* pString) noexcept
+        {
+            ::Size count = 0;
+            while(pString[count] != '\0') count++;
+            return count;
+        }
+
+        constexpr void CheckIndexOutOfRange(::Size index) const
+        {
+            if(index >= length) throw std::out_of_range("Index out of range");
+        }
+
+        const char* pData = nullptr;
+        ::Size length = 0;
+    };
+}
@@ -467,7 +467,7 @@ namespace WSTL
             }
             else
             {
-                CheckForCapacity(count);
+                CheckForCapacity(count - oldSize);
                 for (::Size i = oldSize; i < count; ++i)
                 {
                     pBegin[i] = T();
@@ -490,7 +490,7 @@ namespace WSTL
             }
             else
             {
-                CheckForCapacity(count);
+                CheckForCapacity(count - oldSize);
                 for (::Size i = oldSize; i < count; ++i)
                 {
                     pBegin[i] = value;
@@ -622,7 +622,7 @@ namespace WSTL
             const auto oldSize = Size();
             if (capacity == 0)
             {
-                SetCapacity(1);
+                SetCapacity(count);
             }
             else if (oldSize + count - 1 >= capacity)
             {
@@ -663,7 +663,7 @@ namespace WSTL
          */
         void MoveContentsForward(const T* pos, ::Size count = 1)
         {
-            for (auto mover = pEnd + count - 1; mover != pos; --mover)
+            for (auto mover = pEnd + count - 1; mover >= pos + count; --mover)
             {
                 *mover = *(mover - count);
             }
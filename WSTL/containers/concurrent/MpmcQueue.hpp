@@ -0,0 +1,325 @@
+#pragma once
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Bounded multi-producer multi-consumer queue.
+     * Every cell of the ring carries a sequence number that tells producers and consumers whose turn it is, so a
+     * push or pop is a single CAS on the shared position plus one release store on the cell (Vyukov's algorithm).
+     */
+    template<typename T>
+    class MpmcQueue
+    {
+        // A claimed cell is only handed back after its value is moved out, a throwing move would stall the queue
+        static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcQueue values must be nothrow move constructible");
+
+        typedef MpmcQueue<T> Self;
+
+        struct Cell
+        {
+            std::atomic<::Size> sequence;
+            alignas(T) Byte storage[sizeof(T)];
+
+            T* Get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+    public:
+        /**
+         * \brief Constructor, capacity is rounded up to the next power of two
+         */
+        explicit MpmcQueue(::Size capacity = DEFAULT_CAPACITY)
+        {
+            if(capacity < 2) capacity = 2;
+
+            ::Size roundedCapacity = 1;
+            while(roundedCapacity < capacity) roundedCapacity <<= 1;
+
+            pCells = Allocator::AllocateAligned<Cell>(sizeof(Cell) * roundedCapacity, SystemCacheLineSize);
+            for(::Size i = 0; i < roundedCapacity; i++)
+            {
+                new (&pCells[i].sequence) std::atomic<::Size>(i);
+            }
+
+            mask = roundedCapacity - 1;
+            enqueuePos.store(0, std::memory_order_relaxed);
+            dequeuePos.store(0, std::memory_order_relaxed);
+        }
+
+        MpmcQueue(const Self& other) = delete;
+        MpmcQueue(Self&& other) = delete;
+        Self& operator=(const Self& other) = delete;
+        Self& operator=(Self&& other) = delete;
+
+        /**
+         * \brief Destructor, destroys every value still in the queue
+         */
+        ~MpmcQueue()
+        {
+            const ::Size tail = enqueuePos.load(std::memory_order_relaxed);
+            for(::Size pos = dequeuePos.load(std::memory_order_relaxed); pos != tail; pos++)
+            {
+                pCells[pos & mask].Get()->~T();
+            }
+
+            for(::Size i = 0; i <= mask; i++)
+            {
+                pCells[i].sequence.~atomic();
+            }
+            Allocator::Deallocate(&pCells);
+        }
+
+        /**
+         * \brief Tries to add a value to the back of the queue, returns false if the queue is full
+         */
+        bool TryPush(const T& value)
+        {
+            return TryEmplace(value);
+        }
+
+        /**
+         * \brief Tries to add a value to the back of the queue by moving it, returns false if the queue is full
+         */
+        bool TryPush(T&& value)
+        {
+            return TryEmplace(std::move(value));
+        }
+
+        /**
+         * \brief Tries to construct a value in-place at the back of the queue, returns false if the queue is full.
+         * A constructor that can throw runs on a temporary before a cell is claimed, so its arguments are consumed even
+         * when the queue turns out to be full
+         */
+        template<class... Args>
+        bool TryEmplace(Args&&... args)
+        {
+            if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+            {
+                return TryConstructBack(std::forward<Args>(args)...);
+            }
+            else
+            {
+                T value(std::forward<Args>(args)...);
+                return TryConstructBack(std::move(value));
+            }
+        }
+
+        /**
+         * \brief Tries to remove the value at the front of the queue into `value`, returns false if the queue is empty
+         */
+        bool TryPop(T& value)
+        {
+            static_assert(std::is_nothrow_move_assignable_v<T>, "MpmcQueue::TryPop needs a nothrow move assignment");
+
+            ::Size pos;
+            Cell* pCell = ClaimFront(pos);
+            if(pCell == nullptr) return false;
+
+            value = std::move(*pCell->Get());
+            ReleaseFront(pCell, pos);
+            return true;
+        }
+
+        /**
+         * \brief Adds a value to the back of the queue, blocking while the queue is full
+         */
+        void Push(const T& value)
+        {
+            if constexpr (std::is_nothrow_copy_constructible_v<T>)
+            {
+                Block(waitingProducers, popEpoch, [&] { return TryConstructBack(value); });
+            }
+            else
+            {
+                // Copied once up front instead of on every retry
+                T copy(value);
+                Push(std::move(copy));
+            }
+        }
+
+        /**
+         * \brief Adds a value to the back of the queue by moving it, blocking while the queue is full
+         */
+        void Push(T&& value)
+        {
+            Block(waitingProducers, popEpoch, [&] { return TryConstructBack(std::move(value)); });
+        }
+
+        /**
+         * \brief Removes and returns the value from the front of the queue, blocking while the queue is empty
+         */
+        T Pop()
+        {
+            ::Size pos;
+            Cell* pCell = nullptr;
+            Block(waitingConsumers, pushEpoch, [&] { return (pCell = ClaimFront(pos)) != nullptr; });
+
+            T value(std::move(*pCell->Get()));
+            ReleaseFront(pCell, pos);
+            return value;
+        }
+
+        /**
+         * \brief Returns the number of values in the queue. Only a snapshot while other threads are using the queue
+         */
+        ::Size Size() const noexcept
+        {
+            const ::Size tail = enqueuePos.load(std::memory_order_acquire);
+            const ::Size head = dequeuePos.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * \brief Returns if the queue is empty. Only a snapshot while other threads are using the queue
+         */
+        bool IsEmpty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        /**
+         * \brief Returns the maximum amount of values the queue can hold
+         */
+        ::Size Capacity() const noexcept
+        {
+            return mask + 1;
+        }
+
+    private:
+        /**
+         * \brief Claims the cell at the back of the queue and constructs the value in it, returns false if the queue is
+         * full. The cell is only handed to the consumers after the value is built, so building it must not throw
+         */
+        template<class... Args>
+        bool TryConstructBack(Args&&... args) noexcept
+        {
+            static_assert(std::is_nothrow_constructible_v<T, Args&&...>, "A claimed MpmcQueue cell must be filled");
+
+            Cell* pCell = nullptr;
+            ::Size pos = enqueuePos.load(std::memory_order_relaxed);
+
+            for(;;)
+            {
+                pCell = &pCells[pos & mask];
+                const ::Size sequence = pCell->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<PtrDiff>(sequence) - static_cast<PtrDiff>(pos);
+
+                if(difference == 0)
+                {
+                    if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                }
+                else if(difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (pCell->storage) T(std::forward<Args>(args)...);
+            pCell->sequence.store(pos + 1, std::memory_order_release);
+
+            Notify(waitingConsumers, pushEpoch);
+            return true;
+        }
+
+        /**
+         * \brief Claims the cell at the front of the queue, returns nullptr if the queue is empty. The value stays in
+         * the cell until ReleaseFront
+         */
+        Cell* ClaimFront(::Size& pos) noexcept
+        {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+
+            for(;;)
+            {
+                Cell* pCell = &pCells[pos & mask];
+                const ::Size sequence = pCell->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<PtrDiff>(sequence) - static_cast<PtrDiff>(pos + 1);
+
+                if(difference == 0)
+                {
+                    if(dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return pCell;
+                }
+                else if(difference < 0)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    pos = dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * \brief Destroys the value of a claimed cell and hands the cell back to the producers
+         */
+        void ReleaseFront(Cell* pCell, ::Size pos) noexcept
+        {
+            pCell->Get()->~T();
+            pCell->sequence.store(pos + mask + 1, std::memory_order_release);
+
+            Notify(waitingProducers, popEpoch);
+        }
+
+        /**
+         * \brief Wakes the threads blocked on `epoch`, only touches the epoch when somebody is actually waiting
+         */
+        static void Notify(std::atomic<UI32>& waiters, std::atomic<UI32>& epoch) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(waiters.load(std::memory_order_relaxed) == 0) return;
+
+            epoch.fetch_add(1, std::memory_order_release);
+            epoch.notify_all();
+        }
+
+        /**
+         * \brief Retries `attempt` until it succeeds, spinning shortly and then sleeping on `epoch`
+         */
+        template<class Attempt>
+        static void Block(std::atomic<UI32>& waiters, std::atomic<UI32>& epoch, Attempt&& attempt)
+        {
+            for(UI32 spin = 0; spin < SPIN_COUNT; spin++)
+            {
+                if(attempt()) return;
+            }
+
+            waiters.fetch_add(1, std::memory_order_relaxed);
+            for(;;)
+            {
+                const UI32 observed = epoch.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if(attempt()) break;
+                epoch.wait(observed, std::memory_order_acquire);
+            }
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        Cell* pCells;
+        ::Size mask;
+
+        alignas(SystemCacheLineSize) std::atomic<::Size> enqueuePos;
+        alignas(SystemCacheLineSize) std::atomic<::Size> dequeuePos;
+
+        alignas(SystemCacheLineSize) std::atomic<UI32> pushEpoch = 0;
+        std::atomic<UI32> waitingConsumers = 0;
+        alignas(SystemCacheLineSize) std::atomic<UI32> popEpoch = 0;
+        std::atomic<UI32> waitingProducers = 0;
+
+        static constexpr ::Size DEFAULT_CAPACITY = 1024;
+        static constexpr UI32 SPIN_COUNT = 64;
+    };
+}
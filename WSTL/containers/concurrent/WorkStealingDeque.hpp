@@ -0,0 +1,186 @@
+#pragma once
+#include <atomic>
+#include <new>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Chase-Lev work-stealing deque.
+     * One owner thread pushes and pops at the bottom without contention, any other thread can steal from the top.
+     * The ring grows on demand; retired rings are kept until destruction because thieves may still be reading them.
+     * T has to be trivially copyable, it is meant to hold pointers or handles.
+     */
+    template<typename T>
+    class WorkStealingDeque
+    {
+        typedef WorkStealingDeque<T> Self;
+
+        struct Ring
+        {
+            ::Size capacity;
+            std::atomic<T>* pItems;
+
+            explicit Ring(::Size capacity) : capacity(capacity)
+            {
+                pItems = Allocator::AllocateAligned<std::atomic<T>>(sizeof(std::atomic<T>) * capacity, SystemCacheLineSize);
+                for(::Size i = 0; i < capacity; i++) new (pItems + i) std::atomic<T>();
+            }
+
+            ~Ring()
+            {
+                Allocator::Deallocate(&pItems);
+            }
+
+            T Get(PtrDiff index) const noexcept
+            {
+                return pItems[static_cast<::Size>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+
+            void Put(PtrDiff index, T value) noexcept
+            {
+                pItems[static_cast<::Size>(index) & (capacity - 1)].store(value, std::memory_order_relaxed);
+            }
+        };
+
+    public:
+        static_assert(__is_trivially_copyable(T), "WorkStealingDeque only stores trivially copyable values");
+
+        /**
+         * \brief Constructor, capacity is rounded up to the next power of two
+         */
+        explicit WorkStealingDeque(::Size capacity = DEFAULT_CAPACITY)
+        {
+            ::Size roundedCapacity = 2;
+            while(roundedCapacity < capacity) roundedCapacity <<= 1;
+
+            top.store(0, std::memory_order_relaxed);
+            bottom.store(0, std::memory_order_relaxed);
+            ring.store(new Ring(roundedCapacity), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const Self& other) = delete;
+        WorkStealingDeque(Self&& other) = delete;
+        Self& operator=(const Self& other) = delete;
+        Self& operator=(Self&& other) = delete;
+
+        /**
+         * \brief Destructor
+         */
+        ~WorkStealingDeque()
+        {
+            delete ring.load(std::memory_order_relaxed);
+            for(auto pRing : retired) delete pRing;
+        }
+
+        /**
+         * \brief Pushes a value at the bottom. Owner thread only
+         */
+        void Push(T value)
+        {
+            const PtrDiff b = bottom.load(std::memory_order_relaxed);
+            const PtrDiff t = top.load(std::memory_order_acquire);
+            Ring* pRing = ring.load(std::memory_order_relaxed);
+
+            if(b - t > static_cast<PtrDiff>(pRing->capacity) - 1)
+            {
+                pRing = Grow(pRing, t, b);
+            }
+
+            pRing->Put(b, value);
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        /**
+         * \brief Pops the most recently pushed value. Owner thread only
+         */
+        bool Pop(T& value)
+        {
+            const PtrDiff b = bottom.load(std::memory_order_relaxed) - 1;
+            Ring* pRing = ring.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            PtrDiff t = top.load(std::memory_order_relaxed);
+
+            if(t > b)
+            {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            value = pRing->Get(b);
+            if(t != b) return true;
+
+            // Last value, race the thieves for it
+            const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        /**
+         * \brief Steals the oldest value. Safe from any thread, fails spuriously when racing another thief
+         */
+        bool Steal(T& value)
+        {
+            PtrDiff t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const PtrDiff b = bottom.load(std::memory_order_acquire);
+
+            if(t >= b) return false;
+
+            Ring* pRing = ring.load(std::memory_order_acquire);
+            value = pRing->Get(t);
+            return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief Returns the number of values in the deque. Only a snapshot while other threads are using it
+         */
+        ::Size Size() const noexcept
+        {
+            const PtrDiff b = bottom.load(std::memory_order_relaxed);
+            const PtrDiff t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<::Size>(b - t) : 0;
+        }
+
+        /**
+         * \brief Returns if the deque is empty. Only a snapshot while other threads are using it
+         */
+        bool IsEmpty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        /**
+         * \brief Returns the capacity of the current ring
+         */
+        ::Size Capacity() const noexcept
+        {
+            return ring.load(std::memory_order_relaxed)->capacity;
+        }
+
+    private:
+        /**
+         * \brief Copies the live range into a ring twice as large and retires the old one
+         */
+        Ring* Grow(Ring* pOld, PtrDiff t, PtrDiff b)
+        {
+            Ring* pNew = new Ring(pOld->capacity * 2);
+            for(PtrDiff i = t; i < b; i++) pNew->Put(i, pOld->Get(i));
+
+            retired.PushBack(pOld);
+            ring.store(pNew, std::memory_order_release);
+            return pNew;
+        }
+
+        alignas(SystemCacheLineSize) std::atomic<PtrDiff> top;
+        alignas(SystemCacheLineSize) std::atomic<PtrDiff> bottom;
+        alignas(SystemCacheLineSize) std::atomic<Ring*> ring;
+        Vector<Ring*> retired;
+
+        static constexpr ::Size DEFAULT_CAPACITY = 1024;
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include <algorithm>
+#include <cstdint>
+#include <stdexcept>
 
 #include "WSTL/containers/Pair.hpp"
 #include "WSTL/containers/Vector.hpp"
@@ -7,19 +9,72 @@
 
 namespace WSTL
 {
+    /**
+     * \brief Links shared by every tree node. The color lives in the lowest bit of the parent pointer, which is
+     * always zero because nodes are at least pointer aligned, so it costs no padding
+     */
+    template<typename Node>
+    struct RBTNodeLinks
+    {
+        Node* pLeft = nullptr;
+        Node* pRight = nullptr;
+
+        Node* Parent() const
+        {
+            return reinterpret_cast<Node*>(parentAndColor & ~std::uintptr_t{1});
+        }
+
+        void SetParent(Node* pParent)
+        {
+            parentAndColor = reinterpret_cast<std::uintptr_t>(pParent) | (parentAndColor & 1);
+        }
+
+        bool IsBlack() const
+        {
+            return (parentAndColor & 1) != 0;
+        }
+
+        void SetBlack(bool isBlack)
+        {
+            parentAndColor = (parentAndColor & ~std::uintptr_t{1}) | static_cast<std::uintptr_t>(isBlack);
+        }
+
+    private:
+        std::uintptr_t parentAndColor = 1;
+    };
+
+    /**
+     * \brief Value type of trees that only store keys, like Set. Its nodes have no value member
+     */
+    struct RBTKeyOnly
+    {
+    };
+
     template<typename Key, typename Value>
-    struct RBTNode
+    struct RBTNode : RBTNodeLinks<RBTNode<Key, Value>>
     {
-        typedef RBTNode<Key, Value> Node;
-        
         Key key;
         Value value;
-        Node* pParent;
-        Node* pLeft;
-        Node* pRight;
-        bool isBlack;
 
-        RBTNode(const Key& key, Value value, bool isBlack = true) : key(key), value(std::move(value)), pParent(nullptr), pLeft(nullptr), pRight(nullptr), isBlack(isBlack) { }
+        RBTNode(const Key& key, Value value, bool isBlack = true) : key(key), value(std::move(value))
+        {
+            this->SetBlack(isBlack);
+        }
+    };
+
+    /**
+     * \brief Key-only node. value is a static empty member so the tree code can treat both nodes alike
+     */
+    template<typename Key>
+    struct RBTNode<Key, RBTKeyOnly> : RBTNodeLinks<RBTNode<Key, RBTKeyOnly>>
+    {
+        Key key;
+        static constexpr RBTKeyOnly value{};
+
+        RBTNode(const Key& key, RBTKeyOnly = RBTKeyOnly(), bool isBlack = true) : key(key)
+        {
+            this->SetBlack(isBlack);
+        }
     };
     
     template<typename Key, typename Value>
@@ -40,17 +95,15 @@ namespace WSTL
         RBTree(const Self& other) : pRoot(nullptr)
         {
             if(other.pRoot == nullptr) return;
-            pRoot = new Node(other.pRoot->key, other.pRoot->value, other.pRoot->isBlack);
+            pRoot = new Node(other.pRoot->key, other.pRoot->value, other.pRoot->IsBlack());
             InternalCopy(other.pRoot);
         }
 
         /**
          * \brief Move constructor
          */
-        RBTree(Self&& other) noexcept
+        RBTree(Self&& other) noexcept : pRoot(other.pRoot)
         {
-            if(other.pRoot == nullptr) return;
-            pRoot = other.pRoot;
             other.pRoot = nullptr;
         }
 
@@ -68,7 +121,7 @@ namespace WSTL
             }
             
             Clear();
-            pRoot = new Node(other.pRoot->key, other.pRoot->value, other.pRoot->isBlack);
+            pRoot = new Node(other.pRoot->key, other.pRoot->value, other.pRoot->IsBlack());
             InternalCopy(other.pRoot);
             
             return *this;
@@ -150,7 +203,7 @@ namespace WSTL
         /**
          * \brief Gets the Node associated with the given key
          */
-        Node* Search(const Key& key)
+        Node* Search(const Key& key) const
         {
             return InternalSearch(pRoot, key);
         }
@@ -160,47 +213,172 @@ namespace WSTL
          */
         void Delete(const Key& key)
         {
-            auto pDelete = InternalSearch(pRoot, key);
-            if(pDelete == nullptr) return;
-            bool isBlack = pDelete->isBlack;
-            if(pDelete->pRight != nullptr && pDelete->pLeft != nullptr)
-            {
-                auto pSuccessor = InternalFindMin(pDelete->pRight);
-                isBlack = pSuccessor->isBlack;
+            Node* pDelete = InternalSearch(pRoot, key);
+            if(pDelete != nullptr) InternalDelete(pDelete);
+        }
 
-                auto pSuccessorChild = pSuccessor->pRight;
-                InternalTransplant(pSuccessor, pSuccessorChild);
-                if(pDelete->pRight != nullptr) pDelete->pRight->pParent = pSuccessor;
-                pSuccessor->pRight = pDelete->pRight;
+        /**
+         * \brief Unlinks the node with the given key and hands it to the caller, or returns nullptr
+         */
+        Node* Extract(const Key& key)
+        {
+            Node* pExtract = InternalSearch(pRoot, key);
+            if(pExtract != nullptr) InternalUnlink(pExtract);
+            return pExtract;
+        }
 
-                InternalTransplant(pDelete, pSuccessor);
-                if(pDelete->pLeft != nullptr) pDelete->pLeft->pParent = pSuccessor;
-                pSuccessor->pLeft = pDelete->pLeft;
-                
-                InternalCheckViolationDelete(pSuccessorChild, isBlack);
+        /**
+         * \brief Links a detached node into the tree. Returns false and leaves the node to the caller if its key
+         * is already in the tree
+         */
+        bool InsertNode(Node* pNode)
+        {
+            pNode->pLeft = nullptr;
+            pNode->pRight = nullptr;
+            pNode->SetParent(nullptr);
+
+            Node* pParent = nullptr;
+            for(Node* pTemp = pRoot; pTemp != nullptr;)
+            {
+                pParent = pTemp;
+                if(pNode->key < pTemp->key) pTemp = pTemp->pLeft;
+                else if(pTemp->key < pNode->key) pTemp = pTemp->pRight;
+                else return false;
             }
-            else if(pDelete->pRight != nullptr)
+
+            if(pParent == nullptr)
             {
-                InternalTransplant(pDelete, pDelete->pRight);
-                InternalCheckViolationDelete(pDelete->pRight, isBlack);
+                pNode->SetBlack(true);
+                pRoot = pNode;
+                return true;
             }
-            else if(pDelete->pLeft != nullptr)
+
+            pNode->SetBlack(false);
+            pNode->SetParent(pParent);
+            if(pNode->key < pParent->key) pParent->pLeft = pNode;
+            else pParent->pRight = pNode;
+            InternalCheckViolation(pNode);
+            return true;
+        }
+
+        /**
+         * \brief Returns the node with the first key not less than the given key, or nullptr
+         */
+        Node* LowerBound(const Key& key) const
+        {
+            Node* pResult = nullptr;
+            for(Node* pTemp = pRoot; pTemp != nullptr;)
             {
-                InternalTransplant(pDelete, pDelete->pLeft);
-                InternalCheckViolationDelete(pDelete->pLeft, isBlack);
+                if(pTemp->key < key) pTemp = pTemp->pRight;
+                else
+                {
+                    pResult = pTemp;
+                    pTemp = pTemp->pLeft;
+                }
             }
-            else
+            return pResult;
+        }
+
+        /**
+         * \brief Returns the node with the first key greater than the given key, or nullptr
+         */
+        Node* UpperBound(const Key& key) const
+        {
+            Node* pResult = nullptr;
+            for(Node* pTemp = pRoot; pTemp != nullptr;)
             {
-                if(pDelete->pParent == nullptr)
+                if(key < pTemp->key)
                 {
-                    Free(&pDelete);
-                    pRoot = nullptr;
-                    return;
+                    pResult = pTemp;
+                    pTemp = pTemp->pLeft;
                 }
-                if(pDelete->pParent->pRight == pDelete) pDelete->pParent->pRight = nullptr;
-                else pDelete->pParent->pLeft = nullptr;
+                else pTemp = pTemp->pRight;
             }
-            Free(&pDelete);
+            return pResult;
+        }
+
+        /**
+         * \brief Returns the [LowerBound, UpperBound) pair of nodes for the given key, first == second if the key
+         * isn't in the container
+         */
+        Pair<Node*, Node*> EqualRange(const Key& key) const
+        {
+            Node* pLower = LowerBound(key);
+            if(pLower == nullptr || key < pLower->key) return Pair<Node*, Node*>(pLower, pLower);
+            return Pair<Node*, Node*>(pLower, Next(pLower));
+        }
+
+        /**
+         * \brief Calls function(key, value) for every entry with lower <= key < upper in ascending order,
+         * in O(log n + k)
+         */
+        template<class Function>
+        void ForEachInRange(const Key& lower, const Key& upper, Function function) const
+        {
+            for(Node* pTemp = LowerBound(lower); pTemp != nullptr && pTemp->key < upper; pTemp = Next(pTemp))
+            {
+                function(pTemp->key, pTemp->value);
+            }
+        }
+
+        /**
+         * \brief Deletes every entry with lower <= key < upper and returns how many were deleted. The walk goes
+         * from node to node, deleting a node relinks its successor instead of copying it, so nothing is searched twice
+         */
+        ::Size EraseRange(const Key& lower, const Key& upper)
+        {
+            ::Size erased = 0;
+            Node* pTemp = LowerBound(lower);
+            while(pTemp != nullptr && pTemp->key < upper)
+            {
+                Node* pNext = Next(pTemp);
+                InternalDelete(pTemp);
+                pTemp = pNext;
+                erased++;
+            }
+            return erased;
+        }
+
+        /**
+         * \brief Returns the node that follows the given one in key order, or nullptr
+         */
+        static Node* Next(const Node* pNode)
+        {
+            if(pNode->pRight != nullptr)
+            {
+                Node* pTemp = pNode->pRight;
+                while(pTemp->pLeft != nullptr) pTemp = pTemp->pLeft;
+                return pTemp;
+            }
+
+            Node* pParent = pNode->Parent();
+            while(pParent != nullptr && pNode == pParent->pRight)
+            {
+                pNode = pParent;
+                pParent = pParent->Parent();
+            }
+            return pParent;
+        }
+
+        /**
+         * \brief Returns the node that precedes the given one in key order, or nullptr
+         */
+        static Node* Previous(const Node* pNode)
+        {
+            if(pNode->pLeft != nullptr)
+            {
+                Node* pTemp = pNode->pLeft;
+                while(pTemp->pRight != nullptr) pTemp = pTemp->pRight;
+                return pTemp;
+            }
+
+            Node* pParent = pNode->Parent();
+            while(pParent != nullptr && pNode == pParent->pLeft)
+            {
+                pNode = pParent;
+                pParent = pParent->Parent();
+            }
+            return pParent;
         }
 
         /**
@@ -248,18 +426,137 @@ namespace WSTL
             return values;
         }
 
-        Node* LeftToRight(::Size index)
+        /**
+         * \brief Calls function(key, value) for every entry in ascending order, without building a Vector
+         */
+        template<class Function>
+        void ForEach(Function function) const
+        {
+            for(Node* pTemp = Min(); pTemp != nullptr; pTemp = Next(pTemp)) function(pTemp->key, pTemp->value);
+        }
+
+        /**
+         * \brief Replaces the contents with count sorted, unique keys in O(n). The middle key becomes the root, and
+         * only the nodes on the deepest level are red, so every path has the same number of black nodes.
+         * pValues can be nullptr, in which case the values are default constructed
+         */
+        void AssignSorted(const Key* pKeys, const Value* pValues, ::Size count)
+        {
+            ::Size index = 0;
+            AssignSorted(count, [pKeys, pValues, &index]
+            {
+                Node* pNode = new Node(pKeys[index], pValues != nullptr ? pValues[index] : Value());
+                index++;
+                return pNode;
+            });
+        }
+
+        /**
+         * \brief Replaces the contents with count nodes returned in ascending key order by next(), in O(n)
+         */
+        template<class Function>
+        void AssignSorted(::Size count, Function next)
+        {
+            Clear();
+            pRoot = InternalBuildSorted(next, count, 0, InternalSortedHeight(count), nullptr);
+        }
+
+        /**
+         * \brief Moves every entry of other whose key isn't in this tree over in O(n + m). The nodes are relinked,
+         * not copied, and entries with keys already in this tree stay in other
+         */
+        void Merge(Self& other)
+        {
+            if(this == &other || other.pRoot == nullptr) return;
+
+            Vector<Node*> merged;
+            Vector<Node*> kept;
+            Node* pMine = InternalFindMin(pRoot);
+            Node* pTheirs = InternalFindMin(other.pRoot);
+            while(pMine != nullptr || pTheirs != nullptr)
+            {
+                if(pTheirs == nullptr || (pMine != nullptr && pMine->key < pTheirs->key))
+                {
+                    merged.PushBack(pMine);
+                    pMine = Next(pMine);
+                }
+                else if(pMine == nullptr || pTheirs->key < pMine->key)
+                {
+                    merged.PushBack(pTheirs);
+                    pTheirs = Next(pTheirs);
+                }
+                else
+                {
+                    kept.PushBack(pTheirs);
+                    pTheirs = Next(pTheirs);
+                }
+            }
+
+            pRoot = InternalRelinkSorted(merged);
+            other.pRoot = other.InternalRelinkSorted(kept);
+        }
+
+        /**
+         * \brief Moves every entry with a key not less than the given key into the returned tree, in O(log n).
+         * The tree is cut along the search path and the pieces are put back together with InternalJoin
+         */
+        Self Split(const Key& key)
+        {
+            Node* pTemp = pRoot;
+            const ::Size height = InternalBlackHeight(pTemp);
+            pRoot = nullptr;
+
+            Node* pLeft;
+            Node* pRight;
+            ::Size leftHeight;
+            ::Size rightHeight;
+            InternalSplit(pTemp, height, key, pLeft, leftHeight, pRight, rightHeight);
+
+            Self right;
+            right.pRoot = pRight;
+            pRoot = pLeft;
+            return right;
+        }
+
+        /**
+         * \brief Moves every entry of other into this tree in O(log n + log m). Every key in other has to be greater
+         * than every key in this tree, otherwise std::invalid_argument is thrown and nothing changes
+         */
+        void Join(Self& other)
+        {
+            if(this == &other || other.pRoot == nullptr) return;
+            if(pRoot == nullptr)
+            {
+                pRoot = other.pRoot;
+                other.pRoot = nullptr;
+                return;
+            }
+
+            Node* pMiddle = InternalFindMin(other.pRoot);
+            if(!(InternalFindMax(pRoot)->key < pMiddle->key))
+                throw std::invalid_argument("RBTree::Join: keys of other are not all greater");
+
+            other.InternalUnlink(pMiddle);
+            Node* pLeft = pRoot;
+            Node* pRight = other.pRoot;
+            other.pRoot = nullptr;
+
+            ::Size height;
+            pRoot = InternalJoin(pLeft, InternalBlackHeight(pLeft), pMiddle, pRight, InternalBlackHeight(pRight), height);
+        }
+
+        Node* LeftToRight(::Size index) const
         {
             ::Size current = 0;
             return InternalLeftToRight(pRoot, index, current);
         }
 
-        Node* Min()
+        Node* Min() const
         {
             return InternalFindMin(pRoot);
         }
 
-        Node* Max()
+        Node* Max() const
         {
             return InternalFindMax(pRoot);
         }
@@ -277,7 +574,7 @@ namespace WSTL
                 if(pTemp->pLeft != nullptr) return InternalInsert(pTemp->pLeft, key, value);
                 
                 pTemp->pLeft = new Node(key, value, false);
-                pTemp->pLeft->pParent = pTemp;
+                pTemp->pLeft->SetParent(pTemp);
                 return pTemp->pLeft;
             }
             else if(key > pTemp->key)
@@ -285,7 +582,7 @@ namespace WSTL
                 if(pTemp->pRight != nullptr) return InternalInsert(pTemp->pRight, key, value);
 
                 pTemp->pRight = new Node(key, value, false);
-                pTemp->pRight->pParent = pTemp;
+                pTemp->pRight->SetParent(pTemp);
                 return pTemp->pRight;
             }
 
@@ -295,7 +592,7 @@ namespace WSTL
         /**
          * \brief Searches for the given key in the container
          */
-        Node* InternalSearch(Node* pTemp, const Key& key)
+        Node* InternalSearch(Node* pTemp, const Key& key) const
         {
             if(pTemp == nullptr) return nullptr;
 
@@ -346,29 +643,29 @@ namespace WSTL
         }
 
         /**
-         * \brief Checks if the Red-Black Tree rules are being violated and fixes them
+         * \brief Checks if the Red-Black Tree rules are being violated and fixes them. Returns true if the root had
+         * to be turned black, which makes the tree one black level taller
          */
-        void InternalCheckViolation(Node* pTemp)
+        bool InternalCheckViolation(Node* pTemp)
         {            
-            while(!pTemp->pParent->isBlack)
+            while(!pTemp->Parent()->IsBlack())
             {
-                Node* pParent = pTemp->pParent;
+                Node* pParent = pTemp->Parent();
                 if(pParent == nullptr) break;
                 
-                Node* pGrandParent = pParent->pParent;
+                Node* pGrandParent = pParent->Parent();
                 if(pGrandParent == nullptr) break;
 
                 auto isUncleLeft = pParent != pGrandParent->pLeft;
                 auto pUncle =  isUncleLeft ? pGrandParent->pLeft : pGrandParent->pRight;
-                if(pUncle == nullptr) pUncle = new Node(Key(), Value(), true);
 
-                if(!pUncle->isBlack)
+                if(pUncle != nullptr && !pUncle->IsBlack())
                 {
-                    pParent->isBlack = true;
-                    pUncle->isBlack = true;
-                    pGrandParent->isBlack = false;
+                    pParent->SetBlack(true);
+                    pUncle->SetBlack(true);
+                    pGrandParent->SetBlack(false);
                     pTemp = pGrandParent;
-                    if(pTemp->pParent == nullptr) break;
+                    if(pTemp->Parent() == nullptr) break;
                 }
                 else
                 {
@@ -378,77 +675,176 @@ namespace WSTL
                         {
                             pTemp = pParent;
                             InternalRotateRight(pTemp);
-                            if(pTemp->pParent == nullptr) break;
-                            pParent = pTemp->pParent;
-                            pGrandParent = pParent->pParent;
+                            if(pTemp->Parent() == nullptr) break;
+                            pParent = pTemp->Parent();
+                            pGrandParent = pParent->Parent();
                         }
-                        pParent->isBlack = true;
-                        pGrandParent->isBlack = false;
+                        pParent->SetBlack(true);
+                        pGrandParent->SetBlack(false);
                         InternalRotateLeft(pGrandParent);
                     }
                     else
                     {
-                        if(pTemp == pParent->pLeft)
+                        if(pTemp == pParent->pRight)
                         {
                             pTemp = pParent;
                             InternalRotateLeft(pTemp);
-                            if(pTemp->pParent == nullptr) break;
-                            pParent = pTemp->pParent;
-                            pGrandParent = pParent->pParent;
+                            if(pTemp->Parent() == nullptr) break;
+                            pParent = pTemp->Parent();
+                            pGrandParent = pParent->Parent();
                         }
-                        pParent->isBlack = true;
-                        pGrandParent->isBlack = false;
+                        pParent->SetBlack(true);
+                        pGrandParent->SetBlack(false);
                         InternalRotateRight(pGrandParent);
                     }
                 }
             }
-            pRoot->isBlack = true;
+            const bool wasRed = !pRoot->IsBlack();
+            pRoot->SetBlack(true);
+            return wasRed;
         }
 
         /**
-         * \brief Checks if the Red-Black Tree rules are being violated and fixes them after a deletion 
+         * \brief Unlinks the node from the tree and deletes it. A node with two children is replaced by its
+         * successor node, which keeps every other node where it was
          */
-        void InternalCheckViolationDelete(Node* pTemp, bool isBlack)
+        void InternalDelete(Node* pDelete)
         {
-            if(pTemp == nullptr) return;
-            if(!isBlack) return;
+            InternalUnlink(pDelete);
+            Free(&pDelete);
+        }
 
-            while(pTemp != pRoot && pTemp->isBlack)
+        /**
+         * \brief Unlinks the node from the tree without deleting it
+         */
+        void InternalUnlink(Node* pDelete)
+        {
+            bool isBlack = pDelete->IsBlack();
+            Node* pChild;
+            Node* pChildParent;
+
+            if(pDelete->pLeft == nullptr)
             {
-                if(pTemp == pTemp->pParent->pLeft)
+                pChild = pDelete->pRight;
+                pChildParent = pDelete->Parent();
+                InternalTransplant(pDelete, pDelete->pRight);
+            }
+            else if(pDelete->pRight == nullptr)
+            {
+                pChild = pDelete->pLeft;
+                pChildParent = pDelete->Parent();
+                InternalTransplant(pDelete, pDelete->pLeft);
+            }
+            else
+            {
+                Node* pSuccessor = InternalFindMin(pDelete->pRight);
+                isBlack = pSuccessor->IsBlack();
+                pChild = pSuccessor->pRight;
+
+                if(pSuccessor->Parent() == pDelete) pChildParent = pSuccessor;
+                else
                 {
-                    Node* pBrother = pTemp->pParent->pRight;
-                    if(!pBrother->isBlack)
+                    pChildParent = pSuccessor->Parent();
+                    InternalTransplant(pSuccessor, pSuccessor->pRight);
+                    pSuccessor->pRight = pDelete->pRight;
+                    pSuccessor->pRight->SetParent(pSuccessor);
+                }
+
+                InternalTransplant(pDelete, pSuccessor);
+                pSuccessor->pLeft = pDelete->pLeft;
+                pSuccessor->pLeft->SetParent(pSuccessor);
+                pSuccessor->SetBlack(pDelete->IsBlack());
+            }
+
+            pDelete->SetParent(nullptr);
+            pDelete->pLeft = nullptr;
+            pDelete->pRight = nullptr;
+            if(isBlack) InternalCheckViolationDelete(pChild, pChildParent);
+        }
+
+        /**
+         * \brief Checks if the Red-Black Tree rules are being violated and fixes them after a deletion. pTemp
+         * carries the missing black and may be nullptr, so its parent is passed along
+         */
+        void InternalCheckViolationDelete(Node* pTemp, Node* pParent)
+        {
+            while(pTemp != pRoot && InternalIsBlack(pTemp))
+            {
+                if(pTemp == pParent->pLeft)
+                {
+                    Node* pBrother = pParent->pRight;
+                    if(!pBrother->IsBlack())
                     {
-                        pBrother->isBlack = true;
-                        pTemp->pParent->isBlack = false;
-                        InternalRotateLeft(pTemp->pParent);
-                        pBrother = pTemp->pParent->pRight;
+                        pBrother->SetBlack(true);
+                        pParent->SetBlack(false);
+                        InternalRotateLeft(pParent);
+                        pBrother = pParent->pRight;
                     }
-                    if(pBrother->pLeft->isBlack && pBrother->pRight->isBlack)
+                    if(InternalIsBlack(pBrother->pLeft) && InternalIsBlack(pBrother->pRight))
                     {
-                        pBrother->isBlack = false;
-                        pTemp = pTemp->pParent;
+                        pBrother->SetBlack(false);
+                        pTemp = pParent;
+                        pParent = pTemp->Parent();
                     }
                     else
                     {
-                        if(pBrother->pRight->isBlack)
+                        if(InternalIsBlack(pBrother->pRight))
                         {
-                            pBrother->pLeft->isBlack = true;
-                            pBrother->isBlack = false;
+                            pBrother->pLeft->SetBlack(true);
+                            pBrother->SetBlack(false);
                             InternalRotateRight(pBrother);
-                            pBrother = pTemp->pParent->pRight;
+                            pBrother = pParent->pRight;
                         }
-                        pBrother->isBlack = pTemp->pParent->isBlack;
-                        pTemp->pParent->isBlack = true;
-                        pBrother->pRight->isBlack = true;
-                        InternalRotateLeft(pTemp->pParent);
-                        pTemp = pRoot;                        
+                        pBrother->SetBlack(pParent->IsBlack());
+                        pParent->SetBlack(true);
+                        pBrother->pRight->SetBlack(true);
+                        InternalRotateLeft(pParent);
+                        pTemp = pRoot;
+                    }
+                }
+                else
+                {
+                    Node* pBrother = pParent->pLeft;
+                    if(!pBrother->IsBlack())
+                    {
+                        pBrother->SetBlack(true);
+                        pParent->SetBlack(false);
+                        InternalRotateRight(pParent);
+                        pBrother = pParent->pLeft;
+                    }
+                    if(InternalIsBlack(pBrother->pLeft) && InternalIsBlack(pBrother->pRight))
+                    {
+                        pBrother->SetBlack(false);
+                        pTemp = pParent;
+                        pParent = pTemp->Parent();
+                    }
+                    else
+                    {
+                        if(InternalIsBlack(pBrother->pLeft))
+                        {
+                            pBrother->pRight->SetBlack(true);
+                            pBrother->SetBlack(false);
+                            InternalRotateLeft(pBrother);
+                            pBrother = pParent->pLeft;
+                        }
+                        pBrother->SetBlack(pParent->IsBlack());
+                        pParent->SetBlack(true);
+                        pBrother->pLeft->SetBlack(true);
+                        InternalRotateRight(pParent);
+                        pTemp = pRoot;
                     }
                 }
             }
 
-            pTemp->isBlack = true;
+            if(pTemp != nullptr) pTemp->SetBlack(true);
+        }
+
+        /**
+         * \brief Missing children count as black leaves
+         */
+        static bool InternalIsBlack(const Node* pTemp)
+        {
+            return pTemp == nullptr || pTemp->IsBlack();
         }
 
         /**
@@ -458,20 +854,20 @@ namespace WSTL
         {
             if(pTarget == nullptr) return;
 
-            if(pTarget->pParent == nullptr)
+            if(pTarget->Parent() == nullptr)
             {                
                 pRoot = pSource;
             }
-            else if(pTarget == pTarget->pParent->pLeft)
+            else if(pTarget == pTarget->Parent()->pLeft)
             {
-                pTarget->pParent->pLeft = pSource;
+                pTarget->Parent()->pLeft = pSource;
             }
             else
             {
-                pTarget->pParent->pRight = pSource;
+                pTarget->Parent()->pRight = pSource;
             }
 
-            if(pSource != nullptr) pSource->pParent = pTarget->pParent;
+            if(pSource != nullptr) pSource->SetParent(pTarget->Parent());
         }
 
         /**
@@ -486,22 +882,22 @@ namespace WSTL
 
             pParent->pRight = pChild->pLeft;
             if(pParent->pRight != nullptr)
-                pParent->pRight->pParent = pParent;
+                pParent->pRight->SetParent(pParent);
             
-            pChild->pParent = pParent->pParent;
-            if(pParent->pParent == nullptr)
+            pChild->SetParent(pParent->Parent());
+            if(pParent->Parent() == nullptr)
                 pRoot = pChild;
-            else if(pParent == pParent->pParent->pLeft)
+            else if(pParent == pParent->Parent()->pLeft)
             {
-                pParent->pParent->pLeft = pChild;
+                pParent->Parent()->pLeft = pChild;
             }
             else
             {
-                pParent->pParent->pRight = pChild;
+                pParent->Parent()->pRight = pChild;
             }
             
             pChild->pLeft = pParent;
-            pParent->pParent = pChild;
+            pParent->SetParent(pChild);
         }
 
         /**
@@ -516,22 +912,22 @@ namespace WSTL
 
             pParent->pLeft = pChild->pRight;
             if(pParent->pLeft != nullptr)
-                pParent->pLeft->pParent = pParent;
+                pParent->pLeft->SetParent(pParent);
             
-            pChild->pParent = pParent->pParent;
-            if(pParent->pParent == nullptr)
+            pChild->SetParent(pParent->Parent());
+            if(pParent->Parent() == nullptr)
                 pRoot = pChild;
-            else if(pParent == pParent->pParent->pLeft)
+            else if(pParent == pParent->Parent()->pLeft)
             {
-                pParent->pParent->pLeft = pChild;
+                pParent->Parent()->pLeft = pChild;
             }
             else
             {
-                pParent->pParent->pRight = pChild;
+                pParent->Parent()->pRight = pChild;
             }
             
             pChild->pRight = pParent;
-            pParent->pParent = pChild;
+            pParent->SetParent(pChild);
         }
 
         /**
@@ -543,14 +939,14 @@ namespace WSTL
             Node* pTemp = InternalSearch(pRoot, pOther->key);
             if(pOther->pLeft != nullptr)
             {
-                pTemp->pLeft = new Node(pOther->pLeft->key, pOther->pLeft->value, pOther->pLeft->isBlack);
-                pTemp->pLeft->pParent = pTemp;
+                pTemp->pLeft = new Node(pOther->pLeft->key, pOther->pLeft->value, pOther->pLeft->IsBlack());
+                pTemp->pLeft->SetParent(pTemp);
                 InternalCopy(pOther->pLeft);
             }
             if(pOther->pRight != nullptr)
             {
-                pTemp->pRight = new Node(pOther->pRight->key, pOther->pRight->value, pOther->pRight->isBlack);
-                pTemp->pRight->pParent = pTemp;
+                pTemp->pRight = new Node(pOther->pRight->key, pOther->pRight->value, pOther->pRight->IsBlack());
+                pTemp->pRight->SetParent(pTemp);
                 InternalCopy(pOther->pRight);
             }
         }
@@ -588,7 +984,162 @@ namespace WSTL
             if(pTemp->pRight != nullptr) InternalGetValues(pTemp->pRight, values);
         }
 
-        Node* InternalLeftToRight(Node* pTemp, ::Size index, ::Size& current)
+        /**
+         * \brief Builds a balanced subtree from the next count nodes. The left half is built first so next() is
+         * called in key order, the middle node becomes the root, and only nodes on the deepest level are red
+         */
+        template<class Function>
+        Node* InternalBuildSorted(Function& next, ::Size count, ::Size depth, ::Size height, Node* pParent)
+        {
+            if(count == 0) return nullptr;
+
+            const ::Size leftCount = count / 2;
+            Node* pLeft = InternalBuildSorted(next, leftCount, depth + 1, height, nullptr);
+            Node* pNode = next();
+            pNode->SetParent(pParent);
+            pNode->SetBlack(!(height > 1 && depth + 1 == height));
+            pNode->pLeft = pLeft;
+            if(pLeft != nullptr) pLeft->SetParent(pNode);
+            pNode->pRight = InternalBuildSorted(next, count - leftCount - 1, depth + 1, height, pNode);
+            return pNode;
+        }
+
+        /**
+         * \brief Returns the number of levels of a balanced tree with count nodes
+         */
+        static ::Size InternalSortedHeight(::Size count)
+        {
+            ::Size height = 0;
+            for(::Size remaining = count; remaining != 0; remaining /= 2) height++;
+            return height;
+        }
+
+        /**
+         * \brief Relinks the given nodes, already in key order, into a balanced tree and returns its root
+         */
+        Node* InternalRelinkSorted(const Vector<Node*>& nodes)
+        {
+            ::Size index = 0;
+            auto next = [&nodes, &index] { return nodes[index++]; };
+            return InternalBuildSorted(next, nodes.Size(), 0, InternalSortedHeight(nodes.Size()), nullptr);
+        }
+
+        /**
+         * \brief Returns the number of black nodes from the node down to a leaf, counting the node itself
+         */
+        static ::Size InternalBlackHeight(const Node* pTemp)
+        {
+            ::Size height = 0;
+            for(; pTemp != nullptr; pTemp = pTemp->pLeft) height += pTemp->IsBlack();
+            return height;
+        }
+
+        /**
+         * \brief Joins two detached trees with black roots and the node that goes between them, every key in
+         * pLeft being less than pMiddle's and every key in pRight greater. The middle node is hung off the spine of
+         * the taller tree where the black heights match, so this is O(|leftHeight - rightHeight| + 1).
+         * Returns the new root and writes its black height to height
+         */
+        Node* InternalJoin(Node* pLeft, ::Size leftHeight, Node* pMiddle, Node* pRight, ::Size rightHeight,
+                           ::Size& height)
+        {
+            pMiddle->SetParent(nullptr);
+            if(leftHeight == rightHeight)
+            {
+                pMiddle->pLeft = pLeft;
+                pMiddle->pRight = pRight;
+                if(pLeft != nullptr) pLeft->SetParent(pMiddle);
+                if(pRight != nullptr) pRight->SetParent(pMiddle);
+                pMiddle->SetBlack(true);
+                height = leftHeight + 1;
+                return pMiddle;
+            }
+
+            const bool isLeftTaller = leftHeight > rightHeight;
+            Node* pTaller = isLeftTaller ? pLeft : pRight;
+            Node* pShorter = isLeftTaller ? pRight : pLeft;
+            const ::Size shorterHeight = isLeftTaller ? rightHeight : leftHeight;
+
+            // Walks down the inner spine of the taller tree to the first black node, or leaf, of the same height
+            Node* pParent = nullptr;
+            Node* pTemp = pTaller;
+            ::Size tempHeight = isLeftTaller ? leftHeight : rightHeight;
+            while(tempHeight != shorterHeight || (pTemp != nullptr && !pTemp->IsBlack()))
+            {
+                tempHeight -= pTemp->IsBlack();
+                pParent = pTemp;
+                pTemp = isLeftTaller ? pTemp->pRight : pTemp->pLeft;
+            }
+
+            pMiddle->SetBlack(false);
+            pMiddle->pLeft = isLeftTaller ? pTemp : pShorter;
+            pMiddle->pRight = isLeftTaller ? pShorter : pTemp;
+            if(pMiddle->pLeft != nullptr) pMiddle->pLeft->SetParent(pMiddle);
+            if(pMiddle->pRight != nullptr) pMiddle->pRight->SetParent(pMiddle);
+            pMiddle->SetParent(pParent);
+            if(isLeftTaller) pParent->pRight = pMiddle;
+            else pParent->pLeft = pMiddle;
+
+            // The fix-up works on pRoot, which is free while trees are being taken apart and put back together
+            Node* pSaved = pRoot;
+            pRoot = pTaller;
+            height = (isLeftTaller ? leftHeight : rightHeight) + InternalCheckViolation(pMiddle);
+            Node* pJoined = pRoot;
+            pRoot = pSaved;
+            return pJoined;
+        }
+
+        /**
+         * \brief Splits the detached tree under pTemp, whose root is black and has the given black height, into the
+         * keys less than key and the rest
+         */
+        void InternalSplit(Node* pTemp, ::Size height, const Key& key, Node*& pLeft, ::Size& leftHeight,
+                           Node*& pRight, ::Size& rightHeight)
+        {
+            if(pTemp == nullptr)
+            {
+                pLeft = pRight = nullptr;
+                leftHeight = rightHeight = 0;
+                return;
+            }
+
+            const ::Size childHeight = height - pTemp->IsBlack();
+            Node* pChildLeft = pTemp->pLeft;
+            Node* pChildRight = pTemp->pRight;
+            ::Size childLeftHeight = InternalDetach(pChildLeft, childHeight);
+            ::Size childRightHeight = InternalDetach(pChildRight, childHeight);
+
+            if(pTemp->key < key)
+            {
+                Node* pRest;
+                ::Size restHeight;
+                InternalSplit(pChildRight, childRightHeight, key, pRest, restHeight, pRight, rightHeight);
+                pLeft = InternalJoin(pChildLeft, childLeftHeight, pTemp, pRest, restHeight, leftHeight);
+            }
+            else
+            {
+                Node* pRest;
+                ::Size restHeight;
+                InternalSplit(pChildLeft, childLeftHeight, key, pLeft, leftHeight, pRest, restHeight);
+                pRight = InternalJoin(pRest, restHeight, pTemp, pChildRight, childRightHeight, rightHeight);
+            }
+        }
+
+        /**
+         * \brief Makes a subtree a tree of its own: the parent link is cut and a red root turns black, which is
+         * reflected in the returned black height
+         */
+        static ::Size InternalDetach(Node* pTemp, ::Size height)
+        {
+            if(pTemp == nullptr) return 0;
+
+            pTemp->SetParent(nullptr);
+            if(pTemp->IsBlack()) return height;
+            pTemp->SetBlack(true);
+            return height + 1;
+        }
+
+        Node* InternalLeftToRight(Node* pTemp, ::Size index, ::Size& current) const
         {
             if(pTemp == nullptr) return nullptr;
             if(pTemp->pLeft != nullptr)
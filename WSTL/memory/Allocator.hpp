@@ -4,6 +4,7 @@
 
 constexpr unsigned SystemAllocatorMinAlignment = alignof(max_align_t);
 constexpr unsigned SystemPointerSize = 8;
+constexpr unsigned SystemCacheLineSize = 64;
 
 namespace WSTL
 {
@@ -0,0 +1,190 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    /**
+     * \brief Bump allocator: hands out memory from large blocks by moving an offset, and frees everything at once
+     * with Reset or on destruction. Individual allocations are never freed and destructors are not run, so it suits
+     * trivially destructible data with a shared lifetime, like the characters of many strings. Not thread-safe
+     */
+    class Arena
+    {
+        /**
+         * \brief Header at the start of every block, the usable memory follows it
+         */
+        struct Block
+        {
+            Block* pNext;
+            Size size;
+        };
+
+    public:
+        /**
+         * \brief Default size of a block, allocations larger than a block get a block of their own
+         */
+        static constexpr Size DefaultBlockSize = 64 * 1024;
+
+        /**
+         * \brief Constructor, no memory is allocated until the first allocation
+         */
+        explicit Arena(Size blockSize = DefaultBlockSize) noexcept : blockSize(blockSize)
+        {
+        }
+
+        Arena(const Arena& other) = delete;
+        Arena& operator=(const Arena& other) = delete;
+
+        /**
+         * \brief Move constructor
+         */
+        Arena(Arena&& other) noexcept
+        {
+            Swap(other);
+        }
+
+        /**
+         * \brief Move assignment operator
+         */
+        Arena& operator=(Arena&& other) noexcept
+        {
+            if(this == &other) return *this;
+            Arena moved(std::move(other));
+            Swap(moved);
+            return *this;
+        }
+
+        /**
+         * \brief Destructor, frees every block
+         */
+        ~Arena()
+        {
+            while(pFirst != nullptr)
+            {
+                Block* pNext = pFirst->pNext;
+                Allocator::Deallocate(&pFirst);
+                pFirst = pNext;
+            }
+        }
+
+        void Swap(Arena& other) noexcept
+        {
+            std::swap(pFirst, other.pFirst);
+            std::swap(pCurrent, other.pCurrent);
+            std::swap(offset, other.offset);
+            std::swap(blockSize, other.blockSize);
+            std::swap(used, other.used);
+        }
+
+        /**
+         * \brief Returns bytes of uninitialized memory aligned to alignment, which must be a power of two
+         */
+        void* Allocate(Size bytes, Size alignment = SystemAllocatorMinAlignment)
+        {
+            if(pCurrent == nullptr || AlignedOffset(alignment) + bytes > pCurrent->size) NextBlock(bytes + alignment);
+
+            const Size start = AlignedOffset(alignment);
+            offset = start + bytes;
+            used += bytes;
+            return Memory(pCurrent) + start;
+        }
+
+        /**
+         * \brief Returns uninitialized memory for count objects of type T
+         */
+        template<typename T>
+        T* Allocate(Size count)
+        {
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * \brief Constructs an object in the arena. Its destructor is never run
+         */
+        template<typename T, class... Args>
+        T* New(Args&&... args)
+        {
+            return new(Allocate<T>(1)) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * \brief Forgets every allocation and keeps the blocks for reuse
+         */
+        void Reset() noexcept
+        {
+            pCurrent = pFirst;
+            offset = 0;
+            used = 0;
+        }
+
+        /**
+         * \brief Returns the number of bytes handed out since construction or the last Reset
+         */
+        Size BytesUsed() const noexcept
+        {
+            return used;
+        }
+
+        /**
+         * \brief Returns the number of bytes held in blocks
+         */
+        Size Capacity() const noexcept
+        {
+            Size capacity = 0;
+            for(const Block* pBlock = pFirst; pBlock != nullptr; pBlock = pBlock->pNext) capacity += pBlock->size;
+            return capacity;
+        }
+
+    private:
+        static Byte* Memory(Block* pBlock) noexcept
+        {
+            return reinterpret_cast<Byte*>(pBlock + 1);
+        }
+
+        /**
+         * \brief Returns the first offset in the current block at or after offset whose address is aligned
+         */
+        Size AlignedOffset(Size alignment) const noexcept
+        {
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(Memory(pCurrent)) + offset;
+            return offset + ((alignment - address % alignment) % alignment);
+        }
+
+        /**
+         * \brief Moves to the next block that holds at least bytes, reusing blocks kept by Reset before allocating
+         */
+        void NextBlock(Size bytes)
+        {
+            Block* pPrevious = pCurrent;
+            Block* pNext = pCurrent == nullptr ? pFirst : pCurrent->pNext;
+            while(pNext != nullptr && pNext->size < bytes)
+            {
+                pPrevious = pNext;
+                pNext = pNext->pNext;
+            }
+
+            if(pNext == nullptr)
+            {
+                const Size size = bytes > blockSize ? bytes : blockSize;
+                pNext = Allocator::AllocateAligned<Block>(sizeof(Block) + size, SystemCacheLineSize);
+                pNext->pNext = nullptr;
+                pNext->size = size;
+                if(pPrevious == nullptr) pFirst = pNext;
+                else pPrevious->pNext = pNext;
+            }
+
+            pCurrent = pNext;
+            offset = 0;
+        }
+
+        Block* pFirst = nullptr;
+        Block* pCurrent = nullptr;
+        Size offset = 0;
+        Size blockSize = DefaultBlockSize;
+        Size used = 0;
+    };
+}
@@ -0,0 +1,586 @@
+#pragma once
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/Array.hpp"
+#include "WSTL/containers/Vector.hpp"
+#include "WSTL/containers/concurrent/MpmcQueue.hpp"
+#include "WSTL/containers/concurrent/WorkStealingDeque.hpp"
+#include "WSTL/memory/Allocator.hpp"
+
+namespace WSTL
+{
+    class JobSystem;
+
+    /**
+     * \brief Counts the jobs that were run against it and have not finished yet
+     */
+    struct JobCounter
+    {
+        std::atomic<UI32> value = 0;
+
+        /**
+         * \brief Returns if every job attached to this counter has finished
+         */
+        bool IsDone() const noexcept
+        {
+            return value.load(std::memory_order_acquire) == 0;
+        }
+    };
+
+    /**
+     * \brief A unit of work. Jobs are created by a JobSystem and are only valid until a few thousand newer jobs have
+     * been created on the same thread, the callable is stored inline so creating a job never allocates. Once a job is
+     * running, track it through the JobHandle returned by Run since its slot is recycled after it finishes.
+     */
+    class alignas(SystemCacheLineSize * 2) Job
+    {
+        friend class JobSystem;
+        friend class JobHandle;
+
+    public:
+        static constexpr Size MaxContinuations = 4;
+        static constexpr Size PayloadSize = 48;
+
+        /**
+         * \brief Returns if the job and all of its children have finished
+         */
+        bool IsFinished() const noexcept
+        {
+            return unfinished.load(std::memory_order_acquire) == 0;
+        }
+
+    private:
+        typedef void (*Function)(Job&);
+
+        Function pFunction;
+        Function pDestroy;
+        std::atomic<UI32> generation;
+        Job* pParent;
+        JobCounter* pCounter;
+        std::atomic<UI32> unfinished;
+        std::atomic<UI32> continuationCount;
+        Job* continuations[MaxContinuations];
+        alignas(16) Byte payload[PayloadSize];
+    };
+
+    /**
+     * \brief Refers to one run of a job, stays valid after the job's slot has been recycled for a newer job
+     */
+    class JobHandle
+    {
+        friend class JobSystem;
+
+    public:
+        JobHandle() noexcept = default;
+
+        /**
+         * \brief Returns if the job and all of its children have finished
+         */
+        bool IsFinished() const noexcept
+        {
+            if(pJob == nullptr || pJob->IsFinished()) return true;
+
+            // A slot is only reused after its job finished, and a reuse bumps the generation before it is scheduled
+            return pJob->generation.load(std::memory_order_acquire) != generation;
+        }
+
+    private:
+        JobHandle(const Job* pJob, UI32 generation) noexcept : pJob(pJob), generation(generation) { }
+
+        const Job* pJob = nullptr;
+        UI32 generation = 0;
+    };
+
+    /**
+     * \brief Thread pool that runs jobs from per-thread Chase-Lev deques. Idle threads steal from the others, and
+     * waiting threads keep running jobs instead of blocking. The thread that constructs the system takes part as
+     * worker 0 whenever it waits.
+     */
+    class JobSystem
+    {
+        struct alignas(SystemCacheLineSize) Worker
+        {
+            WorkStealingDeque<Job*> deque;
+            Job* pJobs = nullptr;
+            Size nextJob = 0;
+            UI32 randomState = 0;
+        };
+
+    public:
+        static constexpr Size MaxJobsPerThread = 4096;
+
+        /**
+         * \brief Constructor, spawns `workerThreadCount` threads next to the calling thread
+         */
+        explicit JobSystem(Size workerThreadCount = DefaultWorkerThreadCount())
+            : threadCount(workerThreadCount + 1), injected(MaxJobsPerThread)
+        {
+            pWorkers = new Worker[threadCount];
+            for(Size i = 0; i < threadCount; i++)
+            {
+                pWorkers[i].pJobs = AllocateJobs();
+                pWorkers[i].randomState = static_cast<UI32>(i * 0x9e3779b9u + 1);
+            }
+            pForeignJobs = AllocateJobs();
+            ownerThread = std::this_thread::get_id();
+
+            running.store(true, std::memory_order_relaxed);
+            for(Size i = 1; i < threadCount; i++)
+            {
+                threads.PushBack(new std::thread([this, i] { WorkerMain(i); }));
+            }
+        }
+
+        JobSystem(const JobSystem& other) = delete;
+        JobSystem(JobSystem&& other) = delete;
+        JobSystem& operator=(const JobSystem& other) = delete;
+        JobSystem& operator=(JobSystem&& other) = delete;
+
+        /**
+         * \brief Destructor, stops the worker threads. Jobs that have not started are dropped, their callables are
+         * destroyed without being called
+         */
+        ~JobSystem()
+        {
+            running.store(false, std::memory_order_seq_cst);
+            wakeEpoch.fetch_add(1, std::memory_order_release);
+            wakeEpoch.notify_all();
+
+            for(auto pThread : threads)
+            {
+                pThread->join();
+                delete pThread;
+            }
+
+            for(Size i = 0; i < threadCount; i++) FreeJobs(pWorkers[i].pJobs);
+            FreeJobs(pForeignJobs);
+            delete[] pWorkers;
+        }
+
+        /**
+         * \brief Returns the number of threads that run jobs, including the owning thread
+         */
+        Size ThreadCount() const noexcept
+        {
+            return threadCount;
+        }
+
+        /**
+         * \brief Creates a job without scheduling it, so children and continuations can be attached before Run
+         */
+        template<class F>
+        Job* Create(F&& function)
+        {
+            typedef std::remove_cvref_t<F> Callable;
+            static_assert(sizeof(Callable) <= Job::PayloadSize, "Job callable is too large, capture by reference");
+            static_assert(alignof(Callable) <= 16, "Job callable is over-aligned");
+
+            Job* pJob = AllocateJob();
+            new (pJob->payload) Callable(std::forward<F>(function));
+            pJob->pFunction = [](Job& job) { (*std::launder(reinterpret_cast<Callable*>(job.payload)))(); };
+            pJob->pDestroy = nullptr;
+            if constexpr (!std::is_trivially_destructible_v<Callable>)
+            {
+                pJob->pDestroy = [](Job& job) { std::launder(reinterpret_cast<Callable*>(job.payload))->~Callable(); };
+            }
+            return pJob;
+        }
+
+        /**
+         * \brief Creates a job that `pParent` waits for. Has to be called before the parent finishes
+         */
+        template<class F>
+        Job* CreateChild(Job* pParent, F&& function)
+        {
+            // Created first, a throwing Create must not leave the parent waiting for a child that never exists
+            Job* pJob = Create(std::forward<F>(function));
+            pParent->unfinished.fetch_add(1, std::memory_order_relaxed);
+            pJob->pParent = pParent;
+            return pJob;
+        }
+
+        /**
+         * \brief Schedules a created job, `pCounter` is decremented once the job and its children have finished
+         */
+        JobHandle Run(Job* pJob, JobCounter* pCounter = nullptr)
+        {
+            const JobHandle handle(pJob, pJob->generation.load(std::memory_order_relaxed));
+            Attach(pJob, pCounter);
+            Schedule(pJob);
+            return handle;
+        }
+
+        /**
+         * \brief Creates and schedules a job in one step
+         */
+        template<class F>
+        JobHandle Run(F&& function, JobCounter& counter)
+        {
+            return Run(Create(std::forward<F>(function)), &counter);
+        }
+
+        /**
+         * \brief Schedules `pContinuation` once `pAntecedent` and its children have finished. Has to be called before
+         * the antecedent is run
+         */
+        void AddContinuation(Job* pAntecedent, Job* pContinuation, JobCounter* pCounter = nullptr)
+        {
+            // The bound is checked before the count moves, Finish copies continuationCount entries
+            UI32 index = pAntecedent->continuationCount.load(std::memory_order_relaxed);
+            do
+            {
+                if(index >= Job::MaxContinuations) throw std::out_of_range("Too many continuations on a job");
+            }
+            while(!pAntecedent->continuationCount.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+            Attach(pContinuation, pCounter);
+            pAntecedent->continuations[index] = pContinuation;
+        }
+
+        /**
+         * \brief Runs other jobs until every job attached to `counter` has finished
+         */
+        void WaitFor(const JobCounter& counter)
+        {
+            if(CurrentWorker() == NoWorker)
+            {
+                // Sleeps on the system's epoch rather than on the counter, Finish never touches a counter after its
+                // last decrement since the waiter may destroy it as soon as it reads zero
+                counterWaiters.fetch_add(1, std::memory_order_relaxed);
+                for(;;)
+                {
+                    const UI32 observed = counterEpoch.load(std::memory_order_acquire);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if(counter.IsDone()) break;
+                    counterEpoch.wait(observed, std::memory_order_acquire);
+                }
+                counterWaiters.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            while(!counter.IsDone()) Help();
+        }
+
+        /**
+         * \brief Runs other jobs until the job behind `handle` and its children have finished
+         */
+        void Wait(const JobHandle& handle)
+        {
+            const bool isWorker = CurrentWorker() != NoWorker;
+            while(!handle.IsFinished())
+            {
+                if(isWorker) Help();
+                else std::this_thread::yield();
+            }
+        }
+
+        /**
+         * \brief Calls `function(first, last)` over sub-ranges of [0, count) spread across the threads
+         */
+        template<class F>
+        void ParallelForRange(Size count, F&& function, Size grainSize = 0)
+        {
+            if(count == 0) return;
+            if(grainSize == 0) grainSize = DefaultGrainSize(count);
+
+            if(count <= grainSize)
+            {
+                function(static_cast<Size>(0), count);
+                return;
+            }
+
+            JobCounter counter;
+            Split(0, count, grainSize, function, &counter);
+            WaitFor(counter);
+        }
+
+        /**
+         * \brief Calls `function(element)` for every element of the range in parallel
+         */
+        template<typename T, class F>
+        void ParallelFor(T* pData, Size count, F&& function, Size grainSize = 0)
+        {
+            ParallelForRange(count, [pData, &function](Size first, Size last)
+            {
+                for(Size i = first; i < last; i++) function(pData[i]);
+            }, grainSize);
+        }
+
+        /**
+         * \brief Calls `function(element)` for every element of the vector in parallel
+         */
+        template<typename T, class F>
+        void ParallelFor(Vector<T>& vector, F&& function, Size grainSize = 0)
+        {
+            ParallelFor(vector.Data(), vector.Size(), std::forward<F>(function), grainSize);
+        }
+
+        /**
+         * \brief Calls `function(element)` for every element of the array in parallel
+         */
+        template<typename T, Size ArraySize, class F>
+        void ParallelFor(Array<T, ArraySize>& array, F&& function, Size grainSize = 0)
+        {
+            ParallelFor(array.Data(), ArraySize, std::forward<F>(function), grainSize);
+        }
+
+        /**
+         * \brief Returns a grain size that gives every thread several chunks to balance uneven work
+         */
+        Size DefaultGrainSize(Size count) const noexcept
+        {
+            const Size grainSize = count / (threadCount * 8);
+            return grainSize == 0 ? 1 : grainSize;
+        }
+
+        /**
+         * \brief Returns the default amount of extra threads, one per hardware thread besides the caller
+         */
+        static Size DefaultWorkerThreadCount() noexcept
+        {
+            const Size hardwareThreads = std::thread::hardware_concurrency();
+            return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+    private:
+        static constexpr Size NoWorker = ~Size(0);
+
+        /**
+         * \brief Returns the worker index of the calling thread, or NoWorker for threads that do not belong to this
+         * system. Only the pool's own threads are bound through the thread local, so systems can be created and
+         * destroyed in any order on any thread
+         */
+        Size CurrentWorker() const noexcept
+        {
+            if(tlsSystem == this) return tlsIndex;
+            return std::this_thread::get_id() == ownerThread ? 0 : NoWorker;
+        }
+
+        /**
+         * \brief Keeps the lower half of the range on this thread and hands the upper halves out as jobs
+         */
+        template<class F>
+        void Split(Size first, Size last, Size grainSize, F& function, JobCounter* pCounter)
+        {
+            while(last - first > grainSize)
+            {
+                const Size middle = first + (last - first) / 2;
+                Run(Create([this, middle, last, grainSize, &function, pCounter]
+                {
+                    Split(middle, last, grainSize, function, pCounter);
+                }), pCounter);
+                last = middle;
+            }
+
+            function(first, last);
+        }
+
+        void Attach(Job* pJob, JobCounter* pCounter)
+        {
+            pJob->pCounter = pCounter;
+            if(pCounter != nullptr) pCounter->value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Schedule(Job* pJob)
+        {
+            const Size worker = CurrentWorker();
+            if(worker != NoWorker) pWorkers[worker].deque.Push(pJob);
+            else injected.Push(pJob);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(sleepers.load(std::memory_order_relaxed) == 0) return;
+
+            wakeEpoch.fetch_add(1, std::memory_order_release);
+            wakeEpoch.notify_one();
+        }
+
+        /**
+         * \brief Runs the job and propagates its completion to the parent, the continuations and the counter
+         */
+        void Execute(Job* pJob)
+        {
+            pJob->pFunction(*pJob);
+            if(pJob->pDestroy != nullptr)
+            {
+                // Cleared so a job still waiting for its children does not look like one whose callable is alive
+                pJob->pDestroy(*pJob);
+                pJob->pDestroy = nullptr;
+            }
+            Finish(pJob);
+        }
+
+        void Finish(Job* pJob)
+        {
+            // Everything is read before the decrement, the slot may be reused as soon as it reaches zero
+            Job* pParent = pJob->pParent;
+            JobCounter* pCounter = pJob->pCounter;
+            const UI32 continuationCount = pJob->continuationCount.load(std::memory_order_acquire);
+            Job* continuations[Job::MaxContinuations];
+            for(UI32 i = 0; i < continuationCount; i++) continuations[i] = pJob->continuations[i];
+
+            if(pJob->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+            for(UI32 i = 0; i < continuationCount; i++) Schedule(continuations[i]);
+            if(pParent != nullptr) Finish(pParent);
+
+            // The counter may be destroyed once it reaches zero, only the system's epoch is touched afterwards
+            if(pCounter == nullptr || pCounter->value.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(counterWaiters.load(std::memory_order_relaxed) == 0) return;
+
+            counterEpoch.fetch_add(1, std::memory_order_release);
+            counterEpoch.notify_all();
+        }
+
+        /**
+         * \brief Runs one job from this thread's deque, the injection queue or another thread's deque
+         */
+        bool Help()
+        {
+            Job* pJob = nullptr;
+            if(!FindJob(CurrentWorker(), pJob))
+            {
+                std::this_thread::yield();
+                return false;
+            }
+
+            Execute(pJob);
+            return true;
+        }
+
+        bool FindJob(Size index, Job*& pJob)
+        {
+            Worker& worker = pWorkers[index];
+            if(worker.deque.Pop(pJob)) return true;
+            if(injected.TryPop(pJob)) return true;
+
+            // xorshift, only used to spread thieves over the victims
+            worker.randomState ^= worker.randomState << 13;
+            worker.randomState ^= worker.randomState >> 17;
+            worker.randomState ^= worker.randomState << 5;
+
+            const Size start = worker.randomState % threadCount;
+            for(Size i = 0; i < threadCount; i++)
+            {
+                const Size victim = (start + i) % threadCount;
+                if(victim != index && pWorkers[victim].deque.Steal(pJob)) return true;
+            }
+
+            return false;
+        }
+
+        void WorkerMain(Size index)
+        {
+            tlsSystem = this;
+            tlsIndex = index;
+
+            while(running.load(std::memory_order_acquire))
+            {
+                Job* pJob = nullptr;
+                bool found = false;
+                for(UI32 spin = 0; spin < IDLE_SPIN_COUNT && !found; spin++)
+                {
+                    found = FindJob(index, pJob);
+                    if(!found) std::this_thread::yield();
+                }
+
+                if(found)
+                {
+                    Execute(pJob);
+                    continue;
+                }
+
+                sleepers.fetch_add(1, std::memory_order_relaxed);
+                const UI32 observed = wakeEpoch.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if(FindJob(index, pJob))
+                {
+                    sleepers.fetch_sub(1, std::memory_order_relaxed);
+                    Execute(pJob);
+                    continue;
+                }
+                if(running.load(std::memory_order_acquire)) wakeEpoch.wait(observed, std::memory_order_acquire);
+                sleepers.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        Job* AllocateJob()
+        {
+            Job* pJob = nullptr;
+            const Size index = CurrentWorker();
+            if(index != NoWorker)
+            {
+                Worker& worker = pWorkers[index];
+                pJob = &worker.pJobs[worker.nextJob++ & (MaxJobsPerThread - 1)];
+            }
+            else
+            {
+                pJob = &pForeignJobs[nextForeignJob.fetch_add(1, std::memory_order_relaxed) & (MaxJobsPerThread - 1)];
+            }
+
+            if(!pJob->IsFinished()) throw std::runtime_error("Too many unfinished jobs on this thread");
+
+            // The new generation is published with `unfinished`, a handle that still sees the new job as unfinished
+            // also sees its generation
+            pJob->generation.store(pJob->generation.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            pJob->pParent = nullptr;
+            pJob->pCounter = nullptr;
+            pJob->unfinished.store(1, std::memory_order_release);
+            pJob->continuationCount.store(0, std::memory_order_relaxed);
+            return pJob;
+        }
+
+        static Job* AllocateJobs()
+        {
+            Job* pJobs = Allocator::AllocateAligned<Job>(sizeof(Job) * MaxJobsPerThread, alignof(Job));
+            for(Size i = 0; i < MaxJobsPerThread; i++)
+            {
+                new (&pJobs[i].unfinished) std::atomic<UI32>(0);
+                new (&pJobs[i].continuationCount) std::atomic<UI32>(0);
+                new (&pJobs[i].generation) std::atomic<UI32>(0);
+            }
+            return pJobs;
+        }
+
+        /**
+         * \brief Destroys the callables of jobs that were created but never executed, then frees the slots. Slots
+         * that were never handed out are finished, so their uninitialized members are not read
+         */
+        static void FreeJobs(Job* pJobs)
+        {
+            for(Size i = 0; i < MaxJobsPerThread; i++)
+            {
+                Job& job = pJobs[i];
+                if(!job.IsFinished() && job.pDestroy != nullptr) job.pDestroy(job);
+            }
+            Allocator::Deallocate(&pJobs);
+        }
+
+        Size threadCount;
+        Worker* pWorkers;
+        Vector<std::thread*> threads;
+
+        MpmcQueue<Job*> injected;
+        Job* pForeignJobs;
+        std::atomic<Size> nextForeignJob = 0;
+
+        std::atomic<bool> running;
+        alignas(SystemCacheLineSize) std::atomic<UI32> wakeEpoch = 0;
+        std::atomic<UI32> sleepers = 0;
+        alignas(SystemCacheLineSize) std::atomic<UI32> counterEpoch = 0;
+        std::atomic<UI32> counterWaiters = 0;
+
+        std::thread::id ownerThread;
+
+        static inline thread_local JobSystem* tlsSystem = nullptr;
+        static inline thread_local Size tlsIndex = 0;
+
+        static constexpr UI32 IDLE_SPIN_COUNT = 64;
+    };
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "WSTL/Types.hpp"
+
+namespace WSTL
+{
+    namespace BitInternal
+    {
+        constexpr int PopCount64(UI64 value) noexcept
+        {
+            value = value - ((value >> 1) & 0x5555555555555555ULL);
+            value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+            value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((value * 0x0101010101010101ULL) >> 56);
+        }
+
+        constexpr int CountTrailingZeros64(UI64 value) noexcept
+        {
+            return value == 0 ? 64 : PopCount64((value & (0 - value)) - 1);
+        }
+
+        constexpr int CountLeadingZeros64(UI64 value) noexcept
+        {
+            if(value == 0) return 64;
+
+            int count = 0;
+            for(int shift = 32; shift != 0; shift >>= 1)
+            {
+                if((value >> (64 - shift)) == 0)
+                {
+                    count += shift;
+                    value <<= shift;
+                }
+            }
+            return count;
+        }
+    }
+
+    /**
+     * \brief Returns the number of set bits. Uses the popcnt instruction, which MSVC builds assume on x86 and x64
+     * (every SSE4.2 processor has it), cnt on ARM64, and __builtin_popcountll elsewhere, which is popcnt when the
+     * target enables it
+     */
+    template<typename T>
+    constexpr int PopCount(T value) noexcept
+    {
+        static_assert(std::is_unsigned_v<T> && sizeof(T) <= 8, "PopCount takes an unsigned integer");
+        const auto bits = static_cast<UI64>(value);
+
+        if(__builtin_is_constant_evaluated()) return BitInternal::PopCount64(bits);
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_X64)
+        return static_cast<int>(__popcnt64(bits));
+#elif defined(_M_ARM64)
+        return static_cast<int>(_CountOneBits64(bits));
+#elif defined(_M_IX86)
+        return static_cast<int>(__popcnt(static_cast<UI32>(bits)) + __popcnt(static_cast<UI32>(bits >> 32)));
+#else
+        return BitInternal::PopCount64(bits);
+#endif
+#else
+        return __builtin_popcountll(bits);
+#endif
+    }
+
+    /**
+     * \brief Returns the number of zero bits below the lowest set bit, the width of T for 0 (tzcnt)
+     */
+    template<typename T>
+    constexpr int CountTrailingZeros(T value) noexcept
+    {
+        static_assert(std::is_unsigned_v<T> && sizeof(T) <= 8, "CountTrailingZeros takes an unsigned integer");
+        constexpr int Width = static_cast<int>(sizeof(T) * 8);
+        if(value == 0) return Width;
+
+        const auto bits = static_cast<UI64>(value);
+        if(__builtin_is_constant_evaluated()) return BitInternal::CountTrailingZeros64(bits);
+
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+        _BitScanForward64(&index, bits);
+#else
+        // 32-bit targets only scan 32 bits at a time, the high half is searched when the low one is empty
+        if(_BitScanForward(&index, static_cast<unsigned long>(bits))) return static_cast<int>(index);
+        _BitScanForward(&index, static_cast<unsigned long>(bits >> 32));
+        index += 32;
+#endif
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(bits);
+#endif
+    }
+
+    /**
+     * \brief Returns the number of zero bits above the highest set bit, the width of T for 0 (lzcnt)
+     */
+    template<typename T>
+    constexpr int CountLeadingZeros(T value) noexcept
+    {
+        static_assert(std::is_unsigned_v<T> && sizeof(T) <= 8, "CountLeadingZeros takes an unsigned integer");
+        constexpr int Width = static_cast<int>(sizeof(T) * 8);
+        if(value == 0) return Width;
+
+        const auto bits = static_cast<UI64>(value);
+        if(__builtin_is_constant_evaluated()) return BitInternal::CountLeadingZeros64(bits) - (64 - Width);
+
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+        _BitScanReverse64(&index, bits);
+#else
+        if(_BitScanReverse(&index, static_cast<unsigned long>(bits >> 32))) index += 32;
+        else _BitScanReverse(&index, static_cast<unsigned long>(bits));
+#endif
+        return Width - 1 - static_cast<int>(index);
+#else
+        return __builtin_clzll(bits) - (64 - Width);
+#endif
+    }
+}
@@ -0,0 +1,371 @@
+#pragma once
+#include <type_traits>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/utility/Bit.hpp"
+
+#if defined(__AVX2__)
+#define WSTL_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WSTL_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * \brief Bulk operations on arrays of unsigned words, shared by the bit containers.
+ * The instruction set is picked at compile time: AVX2 when the target has it (/arch:AVX2, -mavx2), SSE2 on any x64
+ * target, plain word loops otherwise and during constant evaluation. Destinations may alias the sources.
+ */
+namespace WSTL::BitKernels
+{
+    namespace Simd
+    {
+#if defined(WSTL_SIMD_AVX2)
+        constexpr const char* InstructionSet = "AVX2";
+        constexpr Size RegisterBytes = 32;
+        typedef __m256i Register;
+
+        inline Register Load(const void* pAddress) noexcept { return _mm256_loadu_si256(static_cast<const Register*>(pAddress)); }
+        inline void Store(void* pAddress, Register value) noexcept { _mm256_storeu_si256(static_cast<Register*>(pAddress), value); }
+        inline Register Zero() noexcept { return _mm256_setzero_si256(); }
+        inline Register Ones() noexcept { return _mm256_set1_epi32(-1); }
+        inline Register And(Register a, Register b) noexcept { return _mm256_and_si256(a, b); }
+        inline Register Or(Register a, Register b) noexcept { return _mm256_or_si256(a, b); }
+        inline Register Xor(Register a, Register b) noexcept { return _mm256_xor_si256(a, b); }
+        inline Register AndNot(Register a, Register b) noexcept { return _mm256_andnot_si256(b, a); }
+        inline bool IsZero(Register value) noexcept { return _mm256_testz_si256(value, value) != 0; }
+        inline bool IsOnes(Register value) noexcept { return _mm256_testc_si256(value, Ones()) != 0; }
+
+        template<Size WordSize>
+        inline Register ShiftLeft(Register value, unsigned shift) noexcept
+        {
+            const __m128i count = _mm_cvtsi32_si128(static_cast<int>(shift));
+            if constexpr (WordSize == 8) return _mm256_sll_epi64(value, count);
+            else return _mm256_sll_epi32(value, count);
+        }
+
+        template<Size WordSize>
+        inline Register ShiftRight(Register value, unsigned shift) noexcept
+        {
+            const __m128i count = _mm_cvtsi32_si128(static_cast<int>(shift));
+            if constexpr (WordSize == 8) return _mm256_srl_epi64(value, count);
+            else return _mm256_srl_epi32(value, count);
+        }
+
+        /**
+         * \brief Popcount of a register through a nibble lookup table, summed into four 64-bit lanes
+         */
+        inline Register PopCount(Register value) noexcept
+        {
+            const Register lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                     0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const Register lowMask = _mm256_set1_epi8(0x0F);
+            const Register low = _mm256_and_si256(value, lowMask);
+            const Register high = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowMask);
+            const Register counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+            return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+        }
+
+        inline Size HorizontalSum64(Register value) noexcept
+        {
+            alignas(32) UI64 lanes[4];
+            _mm256_store_si256(reinterpret_cast<Register*>(lanes), value);
+            return static_cast<Size>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        }
+#elif defined(WSTL_SIMD_SSE2)
+        constexpr const char* InstructionSet = "SSE2";
+        constexpr Size RegisterBytes = 16;
+        typedef __m128i Register;
+
+        inline Register Load(const void* pAddress) noexcept { return _mm_loadu_si128(static_cast<const Register*>(pAddress)); }
+        inline void Store(void* pAddress, Register value) noexcept { _mm_storeu_si128(static_cast<Register*>(pAddress), value); }
+        inline Register Zero() noexcept { return _mm_setzero_si128(); }
+        inline Register Ones() noexcept { return _mm_set1_epi32(-1); }
+        inline Register And(Register a, Register b) noexcept { return _mm_and_si128(a, b); }
+        inline Register Or(Register a, Register b) noexcept { return _mm_or_si128(a, b); }
+        inline Register Xor(Register a, Register b) noexcept { return _mm_xor_si128(a, b); }
+        inline Register AndNot(Register a, Register b) noexcept { return _mm_andnot_si128(b, a); }
+        inline bool IsZero(Register value) noexcept { return _mm_movemask_epi8(_mm_cmpeq_epi8(value, Zero())) == 0xFFFF; }
+        inline bool IsOnes(Register value) noexcept { return _mm_movemask_epi8(_mm_cmpeq_epi8(value, Ones())) == 0xFFFF; }
+
+        template<Size WordSize>
+        inline Register ShiftLeft(Register value, unsigned shift) noexcept
+        {
+            const Register count = _mm_cvtsi32_si128(static_cast<int>(shift));
+            if constexpr (WordSize == 8) return _mm_sll_epi64(value, count);
+            else return _mm_sll_epi32(value, count);
+        }
+
+        template<Size WordSize>
+        inline Register ShiftRight(Register value, unsigned shift) noexcept
+        {
+            const Register count = _mm_cvtsi32_si128(static_cast<int>(shift));
+            if constexpr (WordSize == 8) return _mm_srl_epi64(value, count);
+            else return _mm_srl_epi32(value, count);
+        }
+#else
+        constexpr const char* InstructionSet = "Portable";
+#endif
+    }
+
+    /**
+     * \brief Name of the instruction set the kernels were compiled for
+     */
+    constexpr const char* InstructionSet = Simd::InstructionSet;
+
+    namespace Internal
+    {
+        enum class Operation { And, Or, Xor, AndNot, Not };
+
+        template<Operation Op, typename Word>
+        constexpr Word Apply(Word a, Word b) noexcept
+        {
+            if constexpr (Op == Operation::And) return static_cast<Word>(a & b);
+            else if constexpr (Op == Operation::Or) return static_cast<Word>(a | b);
+            else if constexpr (Op == Operation::Xor) return static_cast<Word>(a ^ b);
+            else if constexpr (Op == Operation::AndNot) return static_cast<Word>(a & ~b);
+            else return static_cast<Word>(~a);
+        }
+
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+        template<Operation Op>
+        inline Simd::Register ApplyRegister(Simd::Register a, Simd::Register b) noexcept
+        {
+            if constexpr (Op == Operation::And) return Simd::And(a, b);
+            else if constexpr (Op == Operation::Or) return Simd::Or(a, b);
+            else if constexpr (Op == Operation::Xor) return Simd::Xor(a, b);
+            else if constexpr (Op == Operation::AndNot) return Simd::AndNot(a, b);
+            else return Simd::Xor(a, Simd::Ones());
+        }
+#endif
+
+        template<Operation Op, typename Word>
+        constexpr void Binary(Word* pDestination, const Word* a, const Word* b, Size count) noexcept
+        {
+            Size i = 0;
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+            if(!__builtin_is_constant_evaluated())
+            {
+                constexpr Size Step = Simd::RegisterBytes / sizeof(Word);
+                for(; i + Step <= count; i += Step)
+                {
+                    Simd::Store(pDestination + i, ApplyRegister<Op>(Simd::Load(a + i), Simd::Load(b + i)));
+                }
+            }
+#endif
+            for(; i < count; i++) pDestination[i] = Apply<Op>(a[i], b[i]);
+        }
+    }
+
+    /**
+     * \brief pDestination = a & b
+     */
+    template<typename Word>
+    constexpr void And(Word* pDestination, const Word* a, const Word* b, Size count) noexcept
+    {
+        Internal::Binary<Internal::Operation::And>(pDestination, a, b, count);
+    }
+
+    /**
+     * \brief pDestination = a | b
+     */
+    template<typename Word>
+    constexpr void Or(Word* pDestination, const Word* a, const Word* b, Size count) noexcept
+    {
+        Internal::Binary<Internal::Operation::Or>(pDestination, a, b, count);
+    }
+
+    /**
+     * \brief pDestination = a ^ b
+     */
+    template<typename Word>
+    constexpr void Xor(Word* pDestination, const Word* a, const Word* b, Size count) noexcept
+    {
+        Internal::Binary<Internal::Operation::Xor>(pDestination, a, b, count);
+    }
+
+    /**
+     * \brief pDestination = a & ~b
+     */
+    template<typename Word>
+    constexpr void AndNot(Word* pDestination, const Word* a, const Word* b, Size count) noexcept
+    {
+        Internal::Binary<Internal::Operation::AndNot>(pDestination, a, b, count);
+    }
+
+    /**
+     * \brief pDestination = ~pSource
+     */
+    template<typename Word>
+    constexpr void Not(Word* pDestination, const Word* pSource, Size count) noexcept
+    {
+        Internal::Binary<Internal::Operation::Not>(pDestination, pSource, pSource, count);
+    }
+
+    /**
+     * \brief Returns if any word is not zero
+     */
+    template<typename Word>
+    constexpr bool Any(const Word* pWords, Size count) noexcept
+    {
+        Size i = 0;
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+        if(!__builtin_is_constant_evaluated())
+        {
+            constexpr Size Step = Simd::RegisterBytes / sizeof(Word);
+            for(; i + Step <= count; i += Step)
+            {
+                if(!Simd::IsZero(Simd::Load(pWords + i))) return true;
+            }
+        }
+#endif
+        for(; i < count; i++)
+        {
+            if(pWords[i] != 0) return true;
+        }
+        return false;
+    }
+
+    /**
+     * \brief Returns if every bit of every word is set
+     */
+    template<typename Word>
+    constexpr bool All(const Word* pWords, Size count) noexcept
+    {
+        Size i = 0;
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+        if(!__builtin_is_constant_evaluated())
+        {
+            constexpr Size Step = Simd::RegisterBytes / sizeof(Word);
+            for(; i + Step <= count; i += Step)
+            {
+                if(!Simd::IsOnes(Simd::Load(pWords + i))) return false;
+            }
+        }
+#endif
+        for(; i < count; i++)
+        {
+            if(pWords[i] != static_cast<Word>(~Word{0})) return false;
+        }
+        return true;
+    }
+
+    /**
+     * \brief Returns the number of set bits. SSE2 has no byte shuffle, so it relies on the scalar popcnt
+     */
+    template<typename Word>
+    constexpr Size Count(const Word* pWords, Size count) noexcept
+    {
+        Size result = 0;
+        Size i = 0;
+#if defined(WSTL_SIMD_AVX2)
+        if(!__builtin_is_constant_evaluated())
+        {
+            constexpr Size Step = Simd::RegisterBytes / sizeof(Word);
+            Simd::Register sums = Simd::Zero();
+            for(; i + Step <= count; i += Step)
+            {
+                sums = _mm256_add_epi64(sums, Simd::PopCount(Simd::Load(pWords + i)));
+            }
+            result = Simd::HorizontalSum64(sums);
+        }
+#endif
+        for(; i < count; i++) result += PopCount(pWords[i]);
+        return result;
+    }
+
+    /**
+     * \brief Shifts the bits towards the higher positions, word and bit shift done in one pass from the top down
+     */
+    template<typename Word>
+    constexpr void ShiftLeft(Word* pDestination, const Word* pSource, Size count, Size shift) noexcept
+    {
+        constexpr Size WordBits = sizeof(Word) * 8;
+        const Size wordShift = shift / WordBits;
+        const auto bitShift = static_cast<unsigned>(shift % WordBits);
+
+        PtrDiff i = static_cast<PtrDiff>(count) - 1;
+        const auto lowest = static_cast<PtrDiff>(wordShift);
+
+        if(wordShift < count)
+        {
+            if(bitShift == 0)
+            {
+                for(; i >= lowest; i--) pDestination[i] = pSource[i - lowest];
+            }
+            else
+            {
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+                if(!__builtin_is_constant_evaluated())
+                {
+                    constexpr auto Step = static_cast<PtrDiff>(Simd::RegisterBytes / sizeof(Word));
+                    for(; i - (Step - 1) > lowest; i -= Step)
+                    {
+                        const PtrDiff base = i - (Step - 1);
+                        const auto high = Simd::Load(pSource + (base - lowest));
+                        const auto low = Simd::Load(pSource + (base - lowest - 1));
+                        Simd::Store(pDestination + base, Simd::Or(Simd::ShiftLeft<sizeof(Word)>(high, bitShift),
+                                                                  Simd::ShiftRight<sizeof(Word)>(low, WordBits - bitShift)));
+                    }
+                }
+#endif
+                for(; i > lowest; i--)
+                {
+                    pDestination[i] = static_cast<Word>(pSource[i - lowest] << bitShift) |
+                                      static_cast<Word>(pSource[i - lowest - 1] >> (WordBits - bitShift));
+                }
+                pDestination[i] = static_cast<Word>(pSource[0] << bitShift);
+                i--;
+            }
+        }
+
+        for(; i >= 0; i--) pDestination[i] = 0;
+    }
+
+    /**
+     * \brief Shifts the bits towards the lower positions, word and bit shift done in one pass from the bottom up
+     */
+    template<typename Word>
+    constexpr void ShiftRight(Word* pDestination, const Word* pSource, Size count, Size shift) noexcept
+    {
+        constexpr Size WordBits = sizeof(Word) * 8;
+        const Size wordShift = shift / WordBits;
+        const auto bitShift = static_cast<unsigned>(shift % WordBits);
+
+        Size i = 0;
+        if(wordShift < count)
+        {
+            const Size highest = count - wordShift - 1;
+            if(bitShift == 0)
+            {
+                for(; i <= highest; i++) pDestination[i] = pSource[i + wordShift];
+            }
+            else
+            {
+#if defined(WSTL_SIMD_AVX2) || defined(WSTL_SIMD_SSE2)
+                if(!__builtin_is_constant_evaluated())
+                {
+                    constexpr Size Step = Simd::RegisterBytes / sizeof(Word);
+                    for(; i + Step - 1 < highest; i += Step)
+                    {
+                        const auto low = Simd::Load(pSource + i + wordShift);
+                        const auto high = Simd::Load(pSource + i + wordShift + 1);
+                        Simd::Store(pDestination + i, Simd::Or(Simd::ShiftRight<sizeof(Word)>(low, bitShift),
+                                                               Simd::ShiftLeft<sizeof(Word)>(high, WordBits - bitShift)));
+                    }
+                }
+#endif
+                for(; i < highest; i++)
+                {
+                    pDestination[i] = static_cast<Word>(pSource[i + wordShift] >> bitShift) |
+                                      static_cast<Word>(pSource[i + wordShift + 1] << (WordBits - bitShift));
+                }
+                pDestination[i] = static_cast<Word>(pSource[count - 1] >> bitShift);
+                i++;
+            }
+        }
+
+        for(; i < count; i++) pDestination[i] = 0;
+    }
+}
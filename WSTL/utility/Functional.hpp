@@ -0,0 +1,52 @@
+#pragma once
+
+namespace WSTL
+{
+    /**
+     * \brief Function object for `a < b`
+     */
+    struct Less
+    {
+        template<typename A, typename B>
+        constexpr bool operator()(const A& a, const B& b) const
+        {
+            return a < b;
+        }
+    };
+
+    /**
+     * \brief Function object for `a > b`
+     */
+    struct Greater
+    {
+        template<typename A, typename B>
+        constexpr bool operator()(const A& a, const B& b) const
+        {
+            return b < a;
+        }
+    };
+
+    /**
+     * \brief Function object for `a + b`
+     */
+    struct Plus
+    {
+        template<typename A, typename B>
+        constexpr auto operator()(const A& a, const B& b) const
+        {
+            return a + b;
+        }
+    };
+
+    /**
+     * \brief Function object that returns its argument unchanged
+     */
+    struct Identity
+    {
+        template<typename T>
+        constexpr T&& operator()(T&& value) const noexcept
+        {
+            return static_cast<T&&>(value);
+        }
+    };
+}
@@ -1,35 +1,57 @@
 #pragma once
 
 #include <string.h>
+#include <string>
 
 #include "WSTL/Types.hpp"
+#include "WSTL/utility/TypeTraits.hpp"
 
 namespace WSTL
 {
-    /**
-     * @brief This function returns an Hash using the MurmurHash3 algorithm.
-     */
-    static inline UI32 Hash(const void* data, UI32 length)
+    namespace HashInternal
     {
-        auto Scramble = [](UI32 key)
+        constexpr UI32 Scramble(UI32 key)
         {
             key *= 0xcc9e2d51;
             key = (key << 15) | (key >> 17);
             key *= 0x1b873593;
             return key;
-        };
-        
+        }
+
+        constexpr UI32 Mix(UI32 seed, UI32 key)
+        {
+            seed ^= Scramble(key);
+            seed = (seed << 13) | (seed >> 19);
+            return seed * 5 + 0xe6546b64;
+        }
+
+        constexpr UI32 Finalize(UI32 seed, UI32 tail, UI32 length)
+        {
+            seed ^= Scramble(tail);
+            seed ^= length;
+            seed ^= seed >> 16;
+            seed *= 0x85ebca6b;
+            seed ^= seed >> 13;
+            seed *= 0xc2b2ae35;
+            seed ^= seed >> 16;
+            return seed;
+        }
+    }
+
+    /**
+     * @brief This function returns an Hash using the MurmurHash3 algorithm.
+     * Different seeds give independent hashes of the same data.
+     */
+    static inline UI32 Hash(const void* data, UI32 length, UI32 seed = 0)
+    {
         auto key = static_cast<const UI8*>(data);
-        UI32 seed = 0;
         UI32 k = 0;
 
         for(Size i = length >> 2; i; i--)
         {
             memcpy_s(&k, sizeof(UI32), key, sizeof(UI32));
             key += sizeof(UI32);
-            seed ^= Scramble(k);
-            seed = (seed << 13) | (seed >> 19);
-            seed = seed * 5 + 0xe6546b64;
+            seed = HashInternal::Mix(seed, k);
         }
 
         k = 0;
@@ -39,13 +61,69 @@ namespace WSTL
             k |= *key++;
         }
 
-        seed ^= Scramble(k);
-        seed ^= length;
-        seed ^= seed >> 16;
-        seed *= 0x85ebca6b;
-        seed ^= seed >> 13;
-        seed *= 0xc2b2ae35;
-        seed ^= seed >> 16;
-        return seed;
+        return HashInternal::Finalize(seed, k, length);
+    }
+
+    /**
+     * @brief Hashes characters with MurmurHash3, the same value Hash gives for the same bytes.
+     * Usable in constant expressions, so literal keys can be hashed at compile time.
+     */
+    static constexpr UI32 Hash(const char* data, UI32 length, UI32 seed = 0)
+    {
+        if (!__builtin_is_constant_evaluated())
+        {
+            return Hash(static_cast<const void*>(data), length, seed);
+        }
+
+        // Blocks are read little endian, as memcpy does on the targets the runtime version runs on
+        Size position = 0;
+        for(Size i = length >> 2; i; i--, position += 4)
+        {
+            const UI32 k = static_cast<UI32>(static_cast<UI8>(data[position])) |
+                           static_cast<UI32>(static_cast<UI8>(data[position + 1])) << 8 |
+                           static_cast<UI32>(static_cast<UI8>(data[position + 2])) << 16 |
+                           static_cast<UI32>(static_cast<UI8>(data[position + 3])) << 24;
+            seed = HashInternal::Mix(seed, k);
+        }
+
+        UI32 k = 0;
+        for(Size i = length & 3; i; i--)
+        {
+            k <<= 8;
+            k |= static_cast<UI8>(data[position++]);
+        }
+
+        return HashInternal::Finalize(seed, k, length);
+    }
+
+    template <typename T, typename = void>
+    struct HasCustomHash : FalseType {};
+
+    template <typename T>
+    struct HasCustomHash<T, std::void_t<decltype(std::declval<T>().Hash())>> : TrueType {};
+
+    /**
+     * @brief Hashes a key the way the hashed containers do: with its Hash() member if it has one,
+     * otherwise with MurmurHash3 over its bytes. The seed only applies to the MurmurHash3 path.
+     */
+    template <typename T>
+    static inline Size HashKey(const T& key, UI32 seed = 0)
+    {
+        if constexpr (HasCustomHash<T>::value)
+        {
+            return static_cast<Size>(key.Hash());
+        }
+        else
+        {
+            return Hash(&key, sizeof(T), seed);
+        }
+    }
+
+    /**
+     * @brief Hashes the characters of the string.
+     */
+    static inline Size HashKey(const std::string& str, UI32 seed = 0)
+    {
+        return Hash(str.data(), static_cast<UI32>(str.size()), seed);
     }
 }
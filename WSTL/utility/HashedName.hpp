@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+
+#include "WSTL/Types.hpp"
+#include "WSTL/containers/StringView.hpp"
+#include "WSTL/utility/Hash.hpp"
+
+namespace WSTL
+{
+    /**
+     * @brief A name reduced to its 32-bit MurmurHash3, for keys that are compared and looked up far more often than
+     * they are read. Comparing two names is one integer compare and HashMap uses the stored hash through Hash(), so
+     * the characters are never touched. Debug builds also keep a view of the name for inspection, it isn't copied,
+     * so names built from temporaries should only be read while those live. Distinct names whose hashes collide
+     * compare equal.
+     */
+    class HashedName
+    {
+    public:
+        /**
+         * @brief Default constructor, the hash of the empty name
+         */
+        constexpr HashedName() noexcept = default;
+
+        /**
+         * @brief Hashes name, at compile time when constructed in a constant expression
+         */
+        constexpr explicit HashedName(StringView name) noexcept
+            : hash(WSTL::Hash(name.Data(), static_cast<UI32>(name.Size())))
+#if defined(_DEBUG)
+            , name(name)
+#endif
+        {
+        }
+
+        /**
+         * @brief Constructor from a hash computed elsewhere, e.g. read from a file. Has no debug name
+         */
+        constexpr explicit HashedName(UI32 hash) noexcept : hash(hash)
+        {
+        }
+
+        /**
+         * @brief Returns the hash of the name
+         */
+        constexpr Size Hash() const noexcept
+        {
+            return hash;
+        }
+
+        /**
+         * @brief Returns the name in debug builds, an empty view otherwise or when it was built from a hash
+         */
+        constexpr StringView Name() const noexcept
+        {
+#if defined(_DEBUG)
+            return name;
+#else
+            return StringView();
+#endif
+        }
+
+        constexpr bool operator==(HashedName other) const noexcept
+        {
+            return hash == other.hash;
+        }
+
+        constexpr bool operator!=(HashedName other) const noexcept
+        {
+            return hash != other.hash;
+        }
+
+        constexpr bool operator<(HashedName other) const noexcept
+        {
+            return hash < other.hash;
+        }
+
+    private:
+        UI32 hash = 0;
+#if defined(_DEBUG)
+        StringView name;
+#endif
+    };
+
+    inline namespace Literals
+    {
+        /**
+         * @brief Hashes a string literal at compile time: "player.health"_hash
+         */
+        consteval HashedName operator""_hash(const char* pName, std::size_t length) noexcept
+        {
+            return HashedName(StringView(pName, length));
+        }
+    }
+}
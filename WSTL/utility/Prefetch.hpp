@@ -0,0 +1,36 @@
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace WSTL
+{
+    /**
+     * \brief Hints the CPU to load the cache line holding pAddress for reading, it never faults
+     */
+    inline void Prefetch(const void* pAddress) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_X64) || defined(_M_IX86)
+        _mm_prefetch(static_cast<const char*>(pAddress), _MM_HINT_T0);
+#elif defined(_M_ARM64)
+        __prefetch(pAddress);
+#endif
+#else
+        __builtin_prefetch(pAddress, 0, 3);
+#endif
+    }
+
+    /**
+     * \brief Hints the CPU to load the cache line holding pAddress because it is about to be written
+     */
+    inline void PrefetchWrite(const void* pAddress) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        Prefetch(pAddress);
+#else
+        __builtin_prefetch(pAddress, 1, 3);
+#endif
+    }
+}
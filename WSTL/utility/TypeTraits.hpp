@@ -1,5 +1,8 @@
 ﻿#pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "WSTL/Types.hpp"
 
 namespace WSTL
@@ -101,6 +104,17 @@ namespace WSTL
     template <class Type>
     inline constexpr bool IsTrivialV = IsTrivial<Type>::value;
     inline constexpr bool IsTrivialV2 = IsTrivial<int>::value;
+
+    template <class Type, class = void>
+    struct IsContiguousContainer : FalseType {};
+    /**
+     * @brief Checks if given Type exposes its elements as one block through Data() and Size()
+     */
+    template <class Type>
+    struct IsContiguousContainer<Type, std::void_t<decltype(std::declval<Type&>().Data()),
+                                                    decltype(std::declval<Type&>().Size())>> : TrueType {};
+    template <class Type>
+    inline constexpr bool IsContiguousContainerV = IsContiguousContainer<Type>::value;
     
 #pragma endregion
 }
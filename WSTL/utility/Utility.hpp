@@ -1,8 +1,12 @@
 ﻿#pragma once
 
 #include "WSTL/utility/Any.hpp"
+#include "WSTL/utility/Bit.hpp"
 #include "WSTL/utility/Optional.hpp"
 #include "WSTL/utility/Hash.hpp"
+#include "WSTL/utility/HashedName.hpp"
+#include "WSTL/utility/Prefetch.hpp"
+#include "WSTL/utility/Functional.hpp"
 
 namespace WSTL
 {